@@ -0,0 +1,94 @@
+#ifndef QTANTDBENCHMARK_H
+#define QTANTDBENCHMARK_H
+
+#include <QAbstractTableModel>
+#include <QApplication>
+#include <QImage>
+#include <QWidget>
+#include <QtTest/QtTest>
+
+namespace QtAntdBenchmark {
+
+// Device pixel ratios every paint benchmark is run at
+inline QList<qreal> devicePixelRatios()
+{
+    return QList<qreal>() << 1.0 << 2.0;
+}
+
+// Offscreen target for one widget at the given device pixel ratio
+inline QImage createTarget(const QWidget *widget, qreal dpr)
+{
+    QImage image(widget->size() * dpr, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(dpr);
+    image.fill(Qt::transparent);
+    return image;
+}
+
+// Runs paintEvent() of widget (and its children) into image, without the
+// parent background so only the component's own painting is measured
+inline void render(QWidget *widget, QImage *image)
+{
+    widget->render(image, QPoint(), QRegion(), QWidget::DrawChildren);
+}
+
+// Table of any number of rows whose texts are generated when asked for, so
+// a million-row model costs no memory. Column 0 is a unique label, column 1
+// one of a few cities and column 2 a note of one to five sentences, for
+// rows of different heights when wrapped.
+class GeneratedModel : public QAbstractTableModel
+{
+public:
+    explicit GeneratedModel(int rows, QObject *parent = nullptr)
+        : QAbstractTableModel(parent)
+        , m_rows(rows)
+    {
+    }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : m_rows;
+    }
+
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : 3;
+    }
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override
+    {
+        static const char *const cities[] = { "Berlin", "Zürich", "São Paulo", "Kraków", "Reykjavík" };
+
+        if (!index.isValid() || role != Qt::DisplayRole) {
+            return QVariant();
+        }
+        const int row = index.row();
+        switch (index.column()) {
+        case 0:
+            return QStringLiteral("Asset %1").arg(row);
+        case 1:
+            return QString::fromUtf8(cities[row % 5]);
+        default:
+            return QStringLiteral("Checked and tagged for the next audit. ").repeated(row % 5 + 1);
+        }
+    }
+
+private:
+    int m_rows;
+};
+
+} // namespace QtAntdBenchmark
+
+// Benchmarks must run without a display server; an explicitly chosen platform
+// (e.g. QT_QPA_PLATFORM=xcb to compare against a real backing store) is kept.
+#define QTANTD_BENCHMARK_MAIN(TestObject)                          \
+    int main(int argc, char *argv[])                               \
+    {                                                              \
+        if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {       \
+            qputenv("QT_QPA_PLATFORM", "offscreen");               \
+        }                                                          \
+        QApplication app(argc, argv);                              \
+        TestObject test;                                           \
+        return QTest::qExec(&test, argc, argv);                    \
+    }
+
+#endif // QTANTDBENCHMARK_H
@@ -0,0 +1,302 @@
+#include "qtantdbenchmark.h"
+
+#include <QEnterEvent>
+#include <QFocusEvent>
+#include <QMouseEvent>
+#include <QScopedPointer>
+
+#include "qtantdbutton.h"
+#include "qtantddivider.h"
+#include "qtantdinput.h"
+#include "qtantdswitch.h"
+
+/*!
+ *  \internal
+ *  \brief Measures paintEvent() of every component, one data row per
+ *  combination of type, size, interaction state and device pixel ratio.
+ *
+ *  Each row renders the same widget into an offscreen QImage repeatedly, so the
+ *  numbers include the render caches once they are warm, which is what an
+ *  animation or hover repaint costs in an application.
+ */
+class QtAntdPaintBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum State {
+        NormalState,
+        HoverState,
+        PressedState,
+        FocusState,
+        DisabledState,
+        LoadingState,
+        CheckedState,
+        TogglingState
+    };
+    Q_ENUM(State)
+
+private slots:
+    void button_data();
+    void button();
+    void switchWidget_data();
+    void switchWidget();
+    void input_data();
+    void input();
+    void divider_data();
+    void divider();
+
+private:
+    static void applyState(QWidget *widget, State state);
+    static void benchmarkPaint(QWidget *widget, qreal dpr);
+};
+
+namespace {
+
+const char *const buttonTypeNames[] = { "primary", "default", "dashed", "text", "link" };
+const char *const sizeNames[] = { "small", "medium", "large" };
+const char *const inputStatusNames[] = { "normal", "error", "warning", "success" };
+const char *const alignmentNames[] = { "left", "center", "right" };
+const char *const lineStyleNames[] = { "solid", "dash", "dot" };
+
+const char *stateName(QtAntdPaintBenchmark::State state)
+{
+    switch (state) {
+    case QtAntdPaintBenchmark::NormalState:   return "normal";
+    case QtAntdPaintBenchmark::HoverState:    return "hover";
+    case QtAntdPaintBenchmark::PressedState:  return "pressed";
+    case QtAntdPaintBenchmark::FocusState:    return "focus";
+    case QtAntdPaintBenchmark::DisabledState: return "disabled";
+    case QtAntdPaintBenchmark::LoadingState:  return "loading";
+    case QtAntdPaintBenchmark::CheckedState:  return "checked";
+    case QtAntdPaintBenchmark::TogglingState: return "toggling";
+    }
+    return "";
+}
+
+} // namespace
+
+/*!
+ *  \internal
+ *  Puts widget into state through the same events the user would cause, so
+ *  the private hover/press/focus flags are set exactly as in an application.
+ */
+void QtAntdPaintBenchmark::applyState(QWidget *widget, State state)
+{
+    const QPointF center = QRectF(widget->rect()).center();
+
+    switch (state) {
+    case HoverState: {
+        QEnterEvent event(center, center, center);
+        QApplication::sendEvent(widget, &event);
+        break;
+    }
+    case PressedState: {
+        QEnterEvent enter(center, center, center);
+        QApplication::sendEvent(widget, &enter);
+        QMouseEvent press(QEvent::MouseButtonPress, center, center,
+                          Qt::LeftButton, Qt::LeftButton, Qt::NoModifier);
+        QApplication::sendEvent(widget, &press);
+        break;
+    }
+    case FocusState: {
+        QFocusEvent event(QEvent::FocusIn, Qt::TabFocusReason);
+        QApplication::sendEvent(widget, &event);
+        break;
+    }
+    case DisabledState:
+        widget->setEnabled(false);
+        break;
+    default:
+        break;
+    }
+}
+
+void QtAntdPaintBenchmark::benchmarkPaint(QWidget *widget, qreal dpr)
+{
+    QImage image = QtAntdBenchmark::createTarget(widget, dpr);
+
+    QBENCHMARK {
+        QtAntdBenchmark::render(widget, &image);
+    }
+}
+
+void QtAntdPaintBenchmark::button_data()
+{
+    QTest::addColumn<int>("type");
+    QTest::addColumn<int>("size");
+    QTest::addColumn<State>("state");
+    QTest::addColumn<qreal>("dpr");
+
+    const QList<State> states = QList<State>() << NormalState << HoverState << PressedState
+                                               << DisabledState << LoadingState;
+    for (int type = QtAntdButton::Primary; type <= QtAntdButton::Link; ++type) {
+        for (int size = QtAntdButton::Small; size <= QtAntdButton::Large; ++size) {
+            for (State state : states) {
+                for (qreal dpr : QtAntdBenchmark::devicePixelRatios()) {
+                    QTest::addRow("%s/%s/%s/@%gx", buttonTypeNames[type], sizeNames[size],
+                                  stateName(state), dpr)
+                        << type << size << state << dpr;
+                }
+            }
+        }
+    }
+}
+
+void QtAntdPaintBenchmark::button()
+{
+    QFETCH(int, type);
+    QFETCH(int, size);
+    QFETCH(State, state);
+    QFETCH(qreal, dpr);
+
+    QScopedPointer<QtAntdButton> button(new QtAntdButton("Benchmark"));
+    button->setButtonType(QtAntdButton::ButtonType(type));
+    button->setButtonSize(QtAntdButton::ButtonSize(size));
+    button->setLoading(state == LoadingState);
+    button->resize(button->sizeHint());
+    applyState(button.data(), state);
+
+    benchmarkPaint(button.data(), dpr);
+}
+
+void QtAntdPaintBenchmark::switchWidget_data()
+{
+    QTest::addColumn<int>("size");
+    QTest::addColumn<State>("state");
+    QTest::addColumn<bool>("withText");
+    QTest::addColumn<qreal>("dpr");
+
+    const QList<State> states = QList<State>() << NormalState << CheckedState << TogglingState
+                                               << HoverState << PressedState << FocusState
+                                               << DisabledState << LoadingState;
+    for (int size = QtAntdSwitch::Small; size <= QtAntdSwitch::Large; ++size) {
+        for (State state : states) {
+            for (bool withText : { false, true }) {
+                for (qreal dpr : QtAntdBenchmark::devicePixelRatios()) {
+                    QTest::addRow("%s/%s/%s/@%gx", sizeNames[size], stateName(state),
+                                  withText ? "text" : "plain", dpr)
+                        << size << state << withText << dpr;
+                }
+            }
+        }
+    }
+}
+
+void QtAntdPaintBenchmark::switchWidget()
+{
+    QFETCH(int, size);
+    QFETCH(State, state);
+    QFETCH(bool, withText);
+    QFETCH(qreal, dpr);
+
+    QScopedPointer<QtAntdSwitch> widget(new QtAntdSwitch);
+    widget->setSwitchSize(QtAntdSwitch::SwitchSize(size));
+    if (withText) {
+        widget->setCheckedText("On");
+        widget->setUncheckedText("Off");
+    }
+    widget->setLoading(state == LoadingState);
+    if (state == CheckedState || state == TogglingState) {
+        // The toggle animation never ticks for a hidden widget; pin its value
+        widget->setChecked(true);
+        widget->setAnimationValue(state == TogglingState ? 0.5 : 1.0);
+    }
+    widget->resize(widget->sizeHint());
+    applyState(widget.data(), state);
+
+    benchmarkPaint(widget.data(), dpr);
+}
+
+void QtAntdPaintBenchmark::input_data()
+{
+    QTest::addColumn<int>("size");
+    QTest::addColumn<int>("status");
+    QTest::addColumn<State>("state");
+    QTest::addColumn<bool>("affixes");
+    QTest::addColumn<qreal>("dpr");
+
+    const QList<State> states = QList<State>() << NormalState << HoverState << FocusState
+                                               << DisabledState;
+    for (int size = QtAntdInput::Small; size <= QtAntdInput::Large; ++size) {
+        for (int status = QtAntdInput::Normal; status <= QtAntdInput::Success; ++status) {
+            for (State state : states) {
+                for (bool affixes : { false, true }) {
+                    for (qreal dpr : QtAntdBenchmark::devicePixelRatios()) {
+                        QTest::addRow("%s/%s/%s/%s/@%gx", sizeNames[size], inputStatusNames[status],
+                                      stateName(state), affixes ? "affixes" : "plain", dpr)
+                            << size << status << state << affixes << dpr;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void QtAntdPaintBenchmark::input()
+{
+    QFETCH(int, size);
+    QFETCH(int, status);
+    QFETCH(State, state);
+    QFETCH(bool, affixes);
+    QFETCH(qreal, dpr);
+
+    QScopedPointer<QtAntdInput> input(new QtAntdInput("Placeholder"));
+    input->setInputSize(QtAntdInput::InputSize(size));
+    input->setInputStatus(QtAntdInput::InputStatus(status));
+    input->setText("Benchmark text");
+    if (affixes) {
+        input->setPrefixText("https://");
+        input->setSuffixText(".com");
+    }
+    input->resize(240, input->sizeHint().height());
+    applyState(input.data(), state);
+
+    benchmarkPaint(input.data(), dpr);
+}
+
+void QtAntdPaintBenchmark::divider_data()
+{
+    QTest::addColumn<bool>("withText");
+    QTest::addColumn<int>("alignment");
+    QTest::addColumn<int>("lineStyle");
+    QTest::addColumn<qreal>("dpr");
+
+    for (bool withText : { false, true }) {
+        for (int alignment = QtAntdDivider::Left; alignment <= QtAntdDivider::Right; ++alignment) {
+            // Alignment only matters when there is text to place
+            if (!withText && alignment != QtAntdDivider::Center) {
+                continue;
+            }
+            for (int lineStyle = QtAntdDivider::SolidLine; lineStyle <= QtAntdDivider::DotLine; ++lineStyle) {
+                for (qreal dpr : QtAntdBenchmark::devicePixelRatios()) {
+                    QTest::addRow("%s/%s/%s/@%gx", withText ? "text" : "plain",
+                                  alignmentNames[alignment], lineStyleNames[lineStyle], dpr)
+                        << withText << alignment << lineStyle << dpr;
+                }
+            }
+        }
+    }
+}
+
+void QtAntdPaintBenchmark::divider()
+{
+    QFETCH(bool, withText);
+    QFETCH(int, alignment);
+    QFETCH(int, lineStyle);
+    QFETCH(qreal, dpr);
+
+    QScopedPointer<QtAntdDivider> divider(new QtAntdDivider);
+    if (withText) {
+        divider->setText("Section");
+    }
+    divider->setTextAlignment(QtAntdDivider::TextAlignment(alignment));
+    divider->setLineStyle(QtAntdDivider::LineStyle(lineStyle));
+    divider->resize(320, divider->sizeHint().height());
+
+    benchmarkPaint(divider.data(), dpr);
+}
+
+QTANTD_BENCHMARK_MAIN(QtAntdPaintBenchmark)
+
+#include "qtantdpaintbenchmark.moc"
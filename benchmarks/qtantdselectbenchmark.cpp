@@ -0,0 +1,118 @@
+#include "qtantdbenchmark.h"
+
+#include "qtantdsearchproxymodel.h"
+#include "qtantdselect.h"
+
+/*!
+ *  \internal
+ *  \brief QtAntdSelect and its search on large option models.
+ *
+ *  openPopup shows and hides the dropdown, which should cost the same for
+ *  any number of options. search types a query and waits until its result
+ *  is applied (the first iteration also builds the index). findExact is the
+ *  lookup Enter does in Tags mode, with the typed text already searched.
+ */
+class QtAntdSelectBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void openPopup_data();
+    void openPopup();
+    void search_data();
+    void search();
+    void findExact_data();
+    void findExact();
+
+private:
+    static void addRows();
+    static void waitForResult(QtAntdSearchProxyModel *proxy);
+};
+
+void QtAntdSelectBenchmark::addRows()
+{
+    QTest::addColumn<int>("rows");
+
+    for (int rows : { 10000, 100000 }) {
+        QTest::addRow("%d", rows) << rows;
+    }
+}
+
+void QtAntdSelectBenchmark::waitForResult(QtAntdSearchProxyModel *proxy)
+{
+    while (proxy->isSearching()) {
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+    }
+    proxy->flush();
+}
+
+void QtAntdSelectBenchmark::openPopup_data()
+{
+    addRows();
+}
+
+void QtAntdSelectBenchmark::openPopup()
+{
+    QFETCH(int, rows);
+
+    QtAntdBenchmark::GeneratedModel model(rows);
+    QtAntdSelect select;
+    select.setModel(&model);
+    select.setMode(QtAntdSelect::Tags);
+    select.resize(240, 32);
+    select.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&select));
+
+    QBENCHMARK {
+        select.showPopup();
+        QCoreApplication::processEvents();
+        select.hidePopup();
+    }
+}
+
+void QtAntdSelectBenchmark::search_data()
+{
+    addRows();
+}
+
+void QtAntdSelectBenchmark::search()
+{
+    QFETCH(int, rows);
+
+    QtAntdBenchmark::GeneratedModel model(rows);
+    QtAntdSearchProxyModel proxy;
+    proxy.setSourceModel(&model);
+
+    // Alternating queries, so each iteration searches and filters again
+    int iteration = 0;
+    QBENCHMARK {
+        proxy.setSearchText(QStringLiteral("Asset %1").arg(rows / 2 + iteration++ % 2));
+        waitForResult(&proxy);
+    }
+}
+
+void QtAntdSelectBenchmark::findExact_data()
+{
+    addRows();
+}
+
+void QtAntdSelectBenchmark::findExact()
+{
+    QFETCH(int, rows);
+
+    QtAntdBenchmark::GeneratedModel model(rows);
+    QtAntdSearchProxyModel proxy;
+    proxy.setSourceModel(&model);
+    const QString text = QStringLiteral("Asset %1").arg(rows - 1);
+    proxy.setSearchText(text);
+    waitForResult(&proxy);
+
+    QBENCHMARK {
+        const QModelIndex found = proxy.findExact(text);
+        QCOMPARE(found.row(), rows - 1);
+    }
+}
+
+QTANTD_BENCHMARK_MAIN(QtAntdSelectBenchmark)
+
+#include "qtantdselectbenchmark.moc"
@@ -0,0 +1,65 @@
+#include "qtantdbenchmark.h"
+
+#include <QScrollBar>
+
+#include "qtantdtable.h"
+
+/*!
+ *  \internal
+ *  \brief Scrolling QtAntdTable through large models, one page per
+ *  iteration, including the paint of the newly exposed rows.
+ *
+ *  With uniform row heights this is the cost of a scroll step at any model
+ *  size; with variable heights each step also measures the rows it exposes.
+ *  A frame at 60 fps has about 16 ms for both.
+ */
+class QtAntdTableBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void scroll_data();
+    void scroll();
+};
+
+void QtAntdTableBenchmark::scroll_data()
+{
+    QTest::addColumn<int>("rows");
+    QTest::addColumn<bool>("uniform");
+
+    for (int rows : { 10000, 1000000 }) {
+        for (bool uniform : { true, false }) {
+            QTest::addRow("%d/%s", rows, uniform ? "uniform" : "variable") << rows << uniform;
+        }
+    }
+}
+
+void QtAntdTableBenchmark::scroll()
+{
+    QFETCH(int, rows);
+    QFETCH(bool, uniform);
+
+    QtAntdBenchmark::GeneratedModel model(rows);
+    QtAntdTable table;
+    table.setModel(&model);
+    table.setUniformRowHeights(uniform);
+    table.setWordWrap(!uniform);
+    table.resize(800, 600);
+    table.setColumnWidth(2, 360);
+    table.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&table));
+
+    QImage image = QtAntdBenchmark::createTarget(&table, 1.0);
+    QScrollBar *scrollBar = table.verticalScrollBar();
+    const int page = scrollBar->pageStep();
+
+    QBENCHMARK {
+        const int next = scrollBar->value() + page;
+        scrollBar->setValue(next > scrollBar->maximum() ? 0 : next);
+        QtAntdBenchmark::render(&table, &image);
+    }
+}
+
+QTANTD_BENCHMARK_MAIN(QtAntdTableBenchmark)
+
+#include "qtantdtablebenchmark.moc"
@@ -0,0 +1,291 @@
+#include "qtantdbenchmark.h"
+
+#include <QElapsedTimer>
+#include <QScopedPointer>
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+#include "qtantdbutton.h"
+#include "qtantddivider.h"
+#include "qtantdinput.h"
+#include "qtantdstyle.h"
+#include "qtantdswitch.h"
+#include "qtantdtheme.h"
+
+// Every allocation made through the global operator new in this process is
+// counted. On ELF/Mach-O platforms this includes allocations made inside the
+// component and Qt libraries; Windows DLLs keep their own operator new, so
+// there the count only covers inline code from the headers.
+namespace {
+std::atomic<quint64> gAllocations(0);
+}
+
+void *operator new(std::size_t size)
+{
+    ++gAllocations;
+    if (void *p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    ++gAllocations;
+    return std::malloc(size ? size : 1);
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept
+{
+    std::free(p);
+}
+
+/*!
+ *  \internal
+ *  \brief Theme subsystem baseline: per-lookup latency and allocations of each
+ *  color accessor, and the end-to-end cost of switching between light and dark
+ *  mode with many live components.
+ */
+class QtAntdThemeBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Lookup {
+        ThemeStringKey,     // QtAntdTheme::getColor(const QString &), prebuilt keys
+        ThemeStringLiteral, // QtAntdTheme::getColor(const QString &), key built per call
+        ThemeColor,         // QtAntdTheme::getColor(Antd::Color)
+        ThemeToken,         // QtAntdTheme::getColor(Antd::ColorToken)
+        StyleStringKey,     // QtAntdStyle::themeColor(const QString &)
+        StyleToken          // QtAntdStyle::themeColor(Antd::ColorToken)
+    };
+    Q_ENUM(Lookup)
+
+private slots:
+    void lookupLatency_data();
+    void lookupLatency();
+    void lookupAllocations_data();
+    void lookupAllocations();
+    void themeSwitch_data();
+    void themeSwitch();
+
+private:
+    static void addLookupRows();
+    static quint32 runLookups(Lookup lookup, int count);
+};
+
+namespace {
+
+// Lookups per measured round; large enough to hide the timer resolution
+const int gLookupsPerRound = 1000000;
+const int gLatencyRounds = 5;
+
+const char *const gTokenKeys[Antd::ColorTokenCount] = {
+    "primary", "primary-hover", "primary-active", "primary-outline", "primary-background",
+    "secondary", "secondary-hover", "secondary-active",
+    "text", "text-secondary", "text-tertiary", "text-quaternary", "text-disabled",
+    "background", "background-secondary", "surface", "surface-variant",
+    "border", "border-secondary", "border-variant",
+    "success", "warning", "error", "info",
+    "error-hover", "error-active", "error-background",
+    "disabled", "disabled-background"
+};
+
+const int gAntdColorCount = Antd::Info + 1;
+
+// Keeps lookup results observable so the loops are not optimized away
+volatile quint32 gSink = 0;
+
+} // namespace
+
+void QtAntdThemeBenchmark::addLookupRows()
+{
+    QTest::addColumn<Lookup>("lookup");
+
+    QTest::newRow("theme/string-key") << ThemeStringKey;
+    QTest::newRow("theme/string-literal") << ThemeStringLiteral;
+    QTest::newRow("theme/color") << ThemeColor;
+    QTest::newRow("theme/token") << ThemeToken;
+    QTest::newRow("style/string-key") << StyleStringKey;
+    QTest::newRow("style/token") << StyleToken;
+}
+
+/*!
+ *  \internal
+ *  Performs count lookups of the given kind, cycling through every key so the
+ *  result does not depend on a single hash bucket or array slot.
+ */
+quint32 QtAntdThemeBenchmark::runLookups(Lookup lookup, int count)
+{
+    static QStringList keys;
+    if (keys.isEmpty()) {
+        for (const char *key : gTokenKeys) {
+            keys.append(QString::fromLatin1(key));
+        }
+    }
+
+    QtAntdStyle &style = QtAntdStyle::instance();
+    const QtAntdTheme *theme = style.theme();
+
+    quint32 sum = 0;
+    for (int i = 0; i < count; ++i) {
+        const int token = i % Antd::ColorTokenCount;
+        QColor color;
+        switch (lookup) {
+        case ThemeStringKey:
+            color = theme->getColor(keys.at(token));
+            break;
+        case ThemeStringLiteral:
+            color = theme->getColor(QString::fromLatin1(gTokenKeys[token]));
+            break;
+        case ThemeColor:
+            color = theme->getColor(Antd::Color(i % gAntdColorCount));
+            break;
+        case ThemeToken:
+            color = theme->getColor(Antd::ColorToken(token));
+            break;
+        case StyleStringKey:
+            color = style.themeColor(keys.at(token));
+            break;
+        case StyleToken:
+            color = style.themeColor(Antd::ColorToken(token));
+            break;
+        }
+        sum += color.rgba();
+    }
+    return sum;
+}
+
+void QtAntdThemeBenchmark::lookupLatency_data()
+{
+    addLookupRows();
+}
+
+/*!
+ *  \internal
+ *  Reports nanoseconds per lookup, the best of a few rounds.
+ */
+void QtAntdThemeBenchmark::lookupLatency()
+{
+    QFETCH(Lookup, lookup);
+
+    // Warm up lazily built tables and the key list
+    gSink = gSink + runLookups(lookup, Antd::ColorTokenCount);
+
+    qint64 best = std::numeric_limits<qint64>::max();
+    QElapsedTimer timer;
+    for (int round = 0; round < gLatencyRounds; ++round) {
+        timer.start();
+        gSink = gSink + runLookups(lookup, gLookupsPerRound);
+        best = qMin(best, timer.nsecsElapsed());
+    }
+
+    QTest::setBenchmarkResult(qreal(best) / gLookupsPerRound, QTest::WalltimeNanoseconds);
+}
+
+void QtAntdThemeBenchmark::lookupAllocations_data()
+{
+    addLookupRows();
+}
+
+/*!
+ *  \internal
+ *  Reports heap allocations per lookup as the benchmark "events" metric.
+ */
+void QtAntdThemeBenchmark::lookupAllocations()
+{
+    QFETCH(Lookup, lookup);
+
+    gSink = gSink + runLookups(lookup, Antd::ColorTokenCount);
+
+    const quint64 before = gAllocations.load();
+    gSink = gSink + runLookups(lookup, gLookupsPerRound);
+    const quint64 allocations = gAllocations.load() - before;
+
+    QTest::setBenchmarkResult(qreal(allocations) / gLookupsPerRound, QTest::Events);
+}
+
+void QtAntdThemeBenchmark::themeSwitch_data()
+{
+    QTest::addColumn<int>("widgetCount");
+
+    QTest::newRow("100") << 100;
+    QTest::newRow("1000") << 1000;
+    QTest::newRow("10000") << 10000;
+}
+
+/*!
+ *  \internal
+ *  Measures one light/dark switch end to end: setThemeMode(), the coalesced
+ *  repaint flush queued by the theme registry, and the resulting paint of
+ *  every component.
+ *
+ *  The components are a mix of buttons, switches, inputs and dividers laid out
+ *  in a grid that wraps around within one window, so every instance is visible
+ *  and painted no matter how many there are.
+ */
+void QtAntdThemeBenchmark::themeSwitch()
+{
+    QFETCH(int, widgetCount);
+
+    const QSize cell(128, 40);
+    const int columns = 10;
+    const int rows = 20;
+
+    QScopedPointer<QWidget> window(new QWidget);
+    window->resize(cell.width() * columns, cell.height() * rows);
+
+    for (int i = 0; i < widgetCount; ++i) {
+        QWidget *widget = nullptr;
+        switch (i % 4) {
+        case 0:
+            widget = new QtAntdButton("Button", window.data());
+            break;
+        case 1:
+            widget = new QtAntdSwitch(window.data());
+            break;
+        case 2:
+            widget = new QtAntdInput("Input", window.data());
+            break;
+        default:
+            widget = new QtAntdDivider("Divider", window.data());
+            break;
+        }
+        const int slot = i % (columns * rows);
+        widget->setGeometry(QRect(QPoint((slot % columns) * cell.width(), (slot / columns) * cell.height()),
+                                  cell - QSize(8, 8)));
+    }
+
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    QCoreApplication::processEvents();
+
+    QtAntdTheme *theme = QtAntdStyle::instance().theme();
+    const Antd::ThemeMode initialMode = theme->themeMode();
+
+    QBENCHMARK {
+        theme->setThemeMode(theme->themeMode() == Antd::Light ? Antd::Dark : Antd::Light);
+        // Runs the queued registry flush, then delivers the update requests it posted
+        QCoreApplication::processEvents();
+        QCoreApplication::sendPostedEvents();
+    }
+
+    theme->setThemeMode(initialMode);
+    QCoreApplication::processEvents();
+}
+
+QTANTD_BENCHMARK_MAIN(QtAntdThemeBenchmark)
+
+#include "qtantdthemebenchmark.moc"
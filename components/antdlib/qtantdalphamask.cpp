@@ -0,0 +1,94 @@
+#include "qtantdalphamask_p.h"
+#include "qtantdrendercache_p.h"
+
+#include <QPainter>
+
+namespace QtAntdInternal {
+
+namespace {
+
+// Colored masks are small glyphs, spinner atlases and chrome; a few colors of
+// each on screen fit comfortably
+const int gTintCacheKb = 4096;
+
+// Multiplies each channel of a premultiplied pixel by alpha / 255
+inline QRgb scalePremultiplied(QRgb pixel, uint alpha)
+{
+    uint rb = (pixel & 0xff00ff) * alpha;
+    rb = (rb + ((rb >> 8) & 0xff00ff) + 0x800080) >> 8;
+    uint ag = ((pixel >> 8) & 0xff00ff) * alpha;
+    ag = ag + ((ag >> 8) & 0xff00ff) + 0x800080;
+    return (rb & 0xff00ff) | (ag & 0xff00ff00);
+}
+
+// Colors the source region of mask into a per-thread scratch buffer that is
+// reused across calls, placed at (0, 0)
+const QImage &tintIntoScratch(const QImage &mask, const QRect &source, const QColor &color)
+{
+    Q_ASSERT(mask.format() == QImage::Format_Alpha8);
+    Q_ASSERT(mask.rect().contains(source));
+
+    // Grows only, so uncached compositing does not allocate either
+    thread_local QImage scratch;
+    if (scratch.width() < source.width() || scratch.height() < source.height()) {
+        scratch = QImage(qMax(scratch.width(), source.width()),
+                         qMax(scratch.height(), source.height()),
+                         QImage::Format_ARGB32_Premultiplied);
+    }
+
+    const QRgb premultiplied = qPremultiply(color.rgba());
+    for (int y = 0; y < source.height(); ++y) {
+        const uchar *coverage = mask.constScanLine(source.y() + y) + source.x();
+        QRgb *out = reinterpret_cast<QRgb *>(scratch.scanLine(y));
+        for (int x = 0; x < source.width(); ++x) {
+            const uint alpha = coverage[x];
+            out[x] = alpha == 255 ? premultiplied
+                   : alpha == 0 ? 0
+                   : scalePremultiplied(premultiplied, alpha);
+        }
+    }
+    return scratch;
+}
+
+} // namespace
+
+QImage createAlphaMask(const QSize &size, qreal dpr)
+{
+    QImage mask(size * dpr, QImage::Format_Alpha8);
+    mask.setDevicePixelRatio(dpr);
+    mask.fill(0);
+    return mask;
+}
+
+const QImage &tintAlphaMask(const QImage &mask, const QColor &color)
+{
+    thread_local RenderCache<QImage> cache(gTintCacheKb);
+
+    // The cache key of a QImage changes whenever its pixels do, and is never
+    // reused by another image
+    const quint64 maskKey = quint64(mask.cacheKey());
+    RenderCacheKey key;
+    key.add(quint32(maskKey >> 32)).add(quint32(maskKey)).add(quint32(color.rgba()));
+    if (const QImage *cached = cache.find(key)) {
+        return *cached;
+    }
+
+    QImage tinted = tintIntoScratch(mask, mask.rect(), color).copy(mask.rect());
+    return *cache.insert(key, tinted, tinted.sizeInBytes());
+}
+
+void drawAlphaMask(QPainter *painter, const QRectF &target, const QImage &mask,
+                   const QRect &source, const QColor &color, TintCaching caching)
+{
+    if (source.isEmpty() || color.alpha() == 0) {
+        return;
+    }
+    if (caching == CacheTint) {
+        painter->drawImage(target, tintAlphaMask(mask, color), QRectF(source));
+        return;
+    }
+    const QImage &tinted = tintIntoScratch(mask, source, color);
+    painter->drawImage(target, tinted, QRectF(QPointF(0, 0), source.size()));
+}
+
+} // namespace QtAntdInternal
@@ -0,0 +1,40 @@
+#ifndef QtAntdAlphaMask_P_H
+#define QtAntdAlphaMask_P_H
+
+#include <QColor>
+#include <QImage>
+#include <QRect>
+
+class QPainter;
+
+namespace QtAntdInternal {
+
+// Shape coverage is cached as color-independent QImage::Format_Alpha8 masks keyed
+// only by geometry and device pixel ratio; the color is applied when compositing.
+// This keeps the number of cached surfaces independent of presets and states.
+
+// A cleared mask of the given logical size, ready to be painted into with any
+// opaque brush or pen (only coverage is kept).
+QImage createAlphaMask(const QSize &size, qreal dpr);
+
+// Whether a colored mask is kept for reuse. Masks that are drawn only once per
+// color (a fading or growing ripple) skip the cache so they do not evict others.
+enum TintCaching {
+    CacheTint,
+    DontCacheTint
+};
+
+// Colors a whole Alpha8 mask. Recent results are kept per thread in a small LRU
+// keyed by mask and color, so a steady-state paint only looks them up; the
+// result has the mask's pixel geometry and stays valid until the next call on
+// the same thread.
+const QImage &tintAlphaMask(const QImage &mask, const QColor &color);
+
+// Draws the source region (in mask pixels) of mask, colored with color, into
+// target. With CacheTint this is a cache lookup and a single blit.
+void drawAlphaMask(QPainter *painter, const QRectF &target, const QImage &mask,
+                   const QRect &source, const QColor &color, TintCaching caching = CacheTint);
+
+} // namespace QtAntdInternal
+
+#endif  // QtAntdAlphaMask_P_H
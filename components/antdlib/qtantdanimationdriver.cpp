@@ -0,0 +1,332 @@
+#include "qtantdanimationdriver_p.h"
+#include "qtantdinstrumentation_p.h"
+
+#include <QEvent>
+#include <QWidget>
+
+namespace QtAntdInternal {
+
+namespace {
+const int gFrameInterval = 16; // ms, ~60 FPS
+// ms between checks for shown owners that became covered or scrolled out of view
+const int gVisibilityInterval = 250;
+
+// Hidden widgets, hidden ancestors and minimized windows never reach the screen
+bool isOwnerHidden(const QWidget *owner)
+{
+    return !owner->isVisible() || owner->window()->isMinimized();
+}
+
+// QWidget::visibleRegion() clips against every later sibling, so this is only
+// called at the rates of owner events and gVisibilityInterval, never per frame
+bool isOwnerObscured(const QWidget *owner)
+{
+    return owner->visibleRegion().isEmpty();
+}
+}
+
+Animation::Animation(QWidget *owner)
+    : m_owner(owner)
+    , m_startTime(0)
+    , m_slot(-1)
+    , m_running(false)
+    , m_suspended(false)
+    , m_obscured(false)
+{
+}
+
+Animation::~Animation()
+{
+    stop();
+}
+
+void Animation::setTickFunction(TickFunction tick)
+{
+    m_tick = std::move(tick);
+}
+
+void Animation::start()
+{
+    AnimationDriver &driver = AnimationDriver::instance();
+    m_startTime = driver.now();
+    if (!m_running) {
+        m_running = true;
+        driver.registerAnimation(this);
+    }
+}
+
+void Animation::stop()
+{
+    if (m_running) {
+        m_running = false;
+        AnimationDriver::instance().unregisterAnimation(this);
+    }
+}
+
+qint64 Animation::elapsed() const
+{
+    return m_running ? AnimationDriver::instance().now() - m_startTime : 0;
+}
+
+AnimationDriver &AnimationDriver::instance()
+{
+    static AnimationDriver driver;
+    return driver;
+}
+
+AnimationDriver::AnimationDriver()
+    : QObject()
+    , m_activeCount(0)
+    , m_shownCount(0)
+    , m_ticking(false)
+    , m_hasClearedSlots(false)
+{
+    m_clock.start();
+    m_timer.setTimerType(Qt::PreciseTimer);
+    m_timer.setInterval(gFrameInterval);
+    connect(&m_timer, &QTimer::timeout, this, [this]() { tick(); });
+    m_visibilityTimer.setInterval(gVisibilityInterval);
+    connect(&m_visibilityTimer, &QTimer::timeout, this, [this]() { checkVisibility(); });
+}
+
+qint64 AnimationDriver::now() const
+{
+    return m_clock.elapsed();
+}
+
+void AnimationDriver::registerAnimation(Animation *animation)
+{
+    animation->m_slot = m_animations.size();
+    m_animations.append(animation);
+
+    if (QWidget *owner = animation->m_owner) {
+        // Show/Hide reach every visible descendant when an ancestor (a stacked
+        // page, the window being minimized or restored) changes, so filtering
+        // the owner alone is enough to know when it can reach the screen.
+        auto it = m_owners.find(owner);
+        if (it == m_owners.end()) {
+            owner->installEventFilter(this);
+            it = m_owners.insert(owner, OwnerState { 0, !isOwnerHidden(owner) && isOwnerObscured(owner) });
+        }
+        ++it->animations;
+        animation->m_suspended = isOwnerHidden(owner);
+        animation->m_obscured = it->obscured;
+    } else {
+        animation->m_suspended = false;
+        animation->m_obscured = false;
+    }
+    countAnimation(animation, 1);
+
+    updateTimer();
+}
+
+void AnimationDriver::unregisterAnimation(Animation *animation)
+{
+    const int slot = animation->m_slot;
+    if (slot < 0) {
+        return;
+    }
+    countAnimation(animation, -1);
+
+    // While ticking, only clear the slot so the loop's indices stay valid;
+    // compact() runs once every animation has been sampled.
+    if (m_ticking) {
+        m_animations[slot] = nullptr;
+        m_hasClearedSlots = true;
+    } else {
+        Animation *last = m_animations.last();
+        m_animations[slot] = last;
+        last->m_slot = slot;
+        m_animations.removeLast();
+    }
+    animation->m_slot = -1;
+
+    if (QWidget *owner = animation->m_owner) {
+        auto it = m_owners.find(owner);
+        if (it != m_owners.end() && --it->animations == 0) {
+            m_owners.erase(it);
+            owner->removeEventFilter(this);
+        }
+    }
+    animation->m_suspended = false;
+    animation->m_obscured = false;
+
+    updateTimer();
+}
+
+bool AnimationDriver::eventFilter(QObject *watched, QEvent *event)
+{
+    QWidget *owner = static_cast<QWidget *>(watched);
+    switch (event->type()) {
+    case QEvent::Hide:
+        setOwnerState(owner, true, false);
+        break;
+    case QEvent::Show:
+        if (!isOwnerHidden(owner)) {
+            setOwnerState(owner, false, isOwnerObscured(owner));
+        }
+        break;
+    case QEvent::Move:
+    case QEvent::Resize:
+        if (!isOwnerHidden(owner)) {
+            const bool obscured = isOwnerObscured(owner);
+            if (obscured != m_owners.value(owner).obscured) {
+                setOwnerState(owner, false, obscured);
+            }
+        }
+        break;
+    case QEvent::Paint:
+        // Painted, so at least part of the owner reached the screen again
+        if (m_owners.value(owner).obscured) {
+            setOwnerState(owner, false, false);
+        }
+        break;
+    default:
+        break;
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+/*!
+ * \internal
+ * Catches owners that were covered or scrolled out of view (or uncovered)
+ * without receiving an event of their own.
+ */
+void AnimationDriver::checkVisibility()
+{
+    QVector<QObject *> changed;
+    for (auto it = m_owners.cbegin(); it != m_owners.cend(); ++it) {
+        const QWidget *owner = static_cast<const QWidget *>(it.key());
+        if (!isOwnerHidden(owner) && isOwnerObscured(owner) != it->obscured) {
+            changed.append(it.key());
+        }
+    }
+    for (QObject *owner : changed) {
+        setOwnerState(owner, false, !m_owners.value(owner).obscured);
+    }
+}
+
+void AnimationDriver::setOwnerState(QObject *owner, bool suspended, bool obscured)
+{
+    const qint64 time = now();
+
+    auto it = m_owners.find(owner);
+    if (it != m_owners.end()) {
+        it->obscured = obscured;
+    }
+
+    // Catching up may finish (and unregister) animations, so keep indices stable
+    const bool wasTicking = m_ticking;
+    m_ticking = true;
+    const int count = m_animations.size();
+    for (int i = 0; i < count; ++i) {
+        Animation *animation = m_animations.at(i);
+        if (!animation || animation->m_owner != owner) {
+            continue;
+        }
+        const bool wasActive = !animation->isSuspended();
+        countAnimation(animation, -1);
+        animation->m_suspended = suspended;
+        animation->m_obscured = obscured;
+        countAnimation(animation, 1);
+        if (!wasActive && !animation->isSuspended()) {
+            // Catch up before the first paint after showing
+            sample(animation, time);
+        }
+    }
+    m_ticking = wasTicking;
+
+    if (!m_ticking) {
+        compact();
+    }
+    updateTimer();
+}
+
+void AnimationDriver::sample(Animation *animation, qint64 time)
+{
+    if (animation->m_tick) {
+        if (animation->m_owner) {
+            QTANTD_RECORD_ANIMATION_TICK(animation->m_owner);
+        }
+        animation->m_tick(time - animation->m_startTime);
+    }
+}
+
+void AnimationDriver::tick()
+{
+    const qint64 time = now();
+
+    m_ticking = true;
+    // Animations started from a tick callback are sampled from the next frame on
+    const int count = m_animations.size();
+    for (int i = 0; i < count; ++i) {
+        Animation *animation = m_animations.at(i);
+        if (!animation || animation->isSuspended()) {
+            continue;
+        }
+        sample(animation, time);
+    }
+    m_ticking = false;
+
+    compact();
+    updateTimer();
+}
+
+/*!
+ * \internal
+ * Keeps m_activeCount and m_shownCount in step with the state of animation,
+ * which is (delta 1) or was (delta -1) registered.
+ */
+void AnimationDriver::countAnimation(const Animation *animation, int delta)
+{
+    if (animation->m_suspended) {
+        return;
+    }
+    if (!animation->m_obscured) {
+        m_activeCount += delta;
+    }
+    if (animation->m_owner) {
+        m_shownCount += delta;
+    }
+}
+
+/*!
+ * \internal
+ * Drops the slots cleared while ticking.
+ */
+void AnimationDriver::compact()
+{
+    if (!m_hasClearedSlots) {
+        return;
+    }
+    int slot = 0;
+    for (int i = 0; i < m_animations.size(); ++i) {
+        Animation *animation = m_animations.at(i);
+        if (animation) {
+            animation->m_slot = slot;
+            m_animations[slot++] = animation;
+        }
+    }
+    m_animations.resize(slot);
+    m_hasClearedSlots = false;
+}
+
+void AnimationDriver::updateTimer()
+{
+    // Frames for sampled animations; visibility checks while an owner is shown
+    const bool active = m_activeCount > 0;
+    const bool shown = m_shownCount > 0;
+
+    if (active && !m_timer.isActive()) {
+        m_timer.start();
+    } else if (!active && m_timer.isActive()) {
+        m_timer.stop();
+    }
+    if (shown && !m_visibilityTimer.isActive()) {
+        m_visibilityTimer.start();
+    } else if (!shown && m_visibilityTimer.isActive()) {
+        m_visibilityTimer.stop();
+    }
+}
+
+} // namespace QtAntdInternal
@@ -0,0 +1,108 @@
+#ifndef QtAntdAnimationDriver_P_H
+#define QtAntdAnimationDriver_P_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QVector>
+#include <QHash>
+#include <functional>
+
+class QWidget;
+
+namespace QtAntdInternal {
+
+// One running QtAntd animation. Owned by the component that animates (usually
+// as a member of its private class); the shared driver samples it every frame
+// with the time elapsed since start(), so the result does not depend on how
+// often frames are actually delivered.
+//
+// While the owner widget is hidden (including a minimized window or a hidden
+// stacked page) the animation is suspended and not sampled at all. The same
+// holds while it is fully obscured (covered by siblings or scrolled out of
+// view), which is re-checked at a low rate and whenever the owner is shown,
+// moved, resized or painted. Since sampling is time-based, the first frame
+// after it becomes visible again catches up with the wall clock.
+class Animation
+{
+public:
+    // Called once per frame with the milliseconds elapsed since start()
+    using TickFunction = std::function<void(qint64 elapsedMs)>;
+
+    explicit Animation(QWidget *owner = nullptr);
+    ~Animation();
+
+    void setTickFunction(TickFunction tick);
+
+    void start();
+    void stop();
+
+    bool isRunning() const { return m_running; }
+    bool isSuspended() const { return m_suspended || m_obscured; }
+    qint64 elapsed() const;
+    QWidget *owner() const { return m_owner; }
+
+private:
+    Q_DISABLE_COPY(Animation)
+    friend class AnimationDriver;
+
+    QWidget *m_owner;
+    TickFunction m_tick;
+    qint64 m_startTime;
+    int m_slot; // Index in the driver's list while registered, else -1
+    bool m_running;
+    bool m_suspended; // Owner hidden
+    bool m_obscured;  // Owner shown, but with an empty visible region
+};
+
+// Process-wide animation clock. A single timer drives every registered
+// animation, and it only runs while at least one animation is not suspended.
+// A second, slow timer re-checks whether shown owners are obscured.
+class AnimationDriver : public QObject
+{
+public:
+    static AnimationDriver &instance();
+
+    // Milliseconds on the shared monotonic clock
+    qint64 now() const;
+
+    void registerAnimation(Animation *animation);
+    void unregisterAnimation(Animation *animation);
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private:
+    AnimationDriver();
+    Q_DISABLE_COPY(AnimationDriver)
+
+    void tick();
+    void sample(Animation *animation, qint64 time);
+    void checkVisibility();
+    void setOwnerState(QObject *owner, bool suspended, bool obscured);
+    void countAnimation(const Animation *animation, int delta);
+    void compact();
+    void updateTimer();
+
+    struct OwnerState
+    {
+        int animations; // Running animations the driver filters events for
+        bool obscured;
+    };
+
+    QTimer m_timer;
+    QTimer m_visibilityTimer;
+    QElapsedTimer m_clock;
+    // Unordered; unregistering moves the last animation into the freed slot,
+    // or only clears the slot while ticking (compact() removes it afterwards)
+    QVector<Animation *> m_animations;
+    QHash<QObject *, OwnerState> m_owners;
+    int m_activeCount; // Registered animations being sampled
+    int m_shownCount;  // Registered animations whose owner is shown
+    bool m_ticking;
+    bool m_hasClearedSlots;
+};
+
+} // namespace QtAntdInternal
+
+#endif  // QtAntdAnimationDriver_P_H
@@ -0,0 +1,127 @@
+#include "qtantdchrome_p.h"
+#include "qtantdalphamask_p.h"
+#include "qtantdninepatch_p.h"
+#include "qtantdrendercache_p.h"
+
+#include <QPainter>
+#include <QtMath>
+
+namespace QtAntdInternal {
+
+namespace {
+
+const int gChromeCacheKb = 1024;
+
+// Length of the patch along one axis: just enough for both corners plus a
+// stretchable straight segment, or the full length when it cannot be stretched.
+qreal patchLength(qreal length, qreal radius, bool stretchable)
+{
+    const qreal minimal = 2 * radius + 2;
+    return (stretchable && length > minimal) ? minimal : length;
+}
+
+// Margins around the one pixel wide stretched middle of an axis
+void axisMargins(int patchLength, qreal offset, qreal radius, bool stretched,
+                 int *leading, int *trailing)
+{
+    *leading = stretched ? qCeil(offset + radius) : patchLength / 2;
+    *trailing = patchLength - *leading - 1;
+}
+
+// Draws either the fill (borderWidth == 0) or the border of the chrome. Each layer
+// is cached as a coverage mask without its color.
+void drawChromeLayer(QPainter *painter,
+                     const QRectF &rect,
+                     qreal radius,
+                     const QColor &color,
+                     qreal borderWidth,
+                     Qt::PenStyle borderStyle)
+{
+    thread_local RenderCache<NinePatch> cache(gChromeCacheKb);
+
+    const bool border = borderWidth > 0;
+    const bool dashed = border && borderStyle != Qt::SolidLine;
+    const qreal dpr = painter->device()->devicePixelRatioF();
+
+    // Keep the rect's sub-pixel offset so antialiasing matches a direct draw
+    const int pad = qCeil(borderWidth / 2.0) + 1;
+    const qreal offsetX = pad + (rect.x() - qFloor(rect.x()));
+    const qreal offsetY = pad + (rect.y() - qFloor(rect.y()));
+    const qreal patchWidth = patchLength(rect.width(), radius, !dashed);
+    const qreal patchHeight = patchLength(rect.height(), radius, !dashed);
+    const int maskWidth = qCeil(offsetX + patchWidth) + pad;
+    const int maskHeight = qCeil(offsetY + patchHeight) + pad;
+
+    RenderCacheKey key;
+    key.add(radius)
+       .add(borderWidth)
+       .add(int(border ? borderStyle : Qt::NoPen))
+       .add(dpr)
+       .add(patchWidth)
+       .add(patchHeight)
+       .add(offsetX)
+       .add(offsetY);
+
+    const NinePatch *patch = cache.find(key);
+    if (!patch) {
+        NinePatch rendered;
+        rendered.mask = createAlphaMask(QSize(maskWidth, maskHeight), dpr);
+
+        QPainter p(&rendered.mask);
+        p.setRenderHint(QPainter::Antialiasing);
+        if (border) {
+            QPen pen(Qt::black, borderWidth);
+            pen.setStyle(borderStyle);
+            p.setPen(pen);
+            p.setBrush(Qt::NoBrush);
+        } else {
+            p.setPen(Qt::NoPen);
+            p.setBrush(Qt::black);
+        }
+        p.drawRoundedRect(QRectF(offsetX, offsetY, patchWidth, patchHeight), radius, radius);
+        p.end();
+
+        int left, right, top, bottom;
+        axisMargins(maskWidth, offsetX, radius, patchWidth < rect.width(), &left, &right);
+        axisMargins(maskHeight, offsetY, radius, patchHeight < rect.height(), &top, &bottom);
+        rendered.margins = QMargins(left, top, right, bottom);
+
+        patch = cache.insert(key, rendered, rendered.mask.sizeInBytes());
+    }
+
+    const QRectF target(rect.x() - offsetX,
+                        rect.y() - offsetY,
+                        rect.width() + maskWidth - patchWidth,
+                        rect.height() + maskHeight - patchHeight);
+    drawNinePatch(painter, target, *patch, color);
+}
+
+} // namespace
+
+void drawChrome(QPainter *painter,
+                const QRectF &rect,
+                qreal radius,
+                const QColor &fill,
+                const QColor &border,
+                qreal borderWidth,
+                Qt::PenStyle borderStyle)
+{
+    const bool hasFill = fill.isValid() && fill.alpha() > 0;
+    const bool hasBorder = border.isValid() && border.alpha() > 0 && borderWidth > 0;
+    if ((!hasFill && !hasBorder) || rect.isEmpty()) {
+        return;
+    }
+
+    // QPainter clamps the radius the same way
+    radius = qBound<qreal>(0, radius, qMin(rect.width(), rect.height()) / 2.0);
+
+    // Stroking over the fill composites exactly like a single drawRoundedRect
+    if (hasFill) {
+        drawChromeLayer(painter, rect, radius, fill, 0, Qt::NoPen);
+    }
+    if (hasBorder) {
+        drawChromeLayer(painter, rect, radius, border, borderWidth, borderStyle);
+    }
+}
+
+} // namespace QtAntdInternal
@@ -0,0 +1,30 @@
+#ifndef QtAntdChrome_P_H
+#define QtAntdChrome_P_H
+
+#include <QColor>
+#include <QRectF>
+
+class QPainter;
+
+namespace QtAntdInternal {
+
+// Draws the rounded-rect chrome shared by all components: an antialiased fill
+// and/or border, equivalent to drawRoundedRect(rect, radius, radius) with the
+// given brush and pen. Pass an invalid or transparent color to skip fill or border.
+//
+// Fill and border coverage are each rendered once per (radius, border width, dash
+// style, device pixel ratio, sub-pixel offset) into a small nine-patch alpha mask
+// whose corners are kept and whose edges are stretched, so resizing never
+// re-tessellates the shape; colors are applied when compositing. Dashed borders
+// cannot be stretched and are cached at their full size instead.
+void drawChrome(QPainter *painter,
+                const QRectF &rect,
+                qreal radius,
+                const QColor &fill,
+                const QColor &border = QColor(),
+                qreal borderWidth = 0,
+                Qt::PenStyle borderStyle = Qt::SolidLine);
+
+} // namespace QtAntdInternal
+
+#endif  // QtAntdChrome_P_H
@@ -0,0 +1,48 @@
+#ifndef QtAntdColorCache_P_H
+#define QtAntdColorCache_P_H
+
+#include <QtGlobal>
+#include "qtantdstyle.h"
+
+namespace QtAntdInternal {
+
+// Per-widget cache of resolved colors, one slot per component state.
+// A slot is recomputed only when the theme generation moved on since it was filled,
+// or after invalidate() (used when a property that feeds the resolver changes).
+template <typename Colors, int StateCount>
+class ResolvedColorCache
+{
+public:
+    template <typename Resolver>
+    const Colors &get(int state, Resolver resolve)
+    {
+        Q_ASSERT(state >= 0 && state < StateCount);
+
+        const quint64 generation = QtAntdStyle::instance().themeGeneration();
+        Entry &entry = m_entries[state];
+        if (entry.generation != generation) {
+            entry.colors = resolve();
+            entry.generation = generation;
+        }
+        return entry.colors;
+    }
+
+    void invalidate()
+    {
+        for (Entry &entry : m_entries) {
+            entry.generation = 0; // Theme generations start at 1
+        }
+    }
+
+private:
+    struct Entry {
+        Colors colors;
+        quint64 generation { 0 };
+    };
+
+    Entry m_entries[StateCount];
+};
+
+} // namespace QtAntdInternal
+
+#endif  // QtAntdColorCache_P_H
@@ -0,0 +1,173 @@
+#include "qtantddelegateinteraction_p.h"
+#include "qtantdthemeregistry_p.h"
+#include "qtantdinstrumentation_p.h"
+
+#include <QAbstractItemView>
+#include <QApplication>
+#include <QMouseEvent>
+#include <QStyle>
+#include <QStyleOptionViewItem>
+
+namespace QtAntdInternal {
+
+DelegateInteraction::DelegateInteraction(HitRectFunction hitRect)
+    : QObject()
+    , m_hitRect(std::move(hitRect))
+{
+}
+
+DelegateInteraction::~DelegateInteraction()
+{
+    for (QObject *viewport : m_viewports) {
+        viewport->removeEventFilter(this);
+    }
+}
+
+void DelegateInteraction::watch(const QWidget *widget)
+{
+    const QAbstractItemView *view = qobject_cast<const QAbstractItemView *>(widget);
+    if (!view) {
+        return;
+    }
+
+    QWidget *viewport = view->viewport();
+    if (m_viewports.contains(viewport)) {
+        return;
+    }
+
+    m_viewports.insert(viewport);
+    viewport->setMouseTracking(true);
+    viewport->installEventFilter(this);
+    connect(viewport, &QObject::destroyed, this, [this, viewport]() {
+        m_viewports.remove(viewport);
+    });
+
+    // The registry outlives every delegate, so it owns the unregistration
+    ThemeRegistry &registry = ThemeRegistry::instance();
+    registry.registerWidget(viewport);
+    connect(viewport, &QObject::destroyed, &registry, [viewport]() {
+        ThemeRegistry::instance().unregisterWidget(viewport);
+    });
+}
+
+bool DelegateInteraction::isHovered(const QWidget *view, const QModelIndex &index) const
+{
+    return m_hovered.isValid() && m_hovered == index && m_hoveredView.data() == view;
+}
+
+bool DelegateInteraction::isDown(const QWidget *view, const QModelIndex &index) const
+{
+    return m_pressed.isValid() && m_pressed == index && m_pressedView.data() == view && isHovered(view, index);
+}
+
+DelegateInteraction::MouseResult DelegateInteraction::mouseEvent(QEvent *event,
+                                                                 const QStyleOptionViewItem &option,
+                                                                 const QModelIndex &index)
+{
+    switch (event->type()) {
+    case QEvent::MouseButtonPress:
+    case QEvent::MouseButtonDblClick: {
+        QMouseEvent *mouseEvent = static_cast<QMouseEvent *>(event);
+        if (mouseEvent->button() != Qt::LeftButton || !m_hitRect(option.widget, option.rect, index).contains(mouseEvent->pos())) {
+            return Ignored;
+        }
+        clearPressed();
+        m_pressed = index;
+        m_pressedView = qobject_cast<const QAbstractItemView *>(option.widget);
+        updateIndex(m_pressedView, index);
+        return Consumed;
+    }
+    case QEvent::MouseButtonRelease: {
+        QMouseEvent *mouseEvent = static_cast<QMouseEvent *>(event);
+        if (mouseEvent->button() != Qt::LeftButton || !m_pressed.isValid() || m_pressed != index) {
+            return Ignored;
+        }
+        clearPressed();
+        return m_hitRect(option.widget, option.rect, index).contains(mouseEvent->pos()) ? Clicked : Consumed;
+    }
+    default:
+        return Ignored;
+    }
+}
+
+bool DelegateInteraction::eventFilter(QObject *watched, QEvent *event)
+{
+    QAbstractItemView *view = qobject_cast<QAbstractItemView *>(watched->parent());
+    if (!view) {
+        return false;
+    }
+
+    switch (event->type()) {
+    case QEvent::MouseMove: {
+        const QPoint pos = static_cast<QMouseEvent *>(event)->pos();
+        const QModelIndex index = view->indexAt(pos);
+        const bool inside = index.isValid() && m_hitRect(view, view->visualRect(index), index).contains(pos);
+        setHovered(view, inside ? index : QModelIndex());
+        break;
+    }
+    case QEvent::MouseButtonRelease:
+        // A release over another cell never reaches mouseEvent() for the pressed one
+        if (m_pressed.isValid() && view->indexAt(static_cast<QMouseEvent *>(event)->pos()) != m_pressed) {
+            clearPressed();
+        }
+        break;
+    case QEvent::Leave:
+    case QEvent::Hide:
+        if (m_hoveredView.data() == view) {
+            setHovered(view, QModelIndex());
+        }
+        break;
+    default:
+        break;
+    }
+    return false;
+}
+
+void DelegateInteraction::updateViews()
+{
+    for (QObject *viewport : m_viewports) {
+        requestUpdate(static_cast<QWidget *>(viewport));
+    }
+}
+
+void DelegateInteraction::setHovered(const QAbstractItemView *view, const QModelIndex &index)
+{
+    if (m_hovered == index && (!index.isValid() || m_hoveredView.data() == view)) {
+        return;
+    }
+
+    updateIndex(m_hoveredView, m_hovered);
+    m_hovered = index;
+    m_hoveredView = index.isValid() ? view : nullptr;
+    updateIndex(view, index);
+}
+
+void DelegateInteraction::clearPressed()
+{
+    const QModelIndex previous = m_pressed;
+    m_pressed = QPersistentModelIndex();
+    updateIndex(m_pressedView, previous);
+    m_pressedView = nullptr;
+}
+
+void DelegateInteraction::updateIndex(const QAbstractItemView *view, const QModelIndex &index)
+{
+    if (view && index.isValid()) {
+        requestUpdate(view->viewport(), view->visualRect(index));
+    }
+}
+
+void drawItemPanel(QPainter *painter, QStyleOptionViewItem option)
+{
+    option.text.clear();
+    option.icon = QIcon();
+    option.features &= ~(QStyleOptionViewItem::HasDisplay
+                         | QStyleOptionViewItem::HasDecoration
+                         | QStyleOptionViewItem::HasCheckIndicator);
+
+    const QWidget *widget = option.widget;
+    QStyle *style = widget ? widget->style() : QApplication::style();
+    style->drawControl(QStyle::CE_ItemViewItem, &option, painter, widget);
+}
+
+} // namespace QtAntdInternal
@@ -0,0 +1,85 @@
+#ifndef QtAntdDelegateInteraction_P_H
+#define QtAntdDelegateInteraction_P_H
+
+#include <QObject>
+#include <QPersistentModelIndex>
+#include <QPointer>
+#include <QRect>
+#include <QSet>
+#include <functional>
+
+class QAbstractItemView;
+class QEvent;
+class QPainter;
+class QStyleOptionViewItem;
+class QWidget;
+
+namespace QtAntdInternal {
+
+// Hover and press state of the component an item delegate paints in each cell.
+//
+// Only the component's hit rect inside a cell reacts, as a widget would: the
+// delegate provides it through HitRectFunction. Hover is tracked with an event
+// filter on the viewport of every view the delegate paints into (mouse tracking
+// is turned on for it); presses arrive through QAbstractItemDelegate::editorEvent()
+// and are forwarded to mouseEvent(). Only the cells whose state changes are
+// repainted.
+//
+// Watched viewports are also registered with the ThemeRegistry so a theme change
+// repaints the cells.
+class DelegateInteraction : public QObject
+{
+public:
+    // Area of the component of index in view, whose cell is at cellRect in
+    // viewport coordinates
+    using HitRectFunction =
+        std::function<QRect(const QWidget *view, const QRect &cellRect, const QModelIndex &index)>;
+
+    enum MouseResult {
+        Ignored,  // Not on the component; let the view handle the event
+        Consumed, // Press or release on the component
+        Clicked   // Release on the component that was pressed
+    };
+
+    explicit DelegateInteraction(HitRectFunction hitRect);
+    ~DelegateInteraction();
+
+    // widget is QStyleOptionViewItem::widget, i.e. the view being painted
+    void watch(const QWidget *widget);
+
+    // Whether the pointer is over the component of index in view
+    bool isHovered(const QWidget *view, const QModelIndex &index) const;
+    // Pressed, and the pointer is still over the component
+    bool isDown(const QWidget *view, const QModelIndex &index) const;
+
+    MouseResult mouseEvent(QEvent *event, const QStyleOptionViewItem &option, const QModelIndex &index);
+
+    // Repaints every watched view, after a property of the delegate changed
+    void updateViews();
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private:
+    Q_DISABLE_COPY(DelegateInteraction)
+
+    void setHovered(const QAbstractItemView *view, const QModelIndex &index);
+    void clearPressed();
+    static void updateIndex(const QAbstractItemView *view, const QModelIndex &index);
+
+    HitRectFunction m_hitRect;
+    QSet<QObject *> m_viewports;
+    QPersistentModelIndex m_hovered;
+    QPointer<const QAbstractItemView> m_hoveredView;
+    QPersistentModelIndex m_pressed;
+    QPointer<const QAbstractItemView> m_pressedView;
+};
+
+// Draws the background, selection and focus rect of a view item, leaving out its
+// text, icon and check indicator so a component can be painted on top. option
+// must already be initialized with QStyledItemDelegate::initStyleOption().
+void drawItemPanel(QPainter *painter, QStyleOptionViewItem option);
+
+} // namespace QtAntdInternal
+
+#endif  // QtAntdDelegateInteraction_P_H
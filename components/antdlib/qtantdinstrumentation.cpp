@@ -0,0 +1,245 @@
+#include "../include/qtantd/lib/qtantdinstrumentation.h"
+#include "qtantdinstrumentation_p.h"
+
+#include <QLoggingCategory>
+#include <QMetaObject>
+#include <algorithm>
+
+Q_LOGGING_CATEGORY(lcQtAntdPaint, "qtantd.paint", QtInfoMsg)
+
+namespace {
+
+QtAntdPaintStats toStats(const QMetaObject *metaObject,
+                         const QtAntdInstrumentationPrivate::Counters &counters)
+{
+    QtAntdPaintStats stats;
+    stats.className = QString::fromLatin1(metaObject->className());
+    stats.paintCount = counters.paintCount;
+    stats.totalPaintNs = counters.totalPaintNs;
+    stats.maxPaintNs = counters.maxPaintNs;
+    stats.updateCount = counters.updateCount;
+    stats.animationTickCount = counters.animationTickCount;
+    return stats;
+}
+
+void sortByPaintTime(QList<QtAntdPaintStats> *list)
+{
+    std::sort(list->begin(), list->end(), [](const QtAntdPaintStats &a, const QtAntdPaintStats &b) {
+        return a.totalPaintNs > b.totalPaintNs;
+    });
+}
+
+QString formatStats(const QtAntdPaintStats &stats)
+{
+    const qreal averageUs = stats.paintCount ? stats.totalPaintNs / 1000.0 / stats.paintCount : 0.0;
+    return QString::fromLatin1("paints %1, total %2 ms, avg %3 us, max %4 us, updates %5, ticks %6")
+        .arg(stats.paintCount)
+        .arg(stats.totalPaintNs / 1e6, 0, 'f', 3)
+        .arg(averageUs, 0, 'f', 1)
+        .arg(stats.maxPaintNs / 1000.0, 0, 'f', 1)
+        .arg(stats.updateCount)
+        .arg(stats.animationTickCount);
+}
+
+} // namespace
+
+/*!
+ *  @class QtAntdInstrumentationPrivate
+ *  @internal
+ */
+
+QtAntdInstrumentationPrivate::QtAntdInstrumentationPrivate(QtAntdInstrumentation *q)
+    : q_ptr(q)
+    , enabled(false)
+{
+#ifdef QTANTD_PAINT_INSTRUMENTATION
+    enabled = qEnvironmentVariableIntValue("QTANTD_PAINT_INSTRUMENTATION") != 0;
+#endif
+}
+
+QtAntdInstrumentationPrivate::~QtAntdInstrumentationPrivate() {}
+
+QtAntdInstrumentationPrivate *QtAntdInstrumentationPrivate::get()
+{
+    return QtAntdInstrumentation::instance().d_func();
+}
+
+void QtAntdInstrumentationPrivate::counters(const QWidget *widget,
+                                            Counters **classCounters,
+                                            Counters **instanceCounters)
+{
+    auto it = instances.find(widget);
+    if (it == instances.end()) {
+        Instance instance;
+        instance.metaObject = widget->metaObject();
+        it = instances.insert(widget, instance);
+
+        // Statistics of an instance go away with it; class totals are kept
+        if (!watched.contains(widget)) {
+            watched.insert(widget);
+            QObject::connect(widget, &QObject::destroyed, &context, [this, widget]() {
+                instances.remove(widget);
+                watched.remove(widget);
+            });
+        }
+    }
+
+    *classCounters = &classes[it->metaObject];
+    *instanceCounters = &it->counters;
+}
+
+/*!
+ *  @class QtAntdInstrumentation
+ */
+
+QtAntdInstrumentation &QtAntdInstrumentation::instance()
+{
+    static QtAntdInstrumentation instance;
+    return instance;
+}
+
+QtAntdInstrumentation::~QtAntdInstrumentation() {}
+
+bool QtAntdInstrumentation::isAvailable() const
+{
+#ifdef QTANTD_PAINT_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+void QtAntdInstrumentation::setEnabled(bool enabled)
+{
+    Q_D(QtAntdInstrumentation);
+
+    d->enabled = enabled && isAvailable();
+}
+
+bool QtAntdInstrumentation::isEnabled() const
+{
+    Q_D(const QtAntdInstrumentation);
+
+    return d->enabled;
+}
+
+void QtAntdInstrumentation::reset()
+{
+    Q_D(QtAntdInstrumentation);
+
+    d->classes.clear();
+    d->instances.clear();
+}
+
+QList<QtAntdPaintStats> QtAntdInstrumentation::classStats() const
+{
+    Q_D(const QtAntdInstrumentation);
+
+    QList<QtAntdPaintStats> list;
+    for (auto it = d->classes.cbegin(); it != d->classes.cend(); ++it) {
+        list.append(toStats(it.key(), it.value()));
+    }
+    sortByPaintTime(&list);
+    return list;
+}
+
+QList<QtAntdPaintStats> QtAntdInstrumentation::instanceStats() const
+{
+    Q_D(const QtAntdInstrumentation);
+
+    QList<QtAntdPaintStats> list;
+    for (auto it = d->instances.cbegin(); it != d->instances.cend(); ++it) {
+        QtAntdPaintStats stats = toStats(it->metaObject, it->counters);
+        stats.widget = it.key();
+        stats.objectName = it.key()->objectName();
+        list.append(stats);
+    }
+    sortByPaintTime(&list);
+    return list;
+}
+
+QtAntdPaintStats QtAntdInstrumentation::stats(const QWidget *widget) const
+{
+    Q_D(const QtAntdInstrumentation);
+
+    const auto it = d->instances.constFind(widget);
+    if (it == d->instances.cend()) {
+        return QtAntdPaintStats();
+    }
+
+    QtAntdPaintStats stats = toStats(it->metaObject, it->counters);
+    stats.widget = widget;
+    stats.objectName = widget->objectName();
+    return stats;
+}
+
+void QtAntdInstrumentation::dump() const
+{
+    if (!isAvailable()) {
+        qCInfo(lcQtAntdPaint) << "Paint instrumentation is not compiled in"
+                              << "(configure with QTANTD_ENABLE_PAINT_INSTRUMENTATION=ON)";
+        return;
+    }
+
+    const QList<QtAntdPaintStats> classes = classStats();
+    qCInfo(lcQtAntdPaint).noquote() << "Paint statistics per class:";
+    for (const QtAntdPaintStats &stats : classes) {
+        qCInfo(lcQtAntdPaint).noquote() << "  " << stats.className << formatStats(stats);
+    }
+
+    const QList<QtAntdPaintStats> instances = instanceStats();
+    qCInfo(lcQtAntdPaint).noquote() << "Paint statistics per instance:";
+    for (const QtAntdPaintStats &stats : instances) {
+        const QString name = stats.objectName.isEmpty()
+                                 ? QString::fromLatin1("0x%1").arg(quintptr(stats.widget), 0, 16)
+                                 : stats.objectName;
+        qCInfo(lcQtAntdPaint).noquote() << "  " << stats.className << name << formatStats(stats);
+    }
+}
+
+QtAntdInstrumentation::QtAntdInstrumentation()
+    : d_ptr(new QtAntdInstrumentationPrivate(this))
+{
+}
+
+namespace QtAntdInternal {
+
+bool isPaintInstrumentationEnabled()
+{
+    return QtAntdInstrumentation::instance().isEnabled();
+}
+
+void recordPaint(const QWidget *widget, qint64 nsecs)
+{
+    QtAntdInstrumentationPrivate::Counters *classCounters;
+    QtAntdInstrumentationPrivate::Counters *instanceCounters;
+    QtAntdInstrumentationPrivate::get()->counters(widget, &classCounters, &instanceCounters);
+
+    for (QtAntdInstrumentationPrivate::Counters *counters : { classCounters, instanceCounters }) {
+        ++counters->paintCount;
+        counters->totalPaintNs += nsecs;
+        counters->maxPaintNs = qMax(counters->maxPaintNs, nsecs);
+    }
+}
+
+void recordUpdate(const QWidget *widget)
+{
+    QtAntdInstrumentationPrivate::Counters *classCounters;
+    QtAntdInstrumentationPrivate::Counters *instanceCounters;
+    QtAntdInstrumentationPrivate::get()->counters(widget, &classCounters, &instanceCounters);
+
+    ++classCounters->updateCount;
+    ++instanceCounters->updateCount;
+}
+
+void recordAnimationTick(const QWidget *widget)
+{
+    QtAntdInstrumentationPrivate::Counters *classCounters;
+    QtAntdInstrumentationPrivate::Counters *instanceCounters;
+    QtAntdInstrumentationPrivate::get()->counters(widget, &classCounters, &instanceCounters);
+
+    ++classCounters->animationTickCount;
+    ++instanceCounters->animationTickCount;
+}
+
+} // namespace QtAntdInternal
@@ -0,0 +1,120 @@
+#ifndef QtAntdInstrumentation_P_H
+#define QtAntdInstrumentation_P_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QWidget>
+
+class QtAntdInstrumentation;
+
+class QtAntdInstrumentationPrivate
+{
+    Q_DISABLE_COPY(QtAntdInstrumentationPrivate)
+    Q_DECLARE_PUBLIC(QtAntdInstrumentation)
+
+public:
+    struct Counters
+    {
+        quint64 paintCount = 0;
+        qint64 totalPaintNs = 0;
+        qint64 maxPaintNs = 0;
+        quint64 updateCount = 0;
+        quint64 animationTickCount = 0;
+    };
+
+    struct Instance
+    {
+        const QMetaObject *metaObject = nullptr;
+        Counters counters;
+    };
+
+    QtAntdInstrumentationPrivate(QtAntdInstrumentation *q);
+    ~QtAntdInstrumentationPrivate();
+
+    static QtAntdInstrumentationPrivate *get();
+
+    // Both the class and the instance entry of widget, created on first use
+    void counters(const QWidget *widget, Counters **classCounters, Counters **instanceCounters);
+
+    QtAntdInstrumentation *const q_ptr;
+    bool enabled;
+    // Keyed by meta object so recording never builds a class name string
+    QHash<const QMetaObject *, Counters> classes;
+    QHash<const QWidget *, Instance> instances;
+    // Widgets whose destroyed() signal is already connected; survives reset()
+    QSet<const QWidget *> watched;
+    QObject context;
+};
+
+namespace QtAntdInternal {
+
+bool isPaintInstrumentationEnabled();
+
+void recordPaint(const QWidget *widget, qint64 nsecs);
+void recordUpdate(const QWidget *widget);
+void recordAnimationTick(const QWidget *widget);
+
+// Times the enclosing paintEvent() while instrumentation is enabled
+class PaintScope
+{
+public:
+    explicit PaintScope(const QWidget *widget)
+        : m_widget(isPaintInstrumentationEnabled() ? widget : nullptr)
+    {
+        if (m_widget) {
+            m_timer.start();
+        }
+    }
+
+    ~PaintScope()
+    {
+        if (m_widget) {
+            recordPaint(m_widget, m_timer.nsecsElapsed());
+        }
+    }
+
+private:
+    Q_DISABLE_COPY(PaintScope)
+
+    const QWidget *m_widget;
+    QElapsedTimer m_timer;
+};
+
+// update() that is counted by the paint instrumentation
+inline void requestUpdate(QWidget *widget)
+{
+#ifdef QTANTD_PAINT_INSTRUMENTATION
+    if (isPaintInstrumentationEnabled()) {
+        recordUpdate(widget);
+    }
+#endif
+    widget->update();
+}
+
+inline void requestUpdate(QWidget *widget, const QRect &rect)
+{
+#ifdef QTANTD_PAINT_INSTRUMENTATION
+    if (isPaintInstrumentationEnabled()) {
+        recordUpdate(widget);
+    }
+#endif
+    widget->update(rect);
+}
+
+} // namespace QtAntdInternal
+
+#ifdef QTANTD_PAINT_INSTRUMENTATION
+#define QTANTD_PAINT_SCOPE(widget) QtAntdInternal::PaintScope qtAntdPaintScope(widget)
+#define QTANTD_RECORD_ANIMATION_TICK(widget)                 \
+    do {                                                     \
+        if (QtAntdInternal::isPaintInstrumentationEnabled()) \
+            QtAntdInternal::recordAnimationTick(widget);     \
+    } while (false)
+#else
+#define QTANTD_PAINT_SCOPE(widget) do {} while (false)
+#define QTANTD_RECORD_ANIMATION_TICK(widget) do {} while (false)
+#endif
+
+#endif  // QtAntdInstrumentation_P_H
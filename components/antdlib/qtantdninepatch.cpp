@@ -0,0 +1,45 @@
+#include "qtantdninepatch_p.h"
+#include "qtantdalphamask_p.h"
+
+#include <QPainter>
+
+namespace QtAntdInternal {
+
+void drawNinePatch(QPainter *painter, const QRectF &target, const NinePatch &patch, const QColor &color)
+{
+    const QImage &mask = patch.mask;
+    if (mask.isNull() || target.isEmpty() || color.alpha() == 0) {
+        return;
+    }
+
+    // Colored once per color and reused by every later paint
+    const QImage &image = tintAlphaMask(mask, color);
+
+    const qreal dpr = mask.devicePixelRatio();
+    const QMargins &m = patch.margins;
+
+    // Corners never overlap when the target is smaller than the patch margins
+    const qreal left = qMin<qreal>(m.left(), target.width() / 2.0);
+    const qreal right = qMin<qreal>(m.right(), target.width() / 2.0);
+    const qreal top = qMin<qreal>(m.top(), target.height() / 2.0);
+    const qreal bottom = qMin<qreal>(m.bottom(), target.height() / 2.0);
+
+    // Column/row edges in target (logical) and source (device pixel) space
+    const qreal tx[4] = { target.left(), target.left() + left, target.right() - right, target.right() };
+    const qreal ty[4] = { target.top(), target.top() + top, target.bottom() - bottom, target.bottom() };
+    const qreal sx[4] = { 0, m.left() * dpr, mask.width() - m.right() * dpr, qreal(mask.width()) };
+    const qreal sy[4] = { 0, m.top() * dpr, mask.height() - m.bottom() * dpr, qreal(mask.height()) };
+
+    for (int row = 0; row < 3; ++row) {
+        for (int column = 0; column < 3; ++column) {
+            const QRectF targetRect(QPointF(tx[column], ty[row]), QPointF(tx[column + 1], ty[row + 1]));
+            const QRectF sourceRect(QPointF(sx[column], sy[row]), QPointF(sx[column + 1], sy[row + 1]));
+            if (targetRect.isEmpty() || sourceRect.isEmpty()) {
+                continue;
+            }
+            painter->drawImage(targetRect, image, sourceRect);
+        }
+    }
+}
+
+} // namespace QtAntdInternal
@@ -0,0 +1,30 @@
+#ifndef QtAntdNinePatch_P_H
+#define QtAntdNinePatch_P_H
+
+#include <QColor>
+#include <QImage>
+#include <QMargins>
+#include <QRectF>
+
+class QPainter;
+
+namespace QtAntdInternal {
+
+// A small pre-rendered coverage mask whose corners are drawn unscaled and whose
+// edges and center are stretched to fill the target, so one rendering serves
+// every size. The mask is QImage::Format_Alpha8 and carries its device pixel
+// ratio; margins are in logical pixels.
+struct NinePatch
+{
+    QImage mask;
+    QMargins margins;
+};
+
+// Draws patch colored with color and stretched over target. Source rects are
+// computed in the mask's device pixels so corners stay pixel-exact at any
+// device pixel ratio.
+void drawNinePatch(QPainter *painter, const QRectF &target, const NinePatch &patch, const QColor &color);
+
+} // namespace QtAntdInternal
+
+#endif  // QtAntdNinePatch_P_H
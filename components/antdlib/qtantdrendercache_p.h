@@ -0,0 +1,87 @@
+#ifndef QtAntdRenderCache_P_H
+#define QtAntdRenderCache_P_H
+
+#include <QtGlobal>
+#include <QCache>
+#include <QHash>
+#include <cstring>
+
+namespace QtAntdInternal {
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+using HashValue = size_t;
+#else
+using HashValue = uint;
+#endif
+
+// Small fixed-size key for render caches: a handful of integers describing what
+// was rendered (geometry, colors, device pixel ratio, ...). Building one never
+// allocates, so cache lookups are cheap enough for every paint.
+class RenderCacheKey
+{
+public:
+    enum { Capacity = 10 };
+
+    RenderCacheKey() : m_size(0) { std::memset(m_data, 0, sizeof(m_data)); }
+
+    RenderCacheKey &add(quint32 value)
+    {
+        Q_ASSERT(m_size < Capacity);
+        m_data[m_size++] = value;
+        return *this;
+    }
+    RenderCacheKey &add(int value) { return add(quint32(value)); }
+    RenderCacheKey &add(bool value) { return add(quint32(value ? 1 : 0)); }
+    // Real values (device pixel ratios, pen widths) are keyed at 1/100 precision
+    RenderCacheKey &add(qreal value) { return add(quint32(qRound(value * 100))); }
+
+    bool operator==(const RenderCacheKey &other) const
+    {
+        return m_size == other.m_size && std::memcmp(m_data, other.m_data, sizeof(m_data)) == 0;
+    }
+
+    friend HashValue qHash(const RenderCacheKey &key, HashValue seed = 0)
+    {
+        return qHashBits(key.m_data, sizeof(key.m_data), seed);
+    }
+
+private:
+    quint32 m_data[Capacity];
+    int m_size;
+};
+
+// Least-recently-used cache of rendered artifacts (pixmaps, images), bounded by
+// their memory footprint in kilobytes.
+//
+// Not thread-safe: the static paint() functions may run on worker threads (e.g.
+// rendering into a QImage), so caches they use are thread_local.
+template <typename T>
+class RenderCache
+{
+public:
+    explicit RenderCache(int maxCostKb) { m_cache.setMaxCost(maxCostKb); }
+
+    const T *find(const RenderCacheKey &key) const { return m_cache.object(key); }
+
+    // Stores a copy of value and returns it. An artifact larger than the whole
+    // cache is not kept; it is returned anyway and stays valid until the next insert.
+    const T *insert(const RenderCacheKey &key, const T &value, qint64 bytes)
+    {
+        T *copy = new T(value);
+        if (m_cache.insert(key, copy, int(bytes / 1024) + 1)) {
+            return copy;
+        }
+        m_uncached = value;
+        return &m_uncached;
+    }
+
+    void clear() { m_cache.clear(); }
+
+private:
+    QCache<RenderCacheKey, T> m_cache;
+    T m_uncached;
+};
+
+} // namespace QtAntdInternal
+
+#endif  // QtAntdRenderCache_P_H
@@ -1,97 +1,210 @@
 #include "qtantdrippleoverlay_p.h"
+#include "qtantdanimationdriver_p.h"
+#include "qtantdrendercache_p.h"
+#include "qtantdalphamask_p.h"
+#include "qtantdinstrumentation_p.h"
 
+#include <QHash>
 #include <QPainter>
-#include <QPainterPath>
-#include <QElapsedTimer>
-#include <QTimer>
+#include <QVector>
 #include <QtGlobal>
+#include <QtMath>
+#include <algorithm>
 #include <cmath>
 
 namespace QtAntdInternal {
 
+namespace {
+
+struct Ripple
+{
+    QRectF innerRect; // In window coordinates
+    int cornerRadius;
+    bool isCircle;
+    QColor color;
+    int extra;
+    int duration;
+    qint64 startTime; // On the animation driver clock
+};
+
+// Ripples rarely overlap by more than a handful, even with rapid clicking
+const int gReservedRipples = 8;
+
+// Ring thickness is quantized so consecutive frames and clicks share cached rings
+const int gGrowStepsPerPixel = 4;
+const int gRingCacheKb = 1024;
+
+} // namespace
+
+// One transparent overlay per top-level window. It is created on the first ripple,
+// reused for every later one and only hidden (never deleted) when idle, so a click
+// only appends a record to a preallocated list.
 class RippleOverlayWidget : public QWidget {
+    Q_OBJECT
+
 public:
-    RippleOverlayWidget(QWidget* parent,
-                        const QRect& innerRectInOverlay,
-                        int cornerRadius,
-                        bool isCircle,
-                        const QColor& color,
-                        int extraPixels,
-                        int durationMs)
-        : QWidget(parent)
-        , m_innerRect(innerRectInOverlay)
-        , m_cornerRadius(cornerRadius)
-        , m_isCircle(isCircle)
-        , m_color(color)
-        , m_extra(extraPixels)
-        , m_duration(durationMs)
+    static RippleOverlayWidget *forWindow(QWidget *window)
     {
-        setAttribute(Qt::WA_TransparentForMouseEvents, true);
-        setAttribute(Qt::WA_NoSystemBackground, true);
-        setAttribute(Qt::WA_TranslucentBackground, true);
-        m_timer = new QTimer(this);
-        QObject::connect(m_timer, &QTimer::timeout, this, [this]() {
-            if (m_clock.isValid()) {
-                const int elapsed = int(m_clock.elapsed());
-                if (elapsed >= m_duration) {
-                    m_timer->stop();
-                    this->deleteLater();
-                    return;
-                }
-            }
-            update();
-        });
+        RippleOverlayWidget *&overlay = overlays()[window];
+        if (!overlay) {
+            overlay = new RippleOverlayWidget(window);
+        }
+        return overlay;
     }
 
-    void start() {
-        m_clock.start();
-        m_timer->start(16); // ~60 FPS
+    ~RippleOverlayWidget() override
+    {
+        overlays().remove(m_window);
+    }
+
+    void addRipple(const Ripple &ripple)
+    {
+        m_ripples.append(ripple);
+        updateGeometryForRipples();
+        if (!m_animation.isRunning()) {
+            m_animation.start();
+        }
         show();
         raise();
+        requestUpdate(this);
     }
 
 protected:
     void paintEvent(QPaintEvent*) override {
+        QTANTD_PAINT_SCOPE(this);
         QPainter p(this);
         p.setRenderHint(QPainter::Antialiasing, true);
+        // Ripple rects are kept in window coordinates
+        p.translate(-pos());
+
+        const qint64 now = AnimationDriver::instance().now();
+        for (const Ripple &ripple : m_ripples) {
+            paintRipple(&p, ripple, now);
+        }
+    }
+
+private:
+    explicit RippleOverlayWidget(QWidget *window)
+        : QWidget(window)
+        , m_window(window)
+        , m_animation(this)
+    {
+        setAttribute(Qt::WA_TransparentForMouseEvents, true);
+        setAttribute(Qt::WA_NoSystemBackground, true);
+        setAttribute(Qt::WA_TranslucentBackground, true);
+        m_ripples.reserve(gReservedRipples);
+        m_animation.setTickFunction([this](qint64) { tick(); });
+    }
 
-        const qreal t = m_clock.isValid() ? qBound<qreal>(0.0, m_clock.elapsed() / qreal(m_duration), 1.0) : 0.0;
+    static QHash<QWidget *, RippleOverlayWidget *> &overlays()
+    {
+        static QHash<QWidget *, RippleOverlayWidget *> map;
+        return map;
+    }
+
+    void tick()
+    {
+        // Drop finished ripples in place; the list keeps its capacity
+        const qint64 now = AnimationDriver::instance().now();
+        const int before = m_ripples.size();
+        m_ripples.erase(std::remove_if(m_ripples.begin(), m_ripples.end(),
+                                       [now](const Ripple &ripple) {
+                                           return now - ripple.startTime >= ripple.duration;
+                                       }),
+                        m_ripples.end());
+
+        if (m_ripples.isEmpty()) {
+            m_animation.stop();
+            hide();
+            return;
+        }
+        if (m_ripples.size() != before) {
+            updateGeometryForRipples();
+        }
+        requestUpdate(this);
+    }
+
+    // Cover exactly the union of the active ripples at their full extent
+    void updateGeometryForRipples()
+    {
+        QRectF bounds;
+        for (const Ripple &ripple : m_ripples) {
+            const int e = ripple.extra;
+            bounds |= ripple.innerRect.adjusted(-e, -e, e, e);
+        }
+        const QRect rect = bounds.toAlignedRect();
+        if (rect != geometry()) {
+            setGeometry(rect);
+        }
+    }
+
+    static void paintRipple(QPainter *p, const Ripple &ripple, qint64 now)
+    {
+        const qreal t = qBound<qreal>(0.0, (now - ripple.startTime) / qreal(ripple.duration), 1.0);
         const qreal ease = 1.0 - std::pow(1.0 - t, 3.0);
-        const qreal grow = m_extra * ease;
+        const int growStep = qRound(ripple.extra * ease * gGrowStepsPerPixel);
         const qreal alpha = (1.0 - t) * 0.35;
+        if (growStep <= 0 || alpha <= 0.0) {
+            return;
+        }
 
-        QRectF outer = m_innerRect.adjusted(-grow, -grow, grow, grow);
-        const qreal outerRadius = m_isCircle ? outer.height() / 2.0 : m_cornerRadius + grow;
+        // The ring is cached as coverage only; color and fade are applied here
+        const qreal grow = qreal(growStep) / gGrowStepsPerPixel;
+        const int margin = qCeil(grow);
+        const QSize innerSize = ripple.innerRect.size().toSize();
+        const QImage &ring = ringMask(ripple, innerSize, growStep, p->device()->devicePixelRatioF());
+
+        QColor color = ripple.color;
+        color.setAlphaF(alpha);
+        const QRectF target(ripple.innerRect.topLeft() - QPointF(margin, margin),
+                            QSizeF(innerSize + QSize(2 * margin, 2 * margin)));
+        // Every frame has its own ring and fade, so nothing is worth keeping
+        drawAlphaMask(p, target, ring, ring.rect(), color, DontCacheTint);
+    }
 
-        QPainterPath innerPath;
-        if (m_isCircle) {
-            innerPath.addEllipse(m_innerRect);
-        } else {
-            innerPath.addRoundedRect(m_innerRect, m_cornerRadius, m_cornerRadius);
+    // Ring between the inner shape and the inner shape grown by growStep, drawn as
+    // a single stroke along the middle of the band instead of a path subtraction.
+    static const QImage &ringMask(const Ripple &ripple, const QSize &innerSize, int growStep, qreal dpr)
+    {
+        thread_local RenderCache<QImage> cache(gRingCacheKb);
+
+        RenderCacheKey key;
+        key.add(ripple.isCircle)
+           .add(innerSize.width())
+           .add(innerSize.height())
+           .add(ripple.isCircle ? 0 : ripple.cornerRadius)
+           .add(growStep)
+           .add(dpr);
+
+        if (const QImage *cached = cache.find(key)) {
+            return *cached;
         }
 
-        QPainterPath outerPath;
-        if (m_isCircle) {
-            outerPath.addEllipse(outer);
+        const qreal grow = qreal(growStep) / gGrowStepsPerPixel;
+        const int margin = qCeil(grow);
+        QImage mask = createAlphaMask(innerSize + QSize(2 * margin, 2 * margin), dpr);
+
+        QPainter painter(&mask);
+        painter.setRenderHint(QPainter::Antialiasing, true);
+        painter.setPen(QPen(Qt::black, grow));
+        painter.setBrush(Qt::NoBrush);
+
+        const qreal half = grow / 2.0;
+        const QRectF band = QRectF(QPointF(margin, margin), innerSize).adjusted(-half, -half, half, half);
+        if (ripple.isCircle) {
+            painter.drawEllipse(band);
         } else {
-            outerPath.addRoundedRect(outer, outerRadius, outerRadius);
+            const qreal radius = ripple.cornerRadius + half;
+            painter.drawRoundedRect(band, radius, radius);
         }
+        painter.end();
 
-        QPainterPath ring = outerPath.subtracted(innerPath);
-        QColor c = m_color;
-        c.setAlphaF(alpha);
-        p.fillPath(ring, c);
+        return *cache.insert(key, mask, mask.sizeInBytes());
     }
 
-private:
-    QRectF m_innerRect;
-    int m_cornerRadius;
-    bool m_isCircle;
-    QColor m_color;
-    int m_extra;
-    int m_duration;
-    QElapsedTimer m_clock;
-    QTimer* m_timer { nullptr };
+    QWidget *m_window;
+    QVector<Ripple> m_ripples;
+    Animation m_animation;
 };
 
 void StartOuterRippleOverlay(QWidget* originWidget,
@@ -112,18 +225,18 @@ void StartOuterRippleOverlay(QWidget* originWidget,
     const QPoint topLeftInWin = originWidget->mapTo(win, innerRectInOrigin.topLeft());
     const QRect innerInWin(topLeftInWin, innerRectInOrigin.size());
 
-    const QRect overlayRect = innerInWin.adjusted(-extraPixels, -extraPixels, extraPixels, extraPixels);
-    const QRect innerInOverlay(innerInWin.topLeft() - overlayRect.topLeft(), innerInWin.size());
-
-    auto overlay = new RippleOverlayWidget(win,
-                                           innerInOverlay,
-                                           cornerRadius,
-                                           isCircle,
-                                           color,
-                                           extraPixels,
-                                           durationMs);
-    overlay->setGeometry(overlayRect);
-    overlay->start();
+    Ripple ripple;
+    ripple.innerRect = innerInWin;
+    ripple.cornerRadius = cornerRadius;
+    ripple.isCircle = isCircle;
+    ripple.color = color;
+    ripple.extra = extraPixels;
+    ripple.duration = qMax(1, durationMs);
+    ripple.startTime = AnimationDriver::instance().now();
+
+    RippleOverlayWidget::forWindow(win)->addRipple(ripple);
 }
 
 } // namespace QtAntdInternal
+
+#include "qtantdrippleoverlay.moc"
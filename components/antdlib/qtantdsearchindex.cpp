@@ -0,0 +1,260 @@
+#include "qtantdsearchindex_p.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace QtAntdInternal {
+
+namespace {
+
+// Work between two checks for a newer search or build
+const int gCancelCheckInterval = 4096;
+
+quint64 trigramAt(const QChar *text)
+{
+    return (quint64(text[0].unicode()) << 32) | (quint64(text[1].unicode()) << 16)
+        | quint64(text[2].unicode());
+}
+
+// Distinct trigrams of text, ascending
+QVector<quint64> trigramsOf(const QString &text)
+{
+    QVector<quint64> trigrams;
+    const int count = text.size() - 2;
+    if (count <= 0) {
+        return trigrams;
+    }
+    trigrams.reserve(count);
+    const QChar *data = text.constData();
+    for (int i = 0; i < count; ++i) {
+        trigrams.append(trigramAt(data + i));
+    }
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    return trigrams;
+}
+
+bool isCancelled(const QAtomicInteger<quint64> *token, quint64 generation)
+{
+    return token && token->loadAcquire() != generation;
+}
+
+bool isAscii(const QString &text)
+{
+    const QChar *data = text.constData();
+    for (int i = 0; i < text.size(); ++i) {
+        if (data[i].unicode() >= 0x80) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+QString foldSearchText(const QString &text)
+{
+    if (isAscii(text)) {
+        return text.toLower();
+    }
+
+    // Compatibility decomposition splits accented letters (and ligatures such
+    // as "ﬁ") into base letters followed by combining marks, which are dropped
+    const QString decomposed = text.normalized(QString::NormalizationForm_KD);
+    QString stripped;
+    stripped.reserve(decomposed.size());
+    for (const QChar c : decomposed) {
+        switch (c.category()) {
+        case QChar::Mark_NonSpacing:
+        case QChar::Mark_SpacingCombining:
+        case QChar::Mark_Enclosing:
+            break;
+        default:
+            stripped.append(c);
+            break;
+        }
+    }
+    return stripped.toCaseFolded();
+}
+
+SearchIndex::SearchIndex()
+    : m_deadInPostings(0)
+{
+}
+
+SearchIndex SearchIndex::build(const QVector<QString> &texts, const QAtomicInteger<quint64> *token,
+                               quint64 generation)
+{
+    SearchIndex index;
+    index.m_texts.reserve(texts.size());
+    index.m_alive.reserve(texts.size());
+    index.m_rowIds.reserve(texts.size());
+    for (int i = 0; i < texts.size(); ++i) {
+        if (i % gCancelCheckInterval == 0 && isCancelled(token, generation)) {
+            return SearchIndex();
+        }
+        index.m_rowIds.append(index.addText(foldSearchText(texts.at(i))));
+    }
+    return index;
+}
+
+void SearchIndex::insertRows(int first, const QVector<QString> &foldedTexts)
+{
+    first = qBound(0, first, m_rowIds.size());
+    QVector<int> ids;
+    ids.reserve(foldedTexts.size());
+    for (const QString &text : foldedTexts) {
+        ids.append(addText(text));
+    }
+    m_rowIds.insert(first, ids.size(), -1);
+    std::copy(ids.cbegin(), ids.cend(), m_rowIds.begin() + first);
+}
+
+void SearchIndex::removeRows(int first, int count)
+{
+    if (first < 0 || count <= 0 || first + count > m_rowIds.size()) {
+        return;
+    }
+    for (int row = first; row < first + count; ++row) {
+        removeId(m_rowIds.at(row));
+    }
+    m_rowIds.remove(first, count);
+    prune();
+}
+
+void SearchIndex::replaceRow(int row, const QString &foldedText)
+{
+    if (row < 0 || row >= m_rowIds.size()) {
+        return;
+    }
+    removeId(m_rowIds.at(row));
+    m_rowIds[row] = addText(foldedText);
+    prune();
+}
+
+bool SearchIndex::matches(int id, const QString &foldedQuery) const
+{
+    return id >= 0 && id < m_alive.size() && m_alive.at(id) && m_texts.at(id).contains(foldedQuery);
+}
+
+bool SearchIndex::isText(int id, const QString &foldedText) const
+{
+    return id >= 0 && id < m_alive.size() && m_alive.at(id) && m_texts.at(id) == foldedText;
+}
+
+int SearchIndex::rowOfId(int id) const
+{
+    if (id < 0 || id >= m_alive.size() || !m_alive.at(id)) {
+        return -1;
+    }
+    const auto it = std::find(m_rowIds.cbegin(), m_rowIds.cend(), id);
+    return it == m_rowIds.cend() ? -1 : int(it - m_rowIds.cbegin());
+}
+
+QVector<int> SearchIndex::search(const QString &foldedQuery, const QVector<int> *candidates,
+                                 const QAtomicInteger<quint64> *token, quint64 generation) const
+{
+    QVector<int> result;
+    QVector<int> intersection;
+
+    if (candidates) {
+        // Narrowing: a longer query only matches texts the shorter one matched
+        intersection = *candidates;
+    } else if (foldedQuery.size() < 3) {
+        // Too short for trigrams; every text is a candidate
+        intersection.reserve(m_texts.size());
+        for (int id = 0; id < m_texts.size(); ++id) {
+            if (m_alive.at(id)) {
+                intersection.append(id);
+            }
+        }
+    } else {
+        QVector<const QVector<int> *> postings;
+        for (const quint64 trigram : trigramsOf(foldedQuery)) {
+            const auto it = m_trigrams.constFind(trigram);
+            if (it == m_trigrams.cend()) {
+                return result;
+            }
+            postings.append(&it.value());
+        }
+        std::sort(postings.begin(), postings.end(),
+                  [](const QVector<int> *left, const QVector<int> *right) {
+                      return left->size() < right->size();
+                  });
+
+        // Smallest list first keeps every intermediate result small
+        intersection = *postings.first();
+        QVector<int> next;
+        for (int i = 1; i < postings.size() && !intersection.isEmpty(); ++i) {
+            if (isCancelled(token, generation)) {
+                return QVector<int>();
+            }
+            next.clear();
+            std::set_intersection(intersection.cbegin(), intersection.cend(),
+                                  postings.at(i)->cbegin(), postings.at(i)->cend(),
+                                  std::back_inserter(next));
+            intersection.swap(next);
+        }
+    }
+
+    // Trigrams only tell which texts may match; check each one
+    result.reserve(intersection.size());
+    for (int i = 0; i < intersection.size(); ++i) {
+        if (i % gCancelCheckInterval == 0 && isCancelled(token, generation)) {
+            return QVector<int>();
+        }
+        const int id = intersection.at(i);
+        if (matches(id, foldedQuery)) {
+            result.append(id);
+        }
+    }
+    return result;
+}
+
+int SearchIndex::addText(const QString &foldedText)
+{
+    const int id = m_texts.size();
+    m_texts.append(foldedText);
+    m_alive.append(true);
+    for (const quint64 trigram : trigramsOf(foldedText)) {
+        m_trigrams[trigram].append(id);
+    }
+    return id;
+}
+
+void SearchIndex::removeId(int id)
+{
+    if (id < 0 || id >= m_alive.size() || !m_alive.at(id)) {
+        return;
+    }
+    m_alive[id] = false;
+    if (m_texts.at(id).size() >= 3) {
+        ++m_deadInPostings;
+    }
+    m_texts[id].clear();
+}
+
+/*!
+ * \internal
+ * Drops removed ids from the posting lists once they outnumber the rows.
+ */
+void SearchIndex::prune()
+{
+    if (m_deadInPostings <= qMax(1024, m_rowIds.size())) {
+        return;
+    }
+
+    for (auto it = m_trigrams.begin(); it != m_trigrams.end();) {
+        QVector<int> &ids = it.value();
+        ids.erase(std::remove_if(ids.begin(), ids.end(), [this](int id) { return !m_alive.at(id); }),
+                  ids.end());
+        if (ids.isEmpty()) {
+            it = m_trigrams.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    m_deadInPostings = 0;
+}
+
+} // namespace QtAntdInternal
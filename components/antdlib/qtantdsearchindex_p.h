@@ -0,0 +1,70 @@
+#ifndef QtAntdSearchIndex_P_H
+#define QtAntdSearchIndex_P_H
+
+#include <QtGlobal>
+#include <QAtomicInteger>
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+namespace QtAntdInternal {
+
+// Text as compared by searches: case folded, with accents and other combining
+// marks removed ("Élan" and "elan" fold to the same text).
+QString foldSearchText(const QString &text);
+
+// Substring index over the folded texts of a list of rows.
+//
+// Every row gets an id when it is added; ids only grow, so posting lists stay
+// sorted by appending. Each posting list holds the ids of the texts containing
+// one trigram (three consecutive UTF-16 units), and a query of three or more
+// units only checks the texts in the intersection of its trigrams' lists.
+//
+// The index is implicitly shared: a copy is an O(1) snapshot that a worker
+// thread can search while the original keeps being updated.
+class SearchIndex
+{
+public:
+    SearchIndex();
+
+    // Folds texts and indexes them as rows 0..n-1
+    static SearchIndex build(const QVector<QString> &texts, const QAtomicInteger<quint64> *token = nullptr,
+                             quint64 generation = 0);
+
+    void insertRows(int first, const QVector<QString> &foldedTexts);
+    void removeRows(int first, int count);
+    // Gives row a new id for its new text
+    void replaceRow(int row, const QString &foldedText);
+
+    int rowCount() const { return m_rowIds.size(); }
+    int idOfRow(int row) const { return row >= 0 && row < m_rowIds.size() ? m_rowIds.at(row) : -1; }
+    // Row of id, or -1 once removed; linear in the row count
+    int rowOfId(int id) const;
+    // Ids given so far; every id is below
+    int idLimit() const { return m_texts.size(); }
+    bool matches(int id, const QString &foldedQuery) const;
+    bool isText(int id, const QString &foldedText) const;
+
+    // Ids of the rows whose text contains foldedQuery, ascending. With
+    // candidates (ascending ids), only those are checked. Returns early with an
+    // empty result once token no longer holds generation.
+    QVector<int> search(const QString &foldedQuery,
+                        const QVector<int> *candidates = nullptr,
+                        const QAtomicInteger<quint64> *token = nullptr,
+                        quint64 generation = 0) const;
+
+private:
+    int addText(const QString &foldedText);
+    void removeId(int id);
+    void prune();
+
+    QVector<QString> m_texts; // By id; cleared once removed
+    QVector<bool> m_alive;    // By id
+    QVector<int> m_rowIds;    // By row
+    QHash<quint64, QVector<int>> m_trigrams;
+    int m_deadInPostings;     // Removed ids still listed in m_trigrams
+};
+
+} // namespace QtAntdInternal
+
+#endif  // QtAntdSearchIndex_P_H
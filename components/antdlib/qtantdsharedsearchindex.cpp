@@ -0,0 +1,368 @@
+#include "qtantdsharedsearchindex_p.h"
+
+#include <QAbstractItemModel>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QPair>
+#include <QThreadPool>
+#include <algorithm>
+
+namespace QtAntdInternal {
+
+namespace {
+
+// Larger source changes build the index again, off the GUI thread, instead of
+// updating it row by row
+const int gIncrementalLimit = 1000;
+// Time spent reading texts before returning to the event loop, in ms
+const int gReadSlice = 8;
+
+using RegistryKey = QPair<const QAbstractItemModel *, int>;
+
+QHash<RegistryKey, SharedSearchIndex *> &registry()
+{
+    static QHash<RegistryKey, SharedSearchIndex *> indexes;
+    return indexes;
+}
+
+} // namespace
+
+SharedSearchIndex::SharedSearchIndex(QAbstractItemModel *model, int column)
+    : QObject()
+    , m_model(model)
+    , m_key(model)
+    , m_column(column)
+    , m_state(Unbuilt)
+    , m_generation(new QAtomicInteger<quint64>(0))
+{
+    m_readTimer.setSingleShot(true);
+    m_readTimer.setInterval(0);
+    connect(&m_readTimer, &QTimer::timeout, this, [this]() { readSlice(); });
+
+    connect(model, &QAbstractItemModel::rowsInserted, this, &SharedSearchIndex::rowsInserted);
+    connect(model, &QAbstractItemModel::rowsRemoved, this, &SharedSearchIndex::rowsRemoved);
+    connect(model, &QAbstractItemModel::dataChanged, this, &SharedSearchIndex::dataChanged);
+    connect(model, &QAbstractItemModel::rowsMoved, this, &SharedSearchIndex::rebuild);
+    connect(model, &QAbstractItemModel::columnsInserted, this, &SharedSearchIndex::rebuild);
+    connect(model, &QAbstractItemModel::columnsRemoved, this, &SharedSearchIndex::rebuild);
+    connect(model, &QAbstractItemModel::columnsMoved, this, &SharedSearchIndex::rebuild);
+    connect(model, &QAbstractItemModel::layoutChanged, this, &SharedSearchIndex::rebuild);
+    connect(model, &QAbstractItemModel::modelReset, this, &SharedSearchIndex::rebuild);
+    connect(model, &QObject::destroyed, this, &SharedSearchIndex::modelDestroyed);
+}
+
+SharedSearchIndex::~SharedSearchIndex()
+{
+    // Stops a build still running; it holds its own reference to the counter
+    m_generation->fetchAndAddOrdered(1);
+
+    auto &indexes = registry();
+    const RegistryKey key(m_key, m_column);
+    if (indexes.value(key) == this) {
+        indexes.remove(key);
+    }
+}
+
+QSharedPointer<SharedSearchIndex> SharedSearchIndex::acquire(QAbstractItemModel *model, int column)
+{
+    auto &indexes = registry();
+    const RegistryKey key(model, column);
+    if (SharedSearchIndex *existing = indexes.value(key)) {
+        return existing->m_self.toStrongRef();
+    }
+
+    const QSharedPointer<SharedSearchIndex> created(new SharedSearchIndex(model, column));
+    created->m_self = created;
+    indexes.insert(key, created.data());
+    return created;
+}
+
+void SharedSearchIndex::addListener(SearchIndexListener *listener)
+{
+    if (!m_listeners.contains(listener)) {
+        m_listeners.append(listener);
+    }
+}
+
+void SharedSearchIndex::removeListener(SearchIndexListener *listener)
+{
+    m_listeners.removeOne(listener);
+}
+
+void SharedSearchIndex::ensureBuilt()
+{
+    if (m_state == Unbuilt) {
+        startBuild();
+    }
+}
+
+QString SharedSearchIndex::sourceText(int row) const
+{
+    return m_model->data(m_model->index(row, m_column), Qt::DisplayRole).toString();
+}
+
+QVector<QString> SharedSearchIndex::foldedTexts(int first, int last) const
+{
+    QVector<QString> texts;
+    texts.reserve(last - first + 1);
+    for (int row = first; row <= last; ++row) {
+        texts.append(foldSearchText(sourceText(row)));
+    }
+    return texts;
+}
+
+/*
+ * Drops the index and reads the source texts again, in time slices.
+ */
+void SharedSearchIndex::startBuild()
+{
+    const bool wasReady = m_state == Ready;
+
+    m_generation->fetchAndAddOrdered(1);
+    m_index = SearchIndex();
+    m_readTexts.clear();
+    m_changes.clear();
+    m_state = Reading;
+    m_readTimer.start();
+
+    if (wasReady) {
+        notifyDropped();
+    }
+}
+
+/*
+ * Reads source texts for one time slice. Folding and indexing them runs on a
+ * worker thread once all are read.
+ */
+void SharedSearchIndex::readSlice()
+{
+    QElapsedTimer clock;
+    clock.start();
+
+    const int rows = m_model ? m_model->rowCount() : 0;
+    m_readTexts.reserve(rows);
+    while (m_readTexts.size() < rows) {
+        m_readTexts.append(sourceText(m_readTexts.size()));
+        if (m_readTexts.size() % 64 == 0 && clock.elapsed() >= gReadSlice) {
+            m_readTimer.start();
+            return;
+        }
+    }
+
+    QVector<QString> texts;
+    texts.swap(m_readTexts);
+    m_state = Building;
+    const quint64 current = m_generation->fetchAndAddOrdered(1) + 1;
+    const QSharedPointer<QAtomicInteger<quint64>> token = m_generation;
+    const QPointer<SharedSearchIndex> receiver(this);
+    QThreadPool::globalInstance()->start([texts, token, current, receiver]() {
+        const SearchIndex built = SearchIndex::build(texts, token.data(), current);
+        QCoreApplication *app = QCoreApplication::instance();
+        if (token->loadAcquire() != current || !app) {
+            return;
+        }
+        QMetaObject::invokeMethod(app, [built, current, receiver]() {
+            if (receiver) {
+                receiver->install(built, current);
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+/*
+ * Takes the built index and replays the source changes made meanwhile.
+ */
+void SharedSearchIndex::install(const SearchIndex &built, quint64 current)
+{
+    if (m_generation->loadAcquire() != current) {
+        return;
+    }
+
+    m_index = built;
+    for (const Change &change : m_changes) {
+        switch (change.type) {
+        case Change::Insert:
+            m_index.insertRows(change.first, change.foldedTexts);
+            break;
+        case Change::Remove:
+            m_index.removeRows(change.first, change.count);
+            break;
+        case Change::Replace:
+            for (int i = 0; i < change.count; ++i) {
+                m_index.replaceRow(change.first + i, change.foldedTexts.at(i));
+            }
+            break;
+        }
+    }
+    m_changes.clear();
+    m_state = Ready;
+    notifyReady();
+}
+
+void SharedSearchIndex::modelDestroyed()
+{
+    // A new model may be created at the same address
+    auto &indexes = registry();
+    const RegistryKey key(m_key, m_column);
+    if (indexes.value(key) == this) {
+        indexes.remove(key);
+    }
+
+    const bool wasReady = m_state == Ready;
+    m_generation->fetchAndAddOrdered(1);
+    m_readTimer.stop();
+    m_index = SearchIndex();
+    m_readTexts.clear();
+    m_changes.clear();
+    m_state = Unbuilt;
+
+    if (wasReady) {
+        notifyDropped();
+    }
+}
+
+void SharedSearchIndex::rowsInserted(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid()) {
+        return;
+    }
+
+    const int count = last - first + 1;
+    switch (m_state) {
+    case Unbuilt:
+        break;
+    case Reading:
+        // Rows past the ones read so far are read in turn
+        if (first < m_readTexts.size()) {
+            QVector<QString> texts;
+            texts.reserve(count);
+            for (int row = first; row <= last; ++row) {
+                texts.append(sourceText(row));
+            }
+            m_readTexts.insert(first, count, QString());
+            std::copy(texts.cbegin(), texts.cend(), m_readTexts.begin() + first);
+        }
+        break;
+    case Building:
+        if (count > gIncrementalLimit) {
+            startBuild();
+        } else {
+            m_changes.append({ Change::Insert, first, count, foldedTexts(first, last) });
+        }
+        break;
+    case Ready:
+        if (count > gIncrementalLimit) {
+            startBuild();
+        } else {
+            const int firstId = m_index.idLimit();
+            m_index.insertRows(first, foldedTexts(first, last));
+            notifyIdsAdded(firstId);
+        }
+        break;
+    }
+}
+
+void SharedSearchIndex::rowsRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid()) {
+        return;
+    }
+
+    const int count = last - first + 1;
+    switch (m_state) {
+    case Unbuilt:
+        break;
+    case Reading:
+        if (first < m_readTexts.size()) {
+            m_readTexts.remove(first, qMin(count, m_readTexts.size() - first));
+        }
+        break;
+    case Building:
+        m_changes.append({ Change::Remove, first, count, QVector<QString>() });
+        break;
+    case Ready:
+        m_index.removeRows(first, count);
+        break;
+    }
+}
+
+void SharedSearchIndex::dataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight,
+                                    const QVector<int> &roles)
+{
+    if (topLeft.parent().isValid() || m_column < topLeft.column() || m_column > bottomRight.column()) {
+        return;
+    }
+    if (!roles.isEmpty() && !roles.contains(Qt::DisplayRole)) {
+        return;
+    }
+
+    const int first = topLeft.row();
+    const int last = bottomRight.row();
+    const int count = last - first + 1;
+    switch (m_state) {
+    case Unbuilt:
+        break;
+    case Reading:
+        for (int row = first; row <= last && row < m_readTexts.size(); ++row) {
+            m_readTexts[row] = sourceText(row);
+        }
+        break;
+    case Building:
+        if (count > gIncrementalLimit) {
+            startBuild();
+        } else {
+            m_changes.append({ Change::Replace, first, count, foldedTexts(first, last) });
+        }
+        break;
+    case Ready:
+        if (count > gIncrementalLimit) {
+            startBuild();
+        } else {
+            const int firstId = m_index.idLimit();
+            for (int row = first; row <= last; ++row) {
+                m_index.replaceRow(row, foldSearchText(sourceText(row)));
+            }
+            notifyIdsAdded(firstId);
+        }
+        break;
+    }
+}
+
+/*
+ * Moves, layout changes and resets invalidate every row position.
+ */
+void SharedSearchIndex::rebuild()
+{
+    if (m_state != Unbuilt) {
+        startBuild();
+    }
+}
+
+// Listeners may remove themselves while notified, so a copy is iterated
+
+void SharedSearchIndex::notifyReady()
+{
+    const QVector<SearchIndexListener *> listeners = m_listeners;
+    for (SearchIndexListener *listener : listeners) {
+        listener->searchIndexReady();
+    }
+}
+
+void SharedSearchIndex::notifyIdsAdded(int firstId)
+{
+    const QVector<SearchIndexListener *> listeners = m_listeners;
+    for (SearchIndexListener *listener : listeners) {
+        listener->searchIndexIdsAdded(firstId);
+    }
+}
+
+void SharedSearchIndex::notifyDropped()
+{
+    const QVector<SearchIndexListener *> listeners = m_listeners;
+    for (SearchIndexListener *listener : listeners) {
+        listener->searchIndexDropped();
+    }
+}
+
+} // namespace QtAntdInternal
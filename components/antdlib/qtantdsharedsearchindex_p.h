@@ -0,0 +1,126 @@
+#ifndef QtAntdSharedSearchIndex_P_H
+#define QtAntdSharedSearchIndex_P_H
+
+#include <QtGlobal>
+#include <QAtomicInteger>
+#include <QObject>
+#include <QPointer>
+#include <QSharedPointer>
+#include <QString>
+#include <QTimer>
+#include <QVector>
+#include <QWeakPointer>
+#include "qtantdsearchindex_p.h"
+
+class QAbstractItemModel;
+class QModelIndex;
+
+namespace QtAntdInternal {
+
+// Told about changes of a SharedSearchIndex it was added to
+class SearchIndexListener
+{
+public:
+    virtual ~SearchIndexListener() {}
+
+    // index() now holds every row of the source
+    virtual void searchIndexReady() = 0;
+    // Inserted or edited rows got the ids from firstId on
+    virtual void searchIndexIdsAdded(int firstId) = 0;
+    // index() was dropped to be built again; ids handed out so far are void
+    virtual void searchIndexDropped() = 0;
+};
+
+// SearchIndex of the Qt::DisplayRole texts in one column of a flat model,
+// shared by everything searching that model and column (e.g. several selects
+// on one option model) through acquire().
+//
+// Nothing is read until the first ensureBuilt(): then the texts are read in
+// time slices on the GUI thread and indexed on a worker thread. Once ready,
+// the index follows row inserts, removals and edits of the model. Those
+// arriving while it is read or built are applied to the texts read so far or
+// queued for the built index; only moves, layout changes, resets and changes
+// of more than a thousand rows build it again.
+//
+// The index connects to the model when acquired, so listeners hear of a change
+// before slots connected afterwards, e.g. those of a proxy model on the same
+// source.
+class SharedSearchIndex : public QObject
+{
+public:
+    ~SharedSearchIndex();
+
+    // The index of column in model, created on first use and released with
+    // the last reference. GUI thread only.
+    static QSharedPointer<SharedSearchIndex> acquire(QAbstractItemModel *model, int column);
+
+    void addListener(SearchIndexListener *listener);
+    void removeListener(SearchIndexListener *listener);
+
+    // Starts building the index unless it is built or being built
+    void ensureBuilt();
+    bool isReady() const { return m_state == Ready; }
+    const SearchIndex &index() const { return m_index; }
+
+private:
+    Q_DISABLE_COPY(SharedSearchIndex)
+
+    enum State {
+        Unbuilt,
+        Reading,  // m_readTexts holds the texts of the first rows
+        Building, // On a worker thread; changes go to m_changes
+        Ready
+    };
+
+    // Source change that arrived while the index was built
+    struct Change
+    {
+        enum Type {
+            Insert,
+            Remove,
+            Replace
+        };
+
+        Type type;
+        int first;
+        int count;
+        QVector<QString> foldedTexts; // Insert and Replace
+    };
+
+    SharedSearchIndex(QAbstractItemModel *model, int column);
+
+    QString sourceText(int row) const;
+    QVector<QString> foldedTexts(int first, int last) const;
+    void startBuild();
+    void readSlice();
+    void install(const SearchIndex &built, quint64 generation);
+    void modelDestroyed();
+
+    void rowsInserted(const QModelIndex &parent, int first, int last);
+    void rowsRemoved(const QModelIndex &parent, int first, int last);
+    void dataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
+    void rebuild();
+
+    void notifyReady();
+    void notifyIdsAdded(int firstId);
+    void notifyDropped();
+
+    QPointer<QAbstractItemModel> m_model;
+    const QAbstractItemModel *m_key; // Registry key, kept once the model is gone
+    int m_column;
+    QWeakPointer<SharedSearchIndex> m_self;
+
+    State m_state;
+    SearchIndex m_index;
+    QVector<QString> m_readTexts;
+    QVector<Change> m_changes;
+    QTimer m_readTimer;
+    // Bumped for every build; a build holding an older value stops
+    QSharedPointer<QAtomicInteger<quint64>> m_generation;
+
+    QVector<SearchIndexListener *> m_listeners;
+};
+
+} // namespace QtAntdInternal
+
+#endif  // QtAntdSharedSearchIndex_P_H
@@ -0,0 +1,98 @@
+#include "qtantdspinneratlas_p.h"
+#include "qtantdrendercache_p.h"
+#include "qtantdalphamask_p.h"
+
+#include <QPainter>
+#include <QtMath>
+
+namespace QtAntdInternal {
+
+namespace {
+
+// 6 degrees per frame is below what the eye resolves at spinner speeds
+const int gSpinnerFrames = 60;
+const int gAtlasColumns = 10;
+const int gAtlasRows = gSpinnerFrames / gAtlasColumns;
+const int gSpinnerAtlasCacheKb = 4096;
+
+static_assert(gSpinnerFrames % gAtlasColumns == 0, "Spinner atlas must be a full grid");
+
+// Coverage of every frame; the spinner color is applied when compositing
+struct SpinnerAtlas
+{
+    QImage mask;
+    int cellSize { 0 }; // Logical pixels
+};
+
+const SpinnerAtlas &spinnerAtlas(qreal diameter, qreal penWidth, int arcDegrees, qreal dpr)
+{
+    thread_local RenderCache<SpinnerAtlas> cache(gSpinnerAtlasCacheKb);
+
+    RenderCacheKey key;
+    key.add(diameter).add(penWidth).add(arcDegrees).add(dpr);
+    if (const SpinnerAtlas *cached = cache.find(key)) {
+        return *cached;
+    }
+
+    // One pixel of slack around the stroke for antialiasing
+    SpinnerAtlas atlas;
+    atlas.cellSize = qCeil(diameter + penWidth) + 2;
+
+    const int cellPixels = qCeil(atlas.cellSize * dpr);
+    atlas.mask = QImage(cellPixels * gAtlasColumns, cellPixels * gAtlasRows, QImage::Format_Alpha8);
+    atlas.mask.fill(0);
+
+    QPainter painter(&atlas.mask);
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    QPen pen(Qt::black, penWidth);
+    pen.setCapStyle(Qt::RoundCap); // Round ends for smoother look
+    painter.setPen(pen);
+    painter.setBrush(Qt::NoBrush);
+
+    const qreal radius = diameter / 2.0;
+    const QRectF arcRect(-radius, -radius, diameter, diameter);
+    for (int frame = 0; frame < gSpinnerFrames; ++frame) {
+        const int column = frame % gAtlasColumns;
+        const int row = frame / gAtlasColumns;
+
+        painter.resetTransform();
+        painter.translate((column + 0.5) * cellPixels, (row + 0.5) * cellPixels);
+        painter.scale(dpr, dpr);
+        painter.rotate(frame * 360.0 / gSpinnerFrames);
+        painter.drawArc(arcRect, 0, arcDegrees * 16);
+    }
+    painter.end();
+
+    return *cache.insert(key, atlas, atlas.mask.sizeInBytes());
+}
+
+} // namespace
+
+void drawSpinner(QPainter *painter,
+                 const QPointF &center,
+                 qreal diameter,
+                 qreal penWidth,
+                 int arcDegrees,
+                 const QColor &color,
+                 int angle)
+{
+    const qreal dpr = painter->device()->devicePixelRatioF();
+    const SpinnerAtlas &atlas = spinnerAtlas(diameter, penWidth, arcDegrees, dpr);
+
+    int frame = qRound(angle * gSpinnerFrames / 360.0) % gSpinnerFrames;
+    if (frame < 0) {
+        frame += gSpinnerFrames;
+    }
+
+    // Source rects are in device pixels of the atlas
+    const int cellPixels = qCeil(atlas.cellSize * dpr);
+    const QRect source((frame % gAtlasColumns) * cellPixels,
+                       (frame / gAtlasColumns) * cellPixels,
+                       cellPixels, cellPixels);
+    const qreal half = atlas.cellSize / 2.0;
+    const QRectF target(center.x() - half, center.y() - half, atlas.cellSize, atlas.cellSize);
+
+    drawAlphaMask(painter, target, atlas.mask, source, color);
+}
+
+} // namespace QtAntdInternal
@@ -0,0 +1,27 @@
+#ifndef QtAntdSpinnerAtlas_P_H
+#define QtAntdSpinnerAtlas_P_H
+
+#include <QColor>
+#include <QPointF>
+
+class QPainter;
+
+namespace QtAntdInternal {
+
+// Draws a loading spinner, an arc of arcDegrees rotated by angle degrees around
+// center, with a stroke of penWidth along a circle of the given diameter.
+//
+// All rotation frames for a (diameter, pen width, arc span, device pixel ratio)
+// combination are rendered once into a shared alpha mask atlas, so each call only
+// colors and draws the nearest frame.
+void drawSpinner(QPainter *painter,
+                 const QPointF &center,
+                 qreal diameter,
+                 qreal penWidth,
+                 int arcDegrees,
+                 const QColor &color,
+                 int angle);
+
+} // namespace QtAntdInternal
+
+#endif  // QtAntdSpinnerAtlas_P_H
@@ -1,6 +1,8 @@
 #include <QFontDatabase>
 #include "../include/qtantd/lib/qtantdstyle.h"
 #include "../include/qtantd/lib/qtantdtheme.h"
+#include "qtantdstyle_p.h"
+#include "qtantdthemeregistry_p.h"
 
 /*!
  *  @class QtAntdStylePrivate
@@ -9,6 +11,8 @@
 
 QtAntdStylePrivate::QtAntdStylePrivate(QtAntdStyle *q)
     : q_ptr(q)
+    , theme(nullptr)
+    , defaultTheme(nullptr)
 {
 }
 
@@ -18,7 +22,8 @@ void QtAntdStylePrivate::init()
 {
     Q_Q(QtAntdStyle);
 
-    q->setTheme(new QtAntdTheme);
+    defaultTheme = new QtAntdTheme;
+    q->setTheme(defaultTheme);
 }
 
 /*!
@@ -26,12 +31,48 @@ void QtAntdStylePrivate::init()
  *  @internal
  */
 
+QtAntdStyle &QtAntdStyle::instance()
+{
+    static QtAntdStyle instance;
+    return instance;
+}
+
+QtAntdStyle::~QtAntdStyle() {}
+
 void QtAntdStyle::setTheme(QtAntdTheme *theme)
 {
     Q_D(QtAntdStyle);
 
+    // Colors are always looked up in a theme, so there is no way back to none
+    if (!theme || d->theme == theme) {
+        return;
+    }
+
+    QtAntdTheme *previous = d->theme;
+    if (previous) {
+        disconnect(previous, nullptr, this, nullptr);
+    }
+
     d->theme = theme;
     theme->setParent(this);
+
+    if (previous && previous == d->defaultTheme) {
+        d->defaultTheme = nullptr;
+        delete previous;
+    }
+
+    // Live components repaint once per event-loop turn, however many colors change
+    connect(theme, &QtAntdTheme::themeChanged, this, []() {
+        QtAntdInternal::ThemeRegistry::instance().scheduleRepaint();
+    });
+    QtAntdInternal::ThemeRegistry::instance().scheduleRepaint();
+}
+
+QtAntdTheme *QtAntdStyle::theme() const
+{
+    Q_D(const QtAntdStyle);
+
+    return d->theme;
 }
 
 QColor QtAntdStyle::themeColor(const QString &key) const
@@ -43,6 +84,24 @@ QColor QtAntdStyle::themeColor(const QString &key) const
     return d->theme->getColor(key);
 }
 
+QColor QtAntdStyle::themeColor(Antd::ColorToken token) const
+{
+    Q_D(const QtAntdStyle);
+
+    Q_ASSERT(d->theme);
+
+    return d->theme->getColor(token);
+}
+
+quint64 QtAntdStyle::themeGeneration() const
+{
+    Q_D(const QtAntdStyle);
+
+    Q_ASSERT(d->theme);
+
+    return d->theme->generation();
+}
+
 QtAntdStyle::QtAntdStyle()
     : QCommonStyle()
     , d_ptr(new QtAntdStylePrivate(this))
@@ -19,6 +19,7 @@ public:
 
     QtAntdStyle *const q_ptr;
     QtAntdTheme *theme;
+    QtAntdTheme *defaultTheme; // Created by init(), deleted once replaced
 };
 
 #endif  // QtAntdStyle_P_H
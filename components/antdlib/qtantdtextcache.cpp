@@ -0,0 +1,72 @@
+#include "qtantdtextcache_p.h"
+#include "qtantdrendercache_p.h"
+
+#include <QCache>
+#include <QFont>
+#include <QPainter>
+#include <QStaticText>
+
+namespace QtAntdInternal {
+
+namespace {
+
+// Labels are short and few; this comfortably holds every caption on screen
+const int gTextCacheEntries = 512;
+
+struct TextKey
+{
+    QString text;
+    QFont font;
+    int dpr; // Device pixel ratio in 1/100
+
+    bool operator==(const TextKey &other) const
+    {
+        return dpr == other.dpr && text == other.text && font == other.font;
+    }
+};
+
+HashValue qHash(const TextKey &key, HashValue seed = 0)
+{
+    return qHash(key.text, seed) ^ qHash(key.font, seed) ^ HashValue(key.dpr);
+}
+
+} // namespace
+
+void drawCachedText(QPainter *painter, const QRect &rect, int alignment, const QString &text)
+{
+    if (text.isEmpty()) {
+        return;
+    }
+
+    thread_local QCache<TextKey, QStaticText> cache(gTextCacheEntries);
+
+    const TextKey key { text, painter->font(), qRound(painter->device()->devicePixelRatioF() * 100) };
+    QStaticText *staticText = cache.object(key);
+    if (!staticText) {
+        staticText = new QStaticText(text);
+        staticText->setTextFormat(Qt::PlainText);
+        staticText->setPerformanceHint(QStaticText::AggressiveCaching);
+        staticText->prepare(QTransform(), key.font);
+        if (!cache.insert(key, staticText)) {
+            painter->drawText(rect, alignment, text);
+            return;
+        }
+    }
+
+    const QSizeF size = staticText->size();
+    QPointF position(rect.left(), rect.top());
+    if (alignment & Qt::AlignHCenter) {
+        position.rx() += (rect.width() - size.width()) / 2.0;
+    } else if (alignment & Qt::AlignRight) {
+        position.rx() += rect.width() - size.width();
+    }
+    if (alignment & Qt::AlignVCenter) {
+        position.ry() += (rect.height() - size.height()) / 2.0;
+    } else if (alignment & Qt::AlignBottom) {
+        position.ry() += rect.height() - size.height();
+    }
+
+    painter->drawStaticText(position, *staticText);
+}
+
+} // namespace QtAntdInternal
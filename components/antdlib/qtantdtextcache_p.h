@@ -0,0 +1,21 @@
+#ifndef QtAntdTextCache_P_H
+#define QtAntdTextCache_P_H
+
+#include <QRect>
+#include <QString>
+
+class QPainter;
+
+namespace QtAntdInternal {
+
+// Draws a single line of text aligned in rect with the painter's current font and
+// pen, like QPainter::drawText(rect, alignment, text).
+//
+// The text is laid out once into a QStaticText per (string, font, device pixel
+// ratio) and shared by all components painting on one thread, so hover and animation repaints reuse the
+// shaped glyph runs instead of laying the text out again.
+void drawCachedText(QPainter *painter, const QRect &rect, int alignment, const QString &text);
+
+} // namespace QtAntdInternal
+
+#endif  // QtAntdTextCache_P_H
@@ -6,19 +6,144 @@
 #include <QString>
 #include <QStringBuilder>
 
+#include <atomic>
+
 /*!Antd
  *  @class QtAntdThemePrivate
  *  @internal
  */
 
+namespace {
+// Shared by all themes so that two instances never report the same generation
+std::atomic<quint64> gThemeGeneration(0);
+
+constexpr QRgb hexDigit(char c)
+{
+    return (c >= '0' && c <= '9') ? QRgb(c - '0')
+         : (c >= 'a' && c <= 'f') ? QRgb(c - 'a' + 10)
+         : QRgb(c - 'A' + 10);
+}
+
+// Parses "#rrggbb" at compile time into an opaque packed ARGB value
+constexpr QRgb antdHex(const char (&hex)[8])
+{
+    return 0xff000000u
+         | hexDigit(hex[1]) << 20 | hexDigit(hex[2]) << 16
+         | hexDigit(hex[3]) << 12 | hexDigit(hex[4]) << 8
+         | hexDigit(hex[5]) << 4  | hexDigit(hex[6]);
+}
+
+constexpr int gAntdColorCount = Antd::Info + 1;
+
+// Ant Design palette as {light, dark} pairs, indexed by Antd::Color then Antd::ThemeMode
+constexpr QRgb gAntdPalette[][2] = {
+    // Blue palette (Primary)
+    { antdHex("#f0f5ff"), antdHex("#111d2c") }, // Blue1
+    { antdHex("#d6e4ff"), antdHex("#112a45") }, // Blue2
+    { antdHex("#adc6ff"), antdHex("#15395b") }, // Blue3
+    { antdHex("#85a5ff"), antdHex("#164c7e") }, // Blue4
+    { antdHex("#597ef7"), antdHex("#1765ad") }, // Blue5
+    { antdHex("#2f54eb"), antdHex("#177ddc") }, // Blue6
+    { antdHex("#1d39c4"), antdHex("#3c9ae8") }, // Blue7
+    { antdHex("#10239e"), antdHex("#65b7f3") }, // Blue8
+    { antdHex("#061178"), antdHex("#8dcff8") }, // Blue9
+    { antdHex("#030852"), antdHex("#b7e3fa") }, // Blue10
+
+    // Gray palette (Neutral)
+    { antdHex("#ffffff"), antdHex("#141414") }, // Gray1
+    { antdHex("#fafafa"), antdHex("#1f1f1f") }, // Gray2
+    { antdHex("#f5f5f5"), antdHex("#262626") }, // Gray3
+    { antdHex("#f0f0f0"), antdHex("#434343") }, // Gray4
+    { antdHex("#d9d9d9"), antdHex("#595959") }, // Gray5
+    { antdHex("#bfbfbf"), antdHex("#8c8c8c") }, // Gray6
+    { antdHex("#8c8c8c"), antdHex("#bfbfbf") }, // Gray7
+    { antdHex("#595959"), antdHex("#d9d9d9") }, // Gray8
+    { antdHex("#434343"), antdHex("#f0f0f0") }, // Gray9
+    { antdHex("#262626"), antdHex("#f5f5f5") }, // Gray10
+    { antdHex("#1f1f1f"), antdHex("#fafafa") }, // Gray11
+    { antdHex("#141414"), antdHex("#ffffff") }, // Gray12
+    { antdHex("#000000"), antdHex("#ffffff") }, // Gray13
+
+    // Red palette (for Error)
+    { antdHex("#fff1f0"), antdHex("#2a1215") }, // Red1
+    { antdHex("#ffccc7"), antdHex("#58181c") }, // Red2
+    { antdHex("#ffa39e"), antdHex("#791a1f") }, // Red3
+    { antdHex("#ff7875"), antdHex("#a61d24") }, // Red4
+    { antdHex("#ff4d4f"), antdHex("#cf1322") }, // Red5
+    { antdHex("#f5222d"), antdHex("#d4380d") }, // Red6
+    { antdHex("#cf1322"), antdHex("#ad2102") }, // Red7
+    { antdHex("#a8071a"), antdHex("#871400") }, // Red8
+    { antdHex("#820014"), antdHex("#610b00") }, // Red9
+    { antdHex("#5c0011"), antdHex("#400000") }, // Red10
+
+    // Semantic colors
+    { antdHex("#52c41a"), antdHex("#389e0d") }, // Success
+    { antdHex("#faad14"), antdHex("#d48806") }, // Warning
+    { antdHex("#ff4d4f"), antdHex("#cf1322") }, // Error
+    { antdHex("#1890ff"), antdHex("#177ddc") }, // Info
+};
+
+static_assert(sizeof(gAntdPalette) / sizeof(gAntdPalette[0]) == gAntdColorCount,
+              "gAntdPalette must have one entry per Antd::Color");
+static_assert(Antd::Light == 0 && Antd::Dark == 1,
+              "gAntdPalette columns are indexed by Antd::ThemeMode");
+static_assert(antdHex("#2f54eb") == 0xff2f54ebu, "antdHex must parse #rrggbb");
+}
+
 QtAntdThemePrivate::QtAntdThemePrivate(QtAntdTheme *q)
-    : q_ptr(q), themeMode(Antd::Light)
+    : q_ptr(q), tokens(nullptr), overrideMask(0), themeMode(Antd::Light), generation(++gThemeGeneration)
 {
-    initializeColorPalette();
+    applyThemeMode(Antd::Light);
 }
 
 QtAntdThemePrivate::~QtAntdThemePrivate() {}
 
+void QtAntdThemePrivate::bumpGeneration()
+{
+    generation = ++gThemeGeneration;
+}
+
+void QtAntdThemePrivate::setOverride(Antd::ColorToken token, const QColor &color)
+{
+    overrides[token] = color;
+    overrideMask |= Q_UINT64_C(1) << token;
+}
+
+namespace {
+// String keys of the built-in tokens, indexed by Antd::ColorToken
+const char *const gColorTokenNames[Antd::ColorTokenCount] = {
+    "primary",
+    "primary-hover",
+    "primary-active",
+    "primary-outline",
+    "primary-background",
+    "secondary",
+    "secondary-hover",
+    "secondary-active",
+    "text",
+    "text-secondary",
+    "text-tertiary",
+    "text-quaternary",
+    "text-disabled",
+    "background",
+    "background-secondary",
+    "surface",
+    "surface-variant",
+    "border",
+    "border-secondary",
+    "border-variant",
+    "success",
+    "warning",
+    "error",
+    "info",
+    "error-hover",
+    "error-active",
+    "error-background",
+    "disabled",
+    "disabled-background",
+};
+}
+
 QColor QtAntdThemePrivate::rgba(int r, int g, int b, qreal a) const
 {
     QColor color(r, g, b);
@@ -26,169 +151,138 @@ QColor QtAntdThemePrivate::rgba(int r, int g, int b, qreal a) const
     return color;
 }
 
-QColor QtAntdThemePrivate::hex(const QString &hex) const
+QColor QtAntdThemePrivate::paletteColor(Antd::ThemeMode mode, Antd::Color color)
 {
-    return QColor(hex);
+    Q_ASSERT(color >= 0 && color < gAntdColorCount);
+    return QColor::fromRgba(gAntdPalette[color][mode]);
 }
 
-void QtAntdThemePrivate::initializeColorPalette()
+QColor QtAntdThemePrivate::getAntdColor(Antd::Color color) const
 {
-    // Blue palette (Primary)
-    colorPalette[Antd::Blue1] = QPair<QColor, QColor>(hex("#f0f5ff"), hex("#111d2c"));
-    colorPalette[Antd::Blue2] = QPair<QColor, QColor>(hex("#d6e4ff"), hex("#112a45"));
-    colorPalette[Antd::Blue3] = QPair<QColor, QColor>(hex("#adc6ff"), hex("#15395b"));
-    colorPalette[Antd::Blue4] = QPair<QColor, QColor>(hex("#85a5ff"), hex("#164c7e"));
-    colorPalette[Antd::Blue5] = QPair<QColor, QColor>(hex("#597ef7"), hex("#1765ad"));
-    colorPalette[Antd::Blue6] = QPair<QColor, QColor>(hex("#2f54eb"), hex("#177ddc"));
-    colorPalette[Antd::Blue7] = QPair<QColor, QColor>(hex("#1d39c4"), hex("#3c9ae8"));
-    colorPalette[Antd::Blue8] = QPair<QColor, QColor>(hex("#10239e"), hex("#65b7f3"));
-    colorPalette[Antd::Blue9] = QPair<QColor, QColor>(hex("#061178"), hex("#8dcff8"));
-    colorPalette[Antd::Blue10] = QPair<QColor, QColor>(hex("#030852"), hex("#b7e3fa"));
-    
-    // Gray palette (Neutral)
-    colorPalette[Antd::Gray1] = QPair<QColor, QColor>(hex("#ffffff"), hex("#141414"));
-    colorPalette[Antd::Gray2] = QPair<QColor, QColor>(hex("#fafafa"), hex("#1f1f1f"));
-    colorPalette[Antd::Gray3] = QPair<QColor, QColor>(hex("#f5f5f5"), hex("#262626"));
-    colorPalette[Antd::Gray4] = QPair<QColor, QColor>(hex("#f0f0f0"), hex("#434343"));
-    colorPalette[Antd::Gray5] = QPair<QColor, QColor>(hex("#d9d9d9"), hex("#595959"));
-    colorPalette[Antd::Gray6] = QPair<QColor, QColor>(hex("#bfbfbf"), hex("#8c8c8c"));
-    colorPalette[Antd::Gray7] = QPair<QColor, QColor>(hex("#8c8c8c"), hex("#bfbfbf"));
-    colorPalette[Antd::Gray8] = QPair<QColor, QColor>(hex("#595959"), hex("#d9d9d9"));
-    colorPalette[Antd::Gray9] = QPair<QColor, QColor>(hex("#434343"), hex("#f0f0f0"));
-    colorPalette[Antd::Gray10] = QPair<QColor, QColor>(hex("#262626"), hex("#f5f5f5"));
-    colorPalette[Antd::Gray11] = QPair<QColor, QColor>(hex("#1f1f1f"), hex("#fafafa"));
-    colorPalette[Antd::Gray12] = QPair<QColor, QColor>(hex("#141414"), hex("#ffffff"));
-    colorPalette[Antd::Gray13] = QPair<QColor, QColor>(hex("#000000"), hex("#ffffff"));
+    return paletteColor(themeMode, color);
+}
 
-    // Red palette (for Error)
-    colorPalette[Antd::Red1] = QPair<QColor, QColor>(hex("#fff1f0"), hex("#2a1215"));
-    colorPalette[Antd::Red2] = QPair<QColor, QColor>(hex("#ffccc7"), hex("#58181c"));
-    colorPalette[Antd::Red3] = QPair<QColor, QColor>(hex("#ffa39e"), hex("#791a1f"));
-    colorPalette[Antd::Red4] = QPair<QColor, QColor>(hex("#ff7875"), hex("#a61d24"));
-    colorPalette[Antd::Red5] = QPair<QColor, QColor>(hex("#ff4d4f"), hex("#cf1322"));
-    colorPalette[Antd::Red6] = QPair<QColor, QColor>(hex("#f5222d"), hex("#d4380d"));
-    colorPalette[Antd::Red7] = QPair<QColor, QColor>(hex("#cf1322"), hex("#ad2102"));
-    colorPalette[Antd::Red8] = QPair<QColor, QColor>(hex("#a8071a"), hex("#871400"));
-    colorPalette[Antd::Red9] = QPair<QColor, QColor>(hex("#820014"), hex("#610b00"));
-    colorPalette[Antd::Red10] = QPair<QColor, QColor>(hex("#5c0011"), hex("#400000"));
-    
-    // Semantic colors
-    colorPalette[Antd::Success] = QPair<QColor, QColor>(hex("#52c41a"), hex("#389e0d"));
-    colorPalette[Antd::Warning] = QPair<QColor, QColor>(hex("#faad14"), hex("#d48806"));
-    colorPalette[Antd::Error] = QPair<QColor, QColor>(hex("#ff4d4f"), hex("#cf1322"));
-    colorPalette[Antd::Info] = QPair<QColor, QColor>(hex("#1890ff"), hex("#177ddc"));
+const QColor *QtAntdThemePrivate::baseTokens(Antd::ThemeMode mode)
+{
+    // Both resolved tables are built once per process and shared by every theme
+    struct TokenTables {
+        TokenTables()
+        {
+            initializeLightTheme(tables[Antd::Light]);
+            initializeDarkTheme(tables[Antd::Dark]);
+        }
+        QColor tables[2][Antd::ColorTokenCount];
+    };
+    static const TokenTables tokenTables;
+
+    return tokenTables.tables[mode];
 }
 
-QColor QtAntdThemePrivate::getAntdColor(Antd::Color color) const
+void QtAntdThemePrivate::applyThemeMode(Antd::ThemeMode mode)
 {
-    if (!colorPalette.contains(color)) {
-        return QColor();
-    }
-    
-    return themeMode == Antd::Light 
-        ? colorPalette[color].first 
-        : colorPalette[color].second;
+    themeMode = mode;
+    tokens = baseTokens(mode);
 }
 
-void QtAntdThemePrivate::initializeLightTheme()
+void QtAntdThemePrivate::initializeLightTheme(QColor *tokens)
 {
     // Primary colors
-    colors["primary"] = getAntdColor(Antd::Blue6);
-    colors["primary-hover"] = getAntdColor(Antd::Blue5);
-    colors["primary-active"] = getAntdColor(Antd::Blue7);
-    colors["primary-outline"] = getAntdColor(Antd::Blue1);
+    tokens[Antd::ColorPrimary] = paletteColor(Antd::Light, Antd::Blue6);
+    tokens[Antd::ColorPrimaryHover] = paletteColor(Antd::Light, Antd::Blue5);
+    tokens[Antd::ColorPrimaryActive] = paletteColor(Antd::Light, Antd::Blue7);
+    tokens[Antd::ColorPrimaryOutline] = paletteColor(Antd::Light, Antd::Blue1);
     
     // Secondary colors
-    colors["secondary"] = getAntdColor(Antd::Gray6);
-    colors["secondary-hover"] = getAntdColor(Antd::Gray5);
-    colors["secondary-active"] = getAntdColor(Antd::Gray7);
+    tokens[Antd::ColorSecondary] = paletteColor(Antd::Light, Antd::Gray6);
+    tokens[Antd::ColorSecondaryHover] = paletteColor(Antd::Light, Antd::Gray5);
+    tokens[Antd::ColorSecondaryActive] = paletteColor(Antd::Light, Antd::Gray7);
     
     // Text colors
-    colors["text"] = getAntdColor(Antd::Gray13);
-    colors["text-secondary"] = getAntdColor(Antd::Gray8);
-    colors["text-tertiary"] = getAntdColor(Antd::Gray7);
-    colors["text-quaternary"] = getAntdColor(Antd::Gray6);
-    colors["text-disabled"] = getAntdColor(Antd::Gray5);
+    tokens[Antd::ColorText] = paletteColor(Antd::Light, Antd::Gray13);
+    tokens[Antd::ColorTextSecondary] = paletteColor(Antd::Light, Antd::Gray8);
+    tokens[Antd::ColorTextTertiary] = paletteColor(Antd::Light, Antd::Gray7);
+    tokens[Antd::ColorTextQuaternary] = paletteColor(Antd::Light, Antd::Gray6);
+    tokens[Antd::ColorTextDisabled] = paletteColor(Antd::Light, Antd::Gray5);
     
     // Background colors
-    colors["background"] = getAntdColor(Antd::Gray1);
-    colors["background-secondary"] = getAntdColor(Antd::Gray2);
-    colors["surface"] = getAntdColor(Antd::Gray1);
-    colors["surface-variant"] = getAntdColor(Antd::Gray3);
+    tokens[Antd::ColorBackground] = paletteColor(Antd::Light, Antd::Gray1);
+    tokens[Antd::ColorBackgroundSecondary] = paletteColor(Antd::Light, Antd::Gray2);
+    tokens[Antd::ColorSurface] = paletteColor(Antd::Light, Antd::Gray1);
+    tokens[Antd::ColorSurfaceVariant] = paletteColor(Antd::Light, Antd::Gray3);
     
     // Border colors
-    colors["border"] = getAntdColor(Antd::Gray5);
-    colors["border-secondary"] = getAntdColor(Antd::Gray4);
-    colors["border-variant"] = getAntdColor(Antd::Gray3);
+    tokens[Antd::ColorBorder] = paletteColor(Antd::Light, Antd::Gray5);
+    tokens[Antd::ColorBorderSecondary] = paletteColor(Antd::Light, Antd::Gray4);
+    tokens[Antd::ColorBorderVariant] = paletteColor(Antd::Light, Antd::Gray3);
     
     // Status colors
-    colors["success"] = getAntdColor(Antd::Success);
-    colors["warning"] = getAntdColor(Antd::Warning);
-    colors["error"] = getAntdColor(Antd::Error);
-    colors["info"] = getAntdColor(Antd::Info);
+    tokens[Antd::ColorSuccess] = paletteColor(Antd::Light, Antd::Success);
+    tokens[Antd::ColorWarning] = paletteColor(Antd::Light, Antd::Warning);
+    tokens[Antd::ColorError] = paletteColor(Antd::Light, Antd::Error);
+    tokens[Antd::ColorInfo] = paletteColor(Antd::Light, Antd::Info);
     
     // Status hover/active states
-    colors["error-hover"] = getAntdColor(Antd::Red4);  // Light background for error hover
-    colors["error-active"] = QColor("#d9363e");  // Even lighter for active
-    colors["error-background"] = getAntdColor(Antd::Red1); // Very light background
+    tokens[Antd::ColorErrorHover] = paletteColor(Antd::Light, Antd::Red4);  // Light background for error hover
+    tokens[Antd::ColorErrorActive] = QColor::fromRgba(antdHex("#d9363e"));  // Even lighter for active
+    tokens[Antd::ColorErrorBackground] = paletteColor(Antd::Light, Antd::Red1); // Very light background
     
     // Primary background for non-filled buttons
-    colors["primary-background"] = getAntdColor(Antd::Blue1);
+    tokens[Antd::ColorPrimaryBackground] = paletteColor(Antd::Light, Antd::Blue1);
     
     // Disabled state
-    colors["disabled"] = getAntdColor(Antd::Gray5);
-    colors["disabled-background"] = getAntdColor(Antd::Gray2);
+    tokens[Antd::ColorDisabled] = paletteColor(Antd::Light, Antd::Gray5);
+    tokens[Antd::ColorDisabledBackground] = paletteColor(Antd::Light, Antd::Gray2);
     
 }
 
-void QtAntdThemePrivate::initializeDarkTheme()
+void QtAntdThemePrivate::initializeDarkTheme(QColor *tokens)
 {
     // Primary colors (inverted for dark mode)
-    colors["primary"] = getAntdColor(Antd::Blue6);
-    colors["primary-hover"] = getAntdColor(Antd::Blue7);
-    colors["primary-active"] = getAntdColor(Antd::Blue5);
-    colors["primary-outline"] = getAntdColor(Antd::Blue1);
+    tokens[Antd::ColorPrimary] = paletteColor(Antd::Dark, Antd::Blue6);
+    tokens[Antd::ColorPrimaryHover] = paletteColor(Antd::Dark, Antd::Blue7);
+    tokens[Antd::ColorPrimaryActive] = paletteColor(Antd::Dark, Antd::Blue5);
+    tokens[Antd::ColorPrimaryOutline] = paletteColor(Antd::Dark, Antd::Blue1);
     
     // Secondary colors
-    colors["secondary"] = getAntdColor(Antd::Gray6);
-    colors["secondary-hover"] = getAntdColor(Antd::Gray7);
-    colors["secondary-active"] = getAntdColor(Antd::Gray5);
+    tokens[Antd::ColorSecondary] = paletteColor(Antd::Dark, Antd::Gray6);
+    tokens[Antd::ColorSecondaryHover] = paletteColor(Antd::Dark, Antd::Gray7);
+    tokens[Antd::ColorSecondaryActive] = paletteColor(Antd::Dark, Antd::Gray5);
     
     // Text colors (inverted)
-    colors["text"] = getAntdColor(Antd::Gray1);
-    colors["text-secondary"] = getAntdColor(Antd::Gray8);
-    colors["text-tertiary"] = getAntdColor(Antd::Gray7);
-    colors["text-quaternary"] = getAntdColor(Antd::Gray6);
-    colors["text-disabled"] = getAntdColor(Antd::Gray5);
+    tokens[Antd::ColorText] = paletteColor(Antd::Dark, Antd::Gray1);
+    tokens[Antd::ColorTextSecondary] = paletteColor(Antd::Dark, Antd::Gray8);
+    tokens[Antd::ColorTextTertiary] = paletteColor(Antd::Dark, Antd::Gray7);
+    tokens[Antd::ColorTextQuaternary] = paletteColor(Antd::Dark, Antd::Gray6);
+    tokens[Antd::ColorTextDisabled] = paletteColor(Antd::Dark, Antd::Gray5);
     
     // Background colors (dark)
-    colors["background"] = getAntdColor(Antd::Gray12);
-    colors["background-secondary"] = getAntdColor(Antd::Gray11);
-    colors["surface"] = getAntdColor(Antd::Gray11);
-    colors["surface-variant"] = getAntdColor(Antd::Gray10);
+    tokens[Antd::ColorBackground] = paletteColor(Antd::Dark, Antd::Gray12);
+    tokens[Antd::ColorBackgroundSecondary] = paletteColor(Antd::Dark, Antd::Gray11);
+    tokens[Antd::ColorSurface] = paletteColor(Antd::Dark, Antd::Gray11);
+    tokens[Antd::ColorSurfaceVariant] = paletteColor(Antd::Dark, Antd::Gray10);
     
     // Border colors (darker)
-    colors["border"] = getAntdColor(Antd::Gray5);
-    colors["border-secondary"] = getAntdColor(Antd::Gray4);
-    colors["border-variant"] = getAntdColor(Antd::Gray3);
+    tokens[Antd::ColorBorder] = paletteColor(Antd::Dark, Antd::Gray5);
+    tokens[Antd::ColorBorderSecondary] = paletteColor(Antd::Dark, Antd::Gray4);
+    tokens[Antd::ColorBorderVariant] = paletteColor(Antd::Dark, Antd::Gray3);
     
     // Status colors (adjusted for dark mode)
-    colors["success"] = getAntdColor(Antd::Success);
-    colors["warning"] = getAntdColor(Antd::Warning);
-    colors["error"] = getAntdColor(Antd::Error);
-    colors["info"] = getAntdColor(Antd::Info);
+    tokens[Antd::ColorSuccess] = paletteColor(Antd::Dark, Antd::Success);
+    tokens[Antd::ColorWarning] = paletteColor(Antd::Dark, Antd::Warning);
+    tokens[Antd::ColorError] = paletteColor(Antd::Dark, Antd::Error);
+    tokens[Antd::ColorInfo] = paletteColor(Antd::Dark, Antd::Info);
     
     // Status hover/active states for dark mode
-    colors["error-hover"] = getAntdColor(Antd::Gray9);   // Dark background for error hover
-    colors["error-active"] = getAntdColor(Antd::Gray10); // Even darker for active
-    colors["error-background"] = getAntdColor(Antd::Gray11); // Very dark background
+    tokens[Antd::ColorErrorHover] = paletteColor(Antd::Dark, Antd::Gray9);   // Dark background for error hover
+    tokens[Antd::ColorErrorActive] = paletteColor(Antd::Dark, Antd::Gray10); // Even darker for active
+    tokens[Antd::ColorErrorBackground] = paletteColor(Antd::Dark, Antd::Gray11); // Very dark background
     
     // Primary background for non-filled buttons in dark mode
-    colors["primary-background"] = getAntdColor(Antd::Blue10);
+    tokens[Antd::ColorPrimaryBackground] = paletteColor(Antd::Dark, Antd::Blue10);
     
     // Disabled state
-    colors["disabled"] = getAntdColor(Antd::Gray5);
-    colors["disabled-background"] = getAntdColor(Antd::Gray11);
+    tokens[Antd::ColorDisabled] = paletteColor(Antd::Dark, Antd::Gray5);
+    tokens[Antd::ColorDisabledBackground] = paletteColor(Antd::Dark, Antd::Gray11);
     
 }
 
@@ -201,8 +295,7 @@ QtAntdTheme::QtAntdTheme(QObject *parent)
     , d_ptr(new QtAntdThemePrivate(this))
 {
     Q_D(QtAntdTheme);
-    d->themeMode = Antd::Light;
-    d->initializeLightTheme();
+    d->applyThemeMode(Antd::Light);
 }
 
 QtAntdTheme::QtAntdTheme(Antd::ThemeMode mode, QObject *parent)
@@ -210,12 +303,7 @@ QtAntdTheme::QtAntdTheme(Antd::ThemeMode mode, QObject *parent)
     , d_ptr(new QtAntdThemePrivate(this))
 {
     Q_D(QtAntdTheme);
-    d->themeMode = mode;
-    if (mode == Antd::Dark) {
-        d->initializeDarkTheme();
-    } else {
-        d->initializeLightTheme();
-    }
+    d->applyThemeMode(mode);
 }
 
 QtAntdTheme::~QtAntdTheme() {}
@@ -230,16 +318,12 @@ void QtAntdTheme::setThemeMode(Antd::ThemeMode mode)
 {
     Q_D(QtAntdTheme);
     if (d->themeMode != mode) {
-        d->themeMode = mode;
-        
-        // Reinitialize colors based on new theme mode
-        if (mode == Antd::Dark) {
-            d->initializeDarkTheme();
-        } else {
-            d->initializeLightTheme();
-        }
+        // Both tables are pre-resolved; overrides stay layered on top
+        d->applyThemeMode(mode);
+        d->bumpGeneration();
         
         emit themeModeChanged(mode);
+        emit themeChanged();
     }
 }
 
@@ -247,11 +331,16 @@ QColor QtAntdTheme::getColor(const QString &key) const
 {
     Q_D(const QtAntdTheme);
 
-    if (!d->colors.contains(key)) {
+    const Antd::ColorToken token = colorToken(key);
+    if (token != Antd::ColorTokenCount) {
+        return d->tokenColor(token);
+    }
+
+    if (!d->customColors.contains(key)) {
         qWarning() << "A theme color matching the key '" << key << "' could not be found.";
         return QColor();
     }
-    return d->colors.value(key);
+    return d->customColors.value(key);
 }
 
 QColor QtAntdTheme::getColor(Antd::Color color) const
@@ -260,77 +349,122 @@ QColor QtAntdTheme::getColor(Antd::Color color) const
     return d->getAntdColor(color);
 }
 
+QColor QtAntdTheme::getColor(Antd::ColorToken token) const
+{
+    Q_D(const QtAntdTheme);
+    Q_ASSERT(token >= 0 && token < Antd::ColorTokenCount);
+    return d->tokenColor(token);
+}
+
 void QtAntdTheme::setColor(const QString &key, const QColor &color)
 {
     Q_D(QtAntdTheme);
-    d->colors.insert(key, color);
+
+    const Antd::ColorToken token = colorToken(key);
+    if (token != Antd::ColorTokenCount) {
+        d->setOverride(token, color);
+    } else {
+        d->customColors.insert(key, color);
+    }
+    d->bumpGeneration();
+    emit themeChanged();
 }
 
 void QtAntdTheme::setColor(const QString &key, Antd::Color color)
 {
     Q_D(QtAntdTheme);
-    d->colors.insert(key, d->getAntdColor(color));
+    setColor(key, d->getAntdColor(color));
+}
+
+void QtAntdTheme::setColor(Antd::ColorToken token, const QColor &color)
+{
+    Q_D(QtAntdTheme);
+    Q_ASSERT(token >= 0 && token < Antd::ColorTokenCount);
+    d->setOverride(token, color);
+    d->bumpGeneration();
+    emit themeChanged();
+}
+
+Antd::ColorToken QtAntdTheme::colorToken(const QString &key)
+{
+    // Built once; every later lookup is a single hash probe
+    static const QHash<QString, int> tokenIndex = []() {
+        QHash<QString, int> index;
+        index.reserve(Antd::ColorTokenCount);
+        for (int i = 0; i < Antd::ColorTokenCount; ++i) {
+            index.insert(QString::fromLatin1(gColorTokenNames[i]), i);
+        }
+        return index;
+    }();
+
+    return static_cast<Antd::ColorToken>(tokenIndex.value(key, Antd::ColorTokenCount));
+}
+
+quint64 QtAntdTheme::generation() const
+{
+    Q_D(const QtAntdTheme);
+    return d->generation;
 }
 
 // Predefined semantic color getters
 QColor QtAntdTheme::primary() const
 {
-    return getColor("primary");
+    return getColor(Antd::ColorPrimary);
 }
 
 QColor QtAntdTheme::secondary() const
 {
-    return getColor("secondary");
+    return getColor(Antd::ColorSecondary);
 }
 
 QColor QtAntdTheme::success() const
 {
-    return getColor("success");
+    return getColor(Antd::ColorSuccess);
 }
 
 QColor QtAntdTheme::warning() const
 {
-    return getColor("warning");
+    return getColor(Antd::ColorWarning);
 }
 
 QColor QtAntdTheme::error() const
 {
-    return getColor("error");
+    return getColor(Antd::ColorError);
 }
 
 QColor QtAntdTheme::info() const
 {
-    return getColor("info");
+    return getColor(Antd::ColorInfo);
 }
 
 QColor QtAntdTheme::text() const
 {
-    return getColor("text");
+    return getColor(Antd::ColorText);
 }
 
 QColor QtAntdTheme::textSecondary() const
 {
-    return getColor("text-secondary");
+    return getColor(Antd::ColorTextSecondary);
 }
 
 QColor QtAntdTheme::background() const
 {
-    return getColor("background");
+    return getColor(Antd::ColorBackground);
 }
 
 QColor QtAntdTheme::surface() const
 {
-    return getColor("surface");
+    return getColor(Antd::ColorSurface);
 }
 
 QColor QtAntdTheme::border() const
 {
-    return getColor("border");
+    return getColor(Antd::ColorBorder);
 }
 
 QColor QtAntdTheme::disabled() const
 {
-    return getColor("disabled");
+    return getColor(Antd::ColorDisabled);
 }
 
 // Static theme creation methods
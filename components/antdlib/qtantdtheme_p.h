@@ -7,6 +7,8 @@
 
 class QtAntdTheme;
 
+static_assert(Antd::ColorTokenCount <= 64, "overrideMask holds one bit per color token");
+
 class QtAntdThemePrivate
 {
     Q_DISABLE_COPY(QtAntdThemePrivate)
@@ -17,18 +19,29 @@ public:
     ~QtAntdThemePrivate();
 
     QColor rgba(int r, int g, int b, qreal a = 1.0) const;
-    QColor hex(const QString &hex) const;
     
-    void initializeLightTheme();
-    void initializeDarkTheme();
-    void initializeColorPalette();
+    static void initializeLightTheme(QColor *tokens);
+    static void initializeDarkTheme(QColor *tokens);
+    static const QColor *baseTokens(Antd::ThemeMode mode);
+    static QColor paletteColor(Antd::ThemeMode mode, Antd::Color color);
     
     QColor getAntdColor(Antd::Color color) const;
+    void applyThemeMode(Antd::ThemeMode mode);
+    void bumpGeneration();
+    void setOverride(Antd::ColorToken token, const QColor &color);
+
+    inline QColor tokenColor(Antd::ColorToken token) const
+    {
+        return (overrideMask & (Q_UINT64_C(1) << token)) ? overrides[token] : tokens[token];
+    }
 
     QtAntdTheme *const q_ptr;
-    QHash<QString, QColor> colors;
-    QHash<Antd::Color, QPair<QColor, QColor>> colorPalette; // Light, Dark pairs
+    const QColor *tokens;                       // Shared base table of the active mode
+    QColor overrides[Antd::ColorTokenCount];    // setColor() values, kept across mode switches
+    quint64 overrideMask;                       // Bit per token that has an override
+    QHash<QString, QColor> customColors;        // Keys that are not built-in tokens
     Antd::ThemeMode themeMode;
+    quint64 generation;
 };
 
 #endif  // QtAntdTheme_P_H
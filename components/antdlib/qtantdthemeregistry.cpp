@@ -0,0 +1,56 @@
+#include "qtantdthemeregistry_p.h"
+#include "qtantdinstrumentation_p.h"
+
+#include <QCoreApplication>
+#include <QWidget>
+
+namespace QtAntdInternal {
+
+ThemeRegistry &ThemeRegistry::instance()
+{
+    static ThemeRegistry registry;
+    return registry;
+}
+
+ThemeRegistry::ThemeRegistry()
+    : QObject()
+    , m_repaintPending(false)
+{
+}
+
+void ThemeRegistry::registerWidget(QWidget *widget)
+{
+    m_widgets.insert(widget);
+}
+
+void ThemeRegistry::unregisterWidget(QWidget *widget)
+{
+    m_widgets.remove(widget);
+}
+
+void ThemeRegistry::scheduleRepaint()
+{
+    if (m_repaintPending || m_widgets.isEmpty() || !QCoreApplication::instance()) {
+        return;
+    }
+
+    m_repaintPending = true;
+    QMetaObject::invokeMethod(this, [this]() { flush(); }, Qt::QueuedConnection);
+}
+
+void ThemeRegistry::flush()
+{
+    m_repaintPending = false;
+
+    // Hidden widgets are skipped: they repaint when shown, and their color
+    // caches are keyed on the theme generation anyway. All updates land in the
+    // same paint pass, so their order does not matter.
+    const QSet<QWidget *> &widgets = m_widgets;
+    for (QWidget *widget : widgets) {
+        if (widget->isVisible()) {
+            requestUpdate(widget);
+        }
+    }
+}
+
+} // namespace QtAntdInternal
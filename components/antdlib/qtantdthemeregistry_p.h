@@ -0,0 +1,36 @@
+#ifndef QtAntdThemeRegistry_P_H
+#define QtAntdThemeRegistry_P_H
+
+#include <QObject>
+#include <QSet>
+
+class QWidget;
+
+namespace QtAntdInternal {
+
+// Keeps track of live QtAntd widgets so that a theme change can repaint them.
+// Repaints are coalesced: any number of scheduleRepaint() calls during one
+// event-loop turn result in a single update() per widget on the next turn.
+class ThemeRegistry : public QObject
+{
+public:
+    static ThemeRegistry &instance();
+
+    void registerWidget(QWidget *widget);
+    void unregisterWidget(QWidget *widget);
+
+    void scheduleRepaint();
+
+private:
+    ThemeRegistry();
+    Q_DISABLE_COPY(ThemeRegistry)
+
+    void flush();
+
+    QSet<QWidget *> m_widgets;
+    bool m_repaintPending;
+};
+
+} // namespace QtAntdInternal
+
+#endif  // QtAntdThemeRegistry_P_H
@@ -1,108 +1,444 @@
 #include "qtantdbutton.h"
 #include "qtantdbutton_p.h"
+#include "antdlib/qtantdthemeregistry_p.h"
+#include "antdlib/qtantdinstrumentation_p.h"
 
 #include "qtantdstyle.h"
 #include "antdlib/qtantdrippleoverlay_p.h"
+#include "antdlib/qtantdspinneratlas_p.h"
+#include "antdlib/qtantdtextcache_p.h"
+#include "antdlib/qtantdchrome_p.h"
 #include <QPainter>
 #include <QFontMetrics>
 #include <QApplication>
 #include <QMouseEvent>
-#include <QStyleOptionButton>
 #include <QEnterEvent>
-#include <QTimer>
 #include <QtMath>
 #include <QDebug>
 #include <QPainterPath>
 #include <QElapsedTimer>
-#include <unordered_map>
+#include <QStyle>
+#include <QStyleOptionButton>
 static int gAntdWaveExpandDistance = 6;
 
-const std::unordered_map<QtAntdButton::ButtonSize, int> buttonSize2ExtraWidth = {
-    { QtAntdButton::Small,  -12 },
-    { QtAntdButton::Medium, 0 },
-    { QtAntdButton::Large,  16 }
-};
+// Extra width/height per ButtonSize, indexed by QtAntdButton::ButtonSize
+static const int buttonSize2ExtraWidth[] = { -12, 0, 16 };
+static const int buttonSize2ExtraHeight[] = { -6, 0, 8 };
 
-const std::unordered_map<QtAntdButton::ButtonSize, int> buttonSize2ExtraHeight = {
-    { QtAntdButton::Small,  -6 },
-    { QtAntdButton::Medium, 0 },
-    { QtAntdButton::Large,  8 }
-};
+namespace {
 
-QtAntdStyle &style = QtAntdStyle::instance();
-static const std::unordered_map<QtAntdButton::ColorPreset, QColor> preset2brandBaseColor = {
-    // { QtAntdButton::PresetDefault, QColor("#000000") },
-    { QtAntdButton::PresetPrimary, style.themeColor("primary") },
-    { QtAntdButton::PresetDanger,  style.themeColor("error") },
-    { QtAntdButton::PresetDefault, style.themeColor("primary") }, // Default unified to primary
-    { QtAntdButton::PresetPink,   QColor("#eb2f96") },
-    { QtAntdButton::PresetPurple, QColor("#722ed1") },
-    { QtAntdButton::PresetCyan,   QColor("#13c2c2") }
-};
+const int gColorPresetCount = QtAntdButton::PresetCyan + 1;
 
-static const std::unordered_map<QtAntdButton::ColorPreset, QColor> preset2brandHoverColor = {
-    // { QtAntdButton::PresetDefault, QColor("#404040") },
-    { QtAntdButton::PresetPrimary, style.themeColor("primary-hover") },
-    { QtAntdButton::PresetDanger,  style.themeColor("error-hover") },
-    { QtAntdButton::PresetDefault, style.themeColor("primary-hover") },
-    { QtAntdButton::PresetPink,   QColor("#ff85c0") },
-    { QtAntdButton::PresetPurple, QColor("#9254de") },
-    { QtAntdButton::PresetCyan,   QColor("#36cfc9") }
+// Weak (hover) backgrounds per ColorPreset as {light, dark}. Kept as packed ARGB so
+// rebuilding the preset table never parses color strings.
+const QRgb gPresetWeakColors[gColorPresetCount][2] = {
+    { 0xfff0f5ff, 0xff111d2c }, // PresetDefault (unified to primary)
+    { 0xfff0f5ff, 0xff111d2c }, // PresetPrimary
+    { 0xfffff2f0, 0xff2c1618 }, // PresetDanger
+    { 0xfffff0f6, 0xff291321 }, // PresetPink
+    { 0xfff9f0ff, 0xff1a1325 }, // PresetPurple
+    { 0xffe6fffb, 0xff112123 }, // PresetCyan
 };
 
-static const std::unordered_map<QtAntdButton::ColorPreset, QColor> preset2brandActiveColor = {
-    // { QtAntdButton::PresetDefault, QColor("#0d0d0d") },
-    { QtAntdButton::PresetPrimary, style.themeColor("primary-active") },
-    { QtAntdButton::PresetDanger,  style.themeColor("error-active") },
-    { QtAntdButton::PresetDefault, style.themeColor("primary-active") },
-    { QtAntdButton::PresetPink,   QColor("#c41d7f") },
-    { QtAntdButton::PresetPurple, QColor("#531dab") },
-    { QtAntdButton::PresetCyan,   QColor("#08979c") }
+// Brand colors per ColorPreset. Built on first use rather than during static
+// initialization, and rebuilt whenever the theme generation changes. One copy
+// per painting thread.
+struct PresetColors
+{
+    QColor base[gColorPresetCount];
+    QColor hover[gColorPresetCount];
+    QColor active[gColorPresetCount];
+    QColor weak[gColorPresetCount];
+    QColor weakActive[gColorPresetCount];
+    // Pressed background of danger buttons; PresetDanger alone uses weakActive
+    QColor dangerWeakActive;
+    quint64 generation { 0 };
 };
 
-static const std::unordered_map<QtAntdButton::ColorPreset, QColor> preset2brandWeakColor = {
-    // { QtAntdButton::PresetDefault, QColor("#e5e5e5") },
-    { QtAntdButton::PresetDanger,  QColor("#fff2f0") },
-    { QtAntdButton::PresetPink,    QColor("#fff0f6") },
-    { QtAntdButton::PresetPurple,  QColor("#f9f0ff") },
-    { QtAntdButton::PresetCyan,    QColor("#e6fffb") },
-    { QtAntdButton::PresetPrimary, QColor("#f0f5ff") },
-    { QtAntdButton::PresetDefault, QColor("#f0f5ff") }
-};
+const PresetColors &presetColors()
+{
+    thread_local PresetColors colors;
 
-// Helper: compute base brand color according to preset
-static QColor brandBaseForPreset(QtAntdButton::ColorPreset preset) {
-    if(preset2brandBaseColor.find(preset) != preset2brandBaseColor.end()) {
-        return preset2brandBaseColor.at(preset);
+    QtAntdStyle &style = QtAntdStyle::instance();
+    const quint64 generation = style.themeGeneration();
+    if (colors.generation == generation) {
+        return colors;
     }
-    return QtAntdStyle::instance().themeColor("primary");
-}
 
-static QColor brandHoverForPreset(QtAntdButton::ColorPreset preset) {
-    if(preset2brandHoverColor.find(preset) != preset2brandHoverColor.end()) {
-        return preset2brandHoverColor.at(preset);
+    const QColor primary = style.themeColor(Antd::ColorPrimary);
+    const QColor primaryHover = style.themeColor(Antd::ColorPrimaryHover);
+    const QColor primaryActive = style.themeColor(Antd::ColorPrimaryActive);
+
+    // Default is unified to primary
+    colors.base[QtAntdButton::PresetDefault] = primary;
+    colors.hover[QtAntdButton::PresetDefault] = primaryHover;
+    colors.active[QtAntdButton::PresetDefault] = primaryActive;
+
+    colors.base[QtAntdButton::PresetPrimary] = primary;
+    colors.hover[QtAntdButton::PresetPrimary] = primaryHover;
+    colors.active[QtAntdButton::PresetPrimary] = primaryActive;
+
+    colors.base[QtAntdButton::PresetDanger] = style.themeColor(Antd::ColorError);
+    colors.hover[QtAntdButton::PresetDanger] = style.themeColor(Antd::ColorErrorHover);
+    colors.active[QtAntdButton::PresetDanger] = style.themeColor(Antd::ColorErrorActive);
+
+    colors.base[QtAntdButton::PresetPink] = QColor::fromRgb(0xeb2f96);
+    colors.hover[QtAntdButton::PresetPink] = QColor::fromRgb(0xff85c0);
+    colors.active[QtAntdButton::PresetPink] = QColor::fromRgb(0xc41d7f);
+
+    colors.base[QtAntdButton::PresetPurple] = QColor::fromRgb(0x722ed1);
+    colors.hover[QtAntdButton::PresetPurple] = QColor::fromRgb(0x9254de);
+    colors.active[QtAntdButton::PresetPurple] = QColor::fromRgb(0x531dab);
+
+    colors.base[QtAntdButton::PresetCyan] = QColor::fromRgb(0x13c2c2);
+    colors.hover[QtAntdButton::PresetCyan] = QColor::fromRgb(0x36cfc9);
+    colors.active[QtAntdButton::PresetCyan] = QColor::fromRgb(0x08979c);
+
+    const int mode = style.theme()->themeMode() == Antd::Dark ? 1 : 0;
+    for (int preset = 0; preset < gColorPresetCount; ++preset) {
+        colors.weak[preset] = QColor::fromRgba(gPresetWeakColors[preset][mode]);
+        colors.weakActive[preset] = colors.weak[preset].darker(105);
     }
-    return QtAntdStyle::instance().themeColor("primary-hover");
+    colors.dangerWeakActive = QColor::fromRgb(mode ? 0x58181c : 0xffccc7);
+
+    colors.generation = generation;
+    return colors;
 }
 
-static QColor brandActiveForPreset(QtAntdButton::ColorPreset preset) {
-    if(preset2brandActiveColor.find(preset) != preset2brandActiveColor.end()) {
-        return preset2brandActiveColor.at(preset);
+const int gButtonTypeCount = QtAntdButton::Link + 1;
+
+/*!
+ * \internal
+ * Compute background, border and text colors for one (type, preset, danger, state)
+ * combination. Only called while (re)building the color table.
+ */
+QtAntdButtonColors resolveButtonColors(QtAntdButton::ButtonType type,
+                                       QtAntdButton::ColorPreset preset,
+                                       bool danger,
+                                       int state)
+{
+    QtAntdStyle &style = QtAntdStyle::instance();
+    QtAntdButtonColors colors;
+
+    if (state == QtAntdButtonPrivate::DisabledState) {
+        colors.background = style.themeColor(Antd::ColorDisabledBackground);
+        colors.border = style.themeColor(Antd::ColorBorder);
+        colors.text = style.themeColor(Antd::ColorDisabled);
+        return colors;
     }
-    return QtAntdStyle::instance().themeColor("primary-active");
+
+    const bool hover = (state == QtAntdButtonPrivate::HoverState);
+    const bool pressed = (state == QtAntdButtonPrivate::PressedState);
+
+    // Danger flag overrides preset for simplicity; Default preset is treated as Primary
+    const PresetColors &presets = presetColors();
+    const int index = danger ? QtAntdButton::PresetDanger : preset;
+    const QColor &brand = presets.base[index];
+    const QColor &brandHover = presets.hover[index];
+    const QColor &brandActive = presets.active[index];
+    const QColor &weakBg = presets.weak[index];
+    const QColor &weakActiveBg = danger ? presets.dangerWeakActive : presets.weakActive[index];
+
+    const bool filled = (type == QtAntdButton::Primary);
+    const bool borderOnly = (type == QtAntdButton::Default || type == QtAntdButton::Dashed);
+    // Danger text/link buttons get a weak background like text buttons
+    const bool weakBackground = borderOnly || type == QtAntdButton::Text || danger;
+
+    const QColor transparent(255, 255, 255, 0);
+    const QColor &brandForState = pressed ? brandActive : (hover ? brandHover : brand);
+
+    if (filled) {
+        colors.background = brandForState;
+        colors.border = brandForState;
+        colors.text = Qt::white;
+        return colors;
+    }
+
+    colors.background = transparent;
+    if (weakBackground) {
+        if (pressed) {
+            colors.background = weakActiveBg;
+        } else if (hover) {
+            colors.background = weakBg;
+        }
+    }
+    colors.border = borderOnly ? brandForState : transparent;
+    colors.text = brandForState;
+    return colors;
 }
 
-static QColor brandWeakBgForPreset(QtAntdButton::ColorPreset preset) {
-    if(preset2brandWeakColor.find(preset) != preset2brandWeakColor.end()) {
-        return preset2brandWeakColor.at(preset);
+// Resolved colors for every (type, preset, danger, state) combination, rebuilt
+// once per theme generation so painting is a single indexed lookup.
+struct ButtonColorTable
+{
+    QtAntdButtonColors entries[gButtonTypeCount][gColorPresetCount][2][QtAntdButtonPrivate::ColorStateCount];
+    quint64 generation { 0 };
+};
+
+const ButtonColorTable &buttonColorTable()
+{
+    thread_local ButtonColorTable table;
+
+    const quint64 generation = QtAntdStyle::instance().themeGeneration();
+    if (table.generation == generation) {
+        return table;
     }
-    return QColor(255,255,255,0);
+
+    for (int type = 0; type < gButtonTypeCount; ++type) {
+        for (int preset = 0; preset < gColorPresetCount; ++preset) {
+            for (int danger = 0; danger < 2; ++danger) {
+                for (int state = 0; state < QtAntdButtonPrivate::ColorStateCount; ++state) {
+                    table.entries[type][preset][danger][state] =
+                        resolveButtonColors(static_cast<QtAntdButton::ButtonType>(type),
+                                            static_cast<QtAntdButton::ColorPreset>(preset),
+                                            danger != 0,
+                                            state);
+                }
+            }
+        }
+    }
+
+    table.generation = generation;
+    return table;
 }
 
+} // namespace
+
 const int horizontalPadding = 16;
 const int iconTextSpacing = 8;
 const int buttonMinimumHeight = 24;
-const int timerInterval = 30; // ms
+const qreal loadingDegreesPerMs = 0.5; // one revolution every 720ms
+
+namespace {
+
+int colorStateFor(bool enabled, bool pressed, bool hovered)
+{
+    if (!enabled) {
+        return QtAntdButtonPrivate::DisabledState;
+    }
+    if (pressed) {
+        return QtAntdButtonPrivate::PressedState;
+    }
+    return hovered ? QtAntdButtonPrivate::HoverState : QtAntdButtonPrivate::NormalState;
+}
+
+int spinnerSizeFor(QtAntdButton::ButtonSize size)
+{
+    switch (size) {
+        case QtAntdButton::Small:
+            return 12;
+        case QtAntdButton::Large:
+            return 16;
+        case QtAntdButton::Medium:
+        default:
+            return 14;
+    }
+}
+
+/*!
+ * \internal
+ * Style size of a push button around the text and icon of option, measured as
+ * QPushButton::sizeHint() does, including the menu indicator. option must have
+ * its text, icon, iconSize, fontMetrics and features set. This is the costly
+ * part of a size hint; QtAntdButton caches it with its content layout.
+ */
+QSize pushButtonStyleSize(const QStyleOptionButton &option, const QWidget *widget)
+{
+    const QStyle *style = widget ? widget->style() : QApplication::style();
+    const bool hasText = !option.text.isEmpty();
+
+    int w = 0;
+    int h = 0;
+    if (!option.icon.isNull()) {
+        w += option.iconSize.width() + 4;
+        h = option.iconSize.height();
+    }
+    if (option.features & QStyleOptionButton::HasMenu) {
+        w += style->pixelMetric(QStyle::PM_MenuButtonIndicator, &option, widget);
+    }
+    const QSize textSize = option.fontMetrics.size(Qt::TextShowMnemonic,
+                                                   hasText ? option.text : QStringLiteral("XXXX"));
+    if (hasText || !w) {
+        w += textSize.width();
+    }
+    if (hasText || !h) {
+        h = qMax(h, textSize.height());
+    }
+    QStyleOptionButton sized(option);
+    sized.rect.setSize(QSize(w, h));
+    return style->sizeFromContents(QStyle::CT_PushButton, &sized, QSize(w, h), widget);
+}
+
+/*!
+ * \internal
+ * Natural size of a button: styleSize adjusted for size, and widened for the
+ * content plus Ant Design padding. textWidth is the advance of the text and
+ * iconWidth the icon width, 0 without an icon. Shared by both
+ * QtAntdButton::sizeHint() overloads, so delegate cells are sized like the
+ * widget.
+ */
+QSize buttonSizeHint(const QSize &styleSize,
+                     int textWidth,
+                     int iconWidth,
+                     QtAntdButton::ButtonSize size,
+                     QtAntdButton::ButtonShape shape,
+                     bool loading)
+{
+    QSize hint = styleSize;
+    hint.setHeight(qMax(hint.height() + buttonSize2ExtraHeight[size], buttonMinimumHeight));
+    if (shape == QtAntdButton::Circle) {
+        return QSize(hint.height(), hint.height());
+    }
+
+    // The spinner replaces the icon while loading
+    const bool hasText = textWidth > 0;
+    int contentWidth = textWidth;
+    if (loading) {
+        contentWidth += spinnerSizeFor(size) + 8;
+        if (hasText) {
+            contentWidth += iconTextSpacing;
+        }
+    } else if (iconWidth > 0) {
+        contentWidth += iconWidth;
+        if (hasText) {
+            contentWidth += iconTextSpacing;
+        }
+    }
+    hint.setWidth(qMax(hint.width() + buttonSize2ExtraWidth[size], contentWidth + horizontalPadding));
+    return hint;
+}
+
+/*!
+ * \internal
+ * Shape, icon, spinner and text geometry inside rect. layout->text, textWidth
+ * and iconSize must already be set; hasIcon tells whether an icon is drawn.
+ * Shared by the widget's cached layout and QtAntdButton::paint().
+ */
+void layoutButton(QtAntdButtonLayout *layout,
+                  const QRect &bounds,
+                  QtAntdButton::ButtonShape shape,
+                  QtAntdButton::ButtonSize size,
+                  bool loading,
+                  bool hasIcon)
+{
+    // Shape
+    QRect rect = bounds.adjusted(1, 1, -1, -1);
+    int radius = 6; // Ant Design default border radius
+    if (shape == QtAntdButton::Round) {
+        radius = rect.height() / 2;
+    } else if (shape == QtAntdButton::Circle) {
+        int side = qMin(rect.width(), rect.height());
+        rect = QRect(rect.x() + (rect.width() - side) / 2,
+                    rect.y() + (rect.height() - side) / 2,
+                    side, side);
+        radius = side / 2;
+    }
+    layout->shapeRect = rect;
+    layout->radius = radius;
+
+    // Content width: the spinner replaces the icon while loading
+    const bool hasText = !layout->text.isEmpty();
+    hasIcon = hasIcon && !loading;
+    const int spinnerSize = spinnerSizeFor(size);
+    const int spinnerSpacing = 8;
+    const int iconSpacing = 8;
+
+    int contentWidth = 0;
+    if (loading) {
+        contentWidth += spinnerSize + spinnerSpacing;
+    }
+    contentWidth += layout->textWidth;
+    if (hasIcon) {
+        contentWidth += layout->iconSize.width();
+        if (hasText) {
+            contentWidth += iconSpacing;
+        }
+    }
+
+    // Calculate starting position for content
+    int contentX = rect.left() + (rect.width() - contentWidth) / 2;
+
+    // Ensure minimum padding for Small size
+    if (size == QtAntdButton::Small && contentWidth > 0) {
+        int minHPadding = 6; // Minimum horizontal padding for each side
+        contentX = qMax(contentX, rect.left() + minHPadding);
+    }
+
+    const QPoint center = rect.center();
+    layout->iconRect = QRect();
+    layout->spinnerRect = QRect();
+
+    if (hasIcon) {
+        const QSize &iconSize = layout->iconSize;
+        if (hasText) {
+            // Icon + text
+            layout->iconRect = QRect(QPoint(contentX, center.y() - iconSize.height() / 2), iconSize);
+            contentX += iconSize.width() + iconSpacing;
+        } else {
+            // Icon only
+            layout->iconRect = QRect(center - QPoint(iconSize.width() / 2, iconSize.height() / 2), iconSize);
+        }
+    }
+
+    if (loading) {
+        if (hasText) {
+            // Spinner and text as a single centered unit, spinner vertically centered with the text
+            layout->spinnerRect = QRect(contentX, center.y() - spinnerSize / 2, spinnerSize, spinnerSize);
+            contentX += spinnerSize + spinnerSpacing;
+        } else {
+            // Spinner only - center it in the button
+            layout->spinnerRect = QRect(center.x() - spinnerSize / 2, center.y() - spinnerSize / 2,
+                                        spinnerSize, spinnerSize);
+        }
+    }
+
+    layout->textRect = rect;
+    layout->textRect.setLeft(contentX);
+}
+
+/*!
+ * \internal
+ * Chrome, icon, spinner and text of a laid out button. The painter font is
+ * used for the text.
+ */
+void paintButton(QPainter *painter,
+                 const QtAntdButtonLayout &layout,
+                 const QtAntdButtonColors &colors,
+                 QtAntdButton::ButtonType type,
+                 const QIcon &icon,
+                 bool enabled,
+                 int spinnerSize,
+                 int loadingAngle)
+{
+    // Draw background and border
+    QtAntdInternal::drawChrome(painter, layout.shapeRect, layout.radius,
+                               colors.background, colors.border, 1,
+                               type == QtAntdButton::Dashed ? Qt::DashLine : Qt::SolidLine);
+
+    // Draw text and icon
+    painter->setPen(colors.text);
+
+    // The icon is not drawn while loading; the spinner takes its place
+    if (!layout.iconRect.isNull()) {
+        QPixmap pixmap = icon.pixmap(layout.iconSize, enabled ? QIcon::Normal : QIcon::Disabled);
+        painter->drawPixmap(layout.iconRect.topLeft(), pixmap);
+    }
+
+    if (!layout.spinnerRect.isNull()) {
+        // Circle with a gap to indicate rotation, slightly smaller than the spinner
+        // size to keep it proportional
+        const int drawSize = spinnerSize - 2;
+        const int arcLength = 72; // loading spinner arc length (degrees)
+        QtAntdInternal::drawSpinner(painter, layout.spinnerRect.center(), drawSize, 1.0, arcLength,
+                                    colors.text, loadingAngle);
+    }
+
+    if (!layout.text.isEmpty()) {
+        QtAntdInternal::drawCachedText(painter, layout.textRect, Qt::AlignLeft | Qt::AlignVCenter, layout.text);
+    }
+}
+
+} // namespace
 
 /*!
  * \class QtAntdButtonPrivate
@@ -114,6 +450,7 @@ const int timerInterval = 30; // ms
  */
 QtAntdButtonPrivate::QtAntdButtonPrivate(QtAntdButton *q)
     : q_ptr(q)
+    , loadingAnimation(q)
 {
 }
 
@@ -122,12 +459,6 @@ QtAntdButtonPrivate::QtAntdButtonPrivate(QtAntdButton *q)
  */
 QtAntdButtonPrivate::~QtAntdButtonPrivate()
 {
-    // Clean up timer
-    if (loadingTimer) {
-        loadingTimer->stop();
-        delete loadingTimer;
-        loadingTimer = nullptr;
-    }
 }
 
 /*!
@@ -151,15 +482,17 @@ void QtAntdButtonPrivate::init()
     
     // Initialize loading animation properties
     loadingAngle = 0;
-    loadingTimer = new QTimer(q);
-    QObject::connect(loadingTimer, &QTimer::timeout, q, [this]() {
-        loadingAngle = (loadingAngle + 15) % 360; // Rotate by 15 degrees each time for faster rotation
-        q_ptr->update();
+    loadingAnimation.setTickFunction([this](qint64 elapsed) {
+        // Sampled from the shared clock, so the speed does not depend on the frame rate
+        loadingAngle = int(elapsed * loadingDegreesPerMs) % 360;
+        QtAntdInternal::requestUpdate(q_ptr);
     });
 
     // Set up default size policy
     QSizePolicy policy(QSizePolicy::Maximum, QSizePolicy::Fixed);
     q->setSizePolicy(policy);
+
+    QtAntdInternal::ThemeRegistry::instance().registerWidget(q);
 }
 
 /*!
@@ -176,9 +509,9 @@ void QtAntdButtonPrivate::updateGeometry()
  */
 void QtAntdButtonPrivate::startLoadingAnimation()
 {
-    if (!loadingTimer->isActive()) {
+    if (!loadingAnimation.isRunning()) {
         loadingAngle = 0;
-        loadingTimer->start(timerInterval);
+        loadingAnimation.start();
     }
 }
 
@@ -187,46 +520,25 @@ void QtAntdButtonPrivate::startLoadingAnimation()
  */
 void QtAntdButtonPrivate::stopLoadingAnimation()
 {
-    if (loadingTimer->isActive()) {
-        loadingTimer->stop();
-    }
+    loadingAnimation.stop();
 }
 
 /*!
  * \internal
  */
-void QtAntdButtonPrivate::drawLoadingSpinner(QPainter *painter, const QRect &rect, const QColor &color)
+const QtAntdButtonColors &QtAntdButtonPrivate::colors() const
 {
-    // Save the painter state
-    painter->save();
-    
-    // Set pen properties for the spinner
-    QPen pen(color);
-    pen.setWidth(1.5); // loading spinner line width
-    pen.setCapStyle(Qt::RoundCap); // Round ends for smoother look
-    
-    painter->setPen(pen);
-    painter->setRenderHint(QPainter::Antialiasing);
-    
-    int spinnerSize = getSpinnerSize();
-    
-    QPoint center = rect.center();
-    
-    painter->translate(center);
-    painter->rotate(loadingAngle);
-    
-    // Draw circle with a gap to indicate rotation
-    // Using a slightly smaller size than spinnerSize to keep it proportional
-    int drawSize = spinnerSize - 2;
-    int arcLength = 72; // loading spinner arc length (degrees)
-    int startAngle = 0; // Start at the top
-    
-    painter->drawArc(QRect(-drawSize/2, -drawSize/2, drawSize, drawSize), 
-                    startAngle * 16,
-                    arcLength * 16);
-    
-    // Restore the painter state
-    painter->restore();
+    return buttonColorTable().entries[buttonType][colorPreset][isDanger ? 1 : 0][colorState()];
+}
+
+/*!
+ * \internal
+ */
+int QtAntdButtonPrivate::colorState() const
+{
+    Q_Q(const QtAntdButton);
+
+    return colorStateFor(q->isEnabled(), isPressed, isHovered);
 }
 
 /*!
@@ -259,6 +571,7 @@ QtAntdButton::QtAntdButton(const QIcon &icon, const QString &text, QWidget *pare
 
 QtAntdButton::~QtAntdButton()
 {
+    QtAntdInternal::ThemeRegistry::instance().unregisterWidget(this);
 }
 
 void QtAntdButton::setUseThemeColors(bool value)
@@ -266,7 +579,7 @@ void QtAntdButton::setUseThemeColors(bool value)
     Q_D(QtAntdButton);
     if (d->useThemeColors != value) {
         d->useThemeColors = value;
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -281,7 +594,7 @@ void QtAntdButton::setButtonType(ButtonType type)
     Q_D(QtAntdButton);
     if (d->buttonType != type) {
         d->buttonType = type;
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -296,8 +609,9 @@ void QtAntdButton::setButtonSize(ButtonSize size)
     Q_D(QtAntdButton);
     if (d->buttonSize != size) {
         d->buttonSize = size;
+        d->invalidateLayout();
         d->updateGeometry();
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -312,7 +626,8 @@ void QtAntdButton::setButtonShape(ButtonShape shape)
     Q_D(QtAntdButton);
     if (d->buttonShape != shape) {
         d->buttonShape = shape;
-        update();
+        d->invalidateLayout();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -335,7 +650,7 @@ void QtAntdButton::setBlock(bool block)
         }
         setSizePolicy(policy);
         d->updateGeometry();
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -350,7 +665,7 @@ void QtAntdButton::setGhost(bool ghost)
     Q_D(QtAntdButton);
     if (d->isGhost != ghost) {
         d->isGhost = ghost;
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -365,7 +680,7 @@ void QtAntdButton::setDanger(bool danger)
     Q_D(QtAntdButton);
     if (d->isDanger != danger) {
         d->isDanger = danger;
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -380,6 +695,7 @@ void QtAntdButton::setLoading(bool loading)
     Q_D(QtAntdButton);
     if (d->isLoading != loading) {
         d->isLoading = loading;
+        d->invalidateLayout();
         
         // Start or stop animation
         if (loading) {
@@ -390,7 +706,7 @@ void QtAntdButton::setLoading(bool loading)
         
         // Update the button geometry since loading state affects size calculation
         d->updateGeometry();
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -405,7 +721,7 @@ void QtAntdButton::setColorPreset(ColorPreset preset)
     Q_D(QtAntdButton);
     if (d->colorPreset != preset) {
         d->colorPreset = preset;
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -418,42 +734,10 @@ QtAntdButton::ColorPreset QtAntdButton::colorPreset() const
 QSize QtAntdButton::sizeHint() const
 {
     Q_D(const QtAntdButton);
-    
-    QSize size = QPushButton::sizeHint();
-    
-    // Adjust based on button size
-    int extraHeight = buttonSize2ExtraHeight.at(d->buttonSize);
-    int extraWidth = buttonSize2ExtraWidth.at(d->buttonSize);
 
-    int textWidth = 0;
-    
-    if (!text().isEmpty()) {
-        textWidth = fontMetrics().horizontalAdvance(text());
-    }
-    
-    // Account for icon if present
-    if (!icon().isNull() && !d->isLoading) {
-        textWidth += iconSize().width();
-        if (!text().isEmpty()) {
-            textWidth += iconTextSpacing;
-        }
-    }
-    
-    // Account for spinner if loading
-    if (d->isLoading) {
-        textWidth += d->getSpinnerSize() + 8;
-        if (!text().isEmpty()) {
-            textWidth += iconTextSpacing;
-        }
-    }
-    
-    // Ensure width is sufficient for content plus padding
-    int minContentWidth = textWidth + horizontalPadding;
-    
-    size.setHeight(qMax(size.height() + extraHeight, buttonMinimumHeight));
-    size.setWidth(qMax(size.width() + extraWidth, minContentWidth));
-    
-    return size;
+    const int iconWidth = icon().isNull() ? 0 : iconSize().width();
+    return buttonSizeHint(d->styleSize(), d->textWidth(), iconWidth, d->buttonSize, d->buttonShape,
+                          d->isLoading);
 }
 
 QSize QtAntdButton::minimumSizeHint() const
@@ -472,9 +756,7 @@ QSize QtAntdButton::minimumSizeHint() const
                 int minWidth = 0;
                 int minPadding = 12; // Minimum horizontal padding for Small buttons
                 
-                if (!text().isEmpty()) {
-                    minWidth += fontMetrics().horizontalAdvance(text());
-                }
+                minWidth += d->textWidth();
                 
                 if (!icon().isNull() && !d->isLoading) {
                     minWidth += iconSize().width() + (text().isEmpty() ? 0 : 8);
@@ -502,6 +784,7 @@ void QtAntdButton::paintEvent(QPaintEvent *event)
 {
     Q_UNUSED(event);
     Q_D(QtAntdButton);
+    QTANTD_PAINT_SCOPE(this);
 
     if (!d->useThemeColors) {
         QPushButton::paintEvent(event);
@@ -511,225 +794,149 @@ void QtAntdButton::paintEvent(QPaintEvent *event)
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing);
 
-    QRect rect = this->rect().adjusted(1, 1, -1, -1);
-    
-    QtAntdStyle &style = QtAntdStyle::instance();
-    
-    // Helper: compute dynamic colors based on type, preset and states
-    auto computeColors = [&](QColor &bg, QColor &border, QColor &text) {
-        const bool disabled = !isEnabled();
-        if (disabled) {
-            bg = style.themeColor("disabled-background");
-            border = style.themeColor("border");
-            text = style.themeColor("disabled");
-            return;
-        }
+    paintButton(&painter, d->contentLayout(), d->colors(), d->buttonType, icon(), isEnabled(),
+                d->getSpinnerSize(), d->loadingAngle);
+}
 
-        const bool hover = d->isHovered && !d->isPressed;
-        const bool pressed = d->isPressed;
-        const auto preset = d->colorPreset;
-
-        // Unified preset-based logic for all presets (Default treated as Primary)
-        const QColor brand = brandBaseForPreset(preset);
-        const QColor brandHover = brandHoverForPreset(preset);
-        const QColor brandActive = brandActiveForPreset(preset);
-        const QColor weakBg = brandWeakBgForPreset(preset);
-
-        const bool filled = (d->buttonType == Primary);
-        const bool borderOnly = (d->buttonType == Default || d->buttonType == Dashed);
-        const bool textLike = (d->buttonType == Text || d->buttonType == Link);
-
-        if (filled) {
-            bg = pressed ? brandActive : (hover ? brandHover : brand);
-            border = bg;
-            text = Qt::white;
-        } else if (borderOnly) {
-            bg = QColor(255,255,255,0);
-            if (hover) bg = weakBg;
-            if (pressed) bg = weakBg.darker(105);
-            border = pressed ? brandActive : (hover ? brandHover : brand);
-            text = border;
-        } else if (textLike) {
-            bg = QColor(255,255,255,0);
-            if (hover && d->buttonType == Text) bg = weakBg;
-            if (pressed && d->buttonType == Text) bg = weakBg.darker(105);
-            border = QColor(255,255,255,0);
-            text = pressed ? brandActive : (hover ? brandHover : brand);
-        }
+/*!
+ * Paints a button with the given options into rect, exactly as a QtAntdButton
+ * of that size would paint itself, without needing a widget. Theme colors are
+ * always used.
+ */
+void QtAntdButton::paint(QPainter *painter, const QRect &rect, const QtAntdButtonOptions &options)
+{
+    QtAntdButtonLayout layout;
+    layout.text = options.text;
+    layout.textWidth = options.text.isEmpty() ? 0 : QFontMetrics(options.font).horizontalAdvance(options.text);
+    layout.iconSize = options.iconSize;
+    layoutButton(&layout, rect, options.shape, options.size, options.loading, !options.icon.isNull());
 
-        // Danger flag overrides preset for simplicity
-        if (d->isDanger) {
-            const QColor dBrand = style.themeColor("error");
-            const QColor dHover = style.themeColor("error-hover");
-            const QColor dActive = style.themeColor("error-active");
-            const QColor dWeak = QColor("#fff2f0");
-            if (filled) {
-                bg = pressed ? dActive : (hover ? dHover : dBrand);
-                border = bg;
-                text = Qt::white;
-            } else if (borderOnly) {
-                bg = QColor(255,255,255,0);
-                if (hover) bg = dWeak;
-                if (pressed) bg = QColor("#ffccc7");
-                border = pressed ? dActive : (hover ? dHover : dBrand);
-                text = border;
-            } else if (textLike) {
-                bg = QColor(255,255,255,0);
-                if (hover) bg = dWeak;
-                if (pressed) bg = QColor("#ffccc7");
-                border = QColor(255,255,255,0);
-                text = pressed ? dActive : (hover ? dHover : dBrand);
-            }
-        }
-    };
-    
-    QColor currentBgColor, currentBorderColor, currentTextColor;
-    computeColors(currentBgColor, currentBorderColor, currentTextColor);
+    const int state = colorStateFor(options.enabled, options.pressed, options.hovered);
+    const QtAntdButtonColors &colors =
+        buttonColorTable().entries[options.type][options.colorPreset][options.danger ? 1 : 0][state];
 
-    // Draw background
-    if (currentBgColor.alpha() > 0) {
-        painter.setBrush(QBrush(currentBgColor));
-    } else {
-        painter.setBrush(Qt::NoBrush);
-    }
-    
-    // Draw border
-    QPen pen(currentBorderColor, 1);
-    if (d->buttonType == Dashed) {
-        pen.setStyle(Qt::DashLine);
-    }
-    painter.setPen(pen);
-    
-    // Draw shape
-    int radius = 6; // Ant Design default border radius
-    if (d->buttonShape == Round) {
-        radius = rect.height() / 2;
-    } else if (d->buttonShape == Circle) {
-        int size = qMin(rect.width(), rect.height());
-        rect = QRect(rect.x() + (rect.width() - size) / 2, 
-                    rect.y() + (rect.height() - size) / 2, 
-                    size, size);
-        radius = size / 2;
-    }
-    
-    if (currentBorderColor.alpha() > 0 || currentBgColor.alpha() > 0) {
-        painter.drawRoundedRect(rect, radius, radius);
-    }
-    
-    // Draw text and icon
-    painter.setPen(currentTextColor);
-    
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setFont(options.font);
+    paintButton(painter, layout, colors, options.type, options.icon, options.enabled,
+                spinnerSizeFor(options.size), options.loadingAngle);
+    painter->restore();
+}
+
+QSize QtAntdButton::sizeHint(const QtAntdButtonOptions &options)
+{
     QStyleOptionButton option;
-    option.initFrom(this);
-    option.text = text();
-    option.icon = d->isLoading ? QIcon() : icon(); // Don't use the icon when loading
-    option.iconSize = iconSize();
-    
-    QRect textRect = rect;
-    int contentWidth = 0;
-    int spinnerSize = d->getSpinnerSize();
-    int spinnerSpacing = 8;
-    
-    // Determine spinner size based on button size
-    if (d->isLoading) {
-        contentWidth += spinnerSize + spinnerSpacing;
-    }
-    
-    // Calculate text width if there is text
-    if (!option.text.isEmpty()) {
-        contentWidth += fontMetrics().horizontalAdvance(option.text);
-    }
-    
-    // Add icon width if present and not in loading state
-    if (!option.icon.isNull() && !d->isLoading) {
-        contentWidth += option.iconSize.width();
-        if (!option.text.isEmpty()) {
-            contentWidth += 8; // Spacing between icon and text
-        }
-    }
-    
-    // Calculate starting position for content
-    int contentX = textRect.left() + (textRect.width() - contentWidth) / 2;
-    
-    // Ensure minimum padding for Small size
-    if (d->buttonSize == Small && contentWidth > 0) {
-        int minHPadding = 6; // Minimum horizontal padding for each side
-        contentX = qMax(contentX, textRect.left() + minHPadding);
-    }
-    
-    // Store initial content position to ensure proper centering
-    int initialContentX = contentX;
-    
-    // Draw the icon if not in loading state
-    if (!option.icon.isNull() && !d->isLoading) {
-        QPixmap pixmap = option.icon.pixmap(option.iconSize, isEnabled() ? QIcon::Normal : QIcon::Disabled);
-        
-        int iconSpacing = 8;
-        
-        if (!option.text.isEmpty()) {
-            // Icon + text
-            painter.drawPixmap(contentX, textRect.center().y() - option.iconSize.height() / 2, pixmap);
-            contentX += option.iconSize.width() + iconSpacing;
-        } else {
-            // Icon only
-            painter.drawPixmap(textRect.center() - QPoint(option.iconSize.width() / 2, option.iconSize.height() / 2), pixmap);
-        }
+    option.text = options.text;
+    option.icon = options.icon;
+    option.iconSize = options.iconSize;
+    option.fontMetrics = QFontMetrics(options.font);
+    option.features = QStyleOptionButton::None;
+
+    const int textWidth = options.text.isEmpty() ? 0 : option.fontMetrics.horizontalAdvance(options.text);
+    const int iconWidth = options.icon.isNull() ? 0 : options.iconSize.width();
+    return buttonSizeHint(pushButtonStyleSize(option, nullptr), textWidth, iconWidth, options.size,
+                          options.shape, options.loading);
+}
+
+/*!
+ * \internal
+ */
+void QtAntdButtonPrivate::invalidateLayout()
+{
+    layout.metricsValid = false;
+    layout.geometryValid = false;
+    layout.styleSizeValid = false;
+}
+
+/*!
+ * \internal
+ * Width of the button text in the widget font, measured once per text/font.
+ */
+int QtAntdButtonPrivate::textWidth() const
+{
+    Q_Q(const QtAntdButton);
+
+    const QString text = q->text();
+    if (!layout.metricsValid || layout.text != text) {
+        layout.text = text;
+        layout.textWidth = text.isEmpty() ? 0 : q->fontMetrics().horizontalAdvance(text);
+        layout.metricsValid = true;
+        layout.geometryValid = false;
+        layout.styleSizeValid = false;
     }
-    
-    // In loading state, we need to draw both spinner and text as a single centered unit
-    if (d->isLoading) {
-        if (!option.text.isEmpty()) {
-            // If we have text, calculate everything from the initial position
-            contentX = initialContentX;
-            
-            // Create a rect that ensures the spinner is vertically centered with the text
-            QRect spinnerRect(
-                contentX,
-                textRect.center().y() - spinnerSize / 2,
-                spinnerSize,
-                spinnerSize
-            );
-            d->drawLoadingSpinner(&painter, spinnerRect, currentTextColor);
-            contentX += spinnerSize + spinnerSpacing;
-            
-            // Draw text right after spinner
-            QRect adjustedTextRect = textRect;
-            adjustedTextRect.setLeft(contentX);
-            painter.drawText(adjustedTextRect, Qt::AlignLeft | Qt::AlignVCenter, option.text);
-        } else {
-            // Spinner only - center it in the button
-            QRect spinnerRect(
-                textRect.center().x() - spinnerSize / 2,
-                textRect.center().y() - spinnerSize / 2,
-                spinnerSize,
-                spinnerSize
-            );
-            d->drawLoadingSpinner(&painter, spinnerRect, currentTextColor);
-        }
-    } else if (!option.text.isEmpty()) {
-        // Draw text (when not loading)
-        QRect adjustedTextRect = textRect;
-        adjustedTextRect.setLeft(contentX);
-        painter.drawText(adjustedTextRect, Qt::AlignLeft | Qt::AlignVCenter, option.text);
+    return layout.textWidth;
+}
+
+/*!
+ * \internal
+ * Style size around the text, icon and menu indicator, measured once per
+ * text, font, style, icon and menu rather than on every layout pass.
+ */
+QSize QtAntdButtonPrivate::styleSize() const
+{
+    Q_Q(const QtAntdButton);
+
+    textWidth(); // Drops the style size when the text changed
+    const QIcon icon = q->icon();
+    const qint64 iconKey = icon.isNull() ? 0 : icon.cacheKey();
+    const bool hasMenu = q->menu() != nullptr;
+    const bool isDefault = q->isDefault();
+    const bool autoDefault = q->autoDefault();
+    const bool flat = q->isFlat();
+    if (layout.styleSizeValid
+            && layout.styleIconKey == iconKey
+            && layout.styleIconSize == q->iconSize()
+            && layout.styleHasMenu == hasMenu
+            && layout.styleDefault == isDefault
+            && layout.styleAutoDefault == autoDefault
+            && layout.styleFlat == flat) {
+        return layout.styleSize;
     }
 
+    q->ensurePolished();
+    QStyleOptionButton option;
+    q->initStyleOption(&option);
+    layout.styleSize = pushButtonStyleSize(option, q);
+    layout.styleIconKey = iconKey;
+    layout.styleIconSize = q->iconSize();
+    layout.styleHasMenu = hasMenu;
+    layout.styleDefault = isDefault;
+    layout.styleAutoDefault = autoDefault;
+    layout.styleFlat = flat;
+    layout.styleSizeValid = true;
+    return layout.styleSize;
 }
 
+/*!
+ * \internal
+ * Shape, icon, spinner and text geometry for the current widget size.
+ */
+const QtAntdButtonLayout &QtAntdButtonPrivate::contentLayout() const
+{
+    Q_Q(const QtAntdButton);
+
+    textWidth(); // Refreshes layout.text and layout.textWidth
+    const QIcon icon = q->icon();
+    const qint64 iconKey = icon.isNull() ? 0 : icon.cacheKey();
+    if (layout.geometryValid
+            && layout.iconKey == iconKey
+            && layout.iconSize == q->iconSize()
+            && layout.widgetSize == q->size()) {
+        return layout;
+    }
+
+    layout.iconKey = iconKey;
+    layout.iconSize = q->iconSize();
+    layout.widgetSize = q->size();
+
+    layoutButton(&layout, q->rect(), buttonShape, buttonSize, isLoading, iconKey != 0);
+
+    layout.geometryValid = true;
+    return layout;
+}
 
 int QtAntdButtonPrivate::getSpinnerSize() const {
-    int spinnerSize = 14; // Default value
-    switch (buttonSize) {
-        case QtAntdButton::Small:
-            spinnerSize = 12;
-            break;
-        case QtAntdButton::Medium:
-            spinnerSize = 14;
-            break;
-        case QtAntdButton::Large:
-            spinnerSize = 16;
-            break;
-    }
-    return spinnerSize;
+    return spinnerSizeFor(buttonSize);
 }
 
 void QtAntdButton::mousePressEvent(QMouseEvent *event)
@@ -737,7 +944,7 @@ void QtAntdButton::mousePressEvent(QMouseEvent *event)
     Q_D(QtAntdButton);
     if (event->button() == Qt::LeftButton) {
         d->isPressed = true;
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
     QPushButton::mousePressEvent(event);
 }
@@ -754,9 +961,9 @@ void QtAntdButton::mouseReleaseEvent(QMouseEvent *event)
             auto getRippleBrand = [&]() -> QColor {
                 QtAntdStyle &style = QtAntdStyle::instance();
                 if (d->isDanger) {
-                    return style.themeColor("error-hover");
+                    return style.themeColor(Antd::ColorErrorHover);
                 }
-                return brandHoverForPreset(d->colorPreset);
+                return presetColors().hover[d->colorPreset];
             };
 
             QColor rippleColor = getRippleBrand();
@@ -784,7 +991,7 @@ void QtAntdButton::mouseReleaseEvent(QMouseEvent *event)
                                                     rippleColor,
                                                     extra);
         }
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
     QPushButton::mouseReleaseEvent(event);
 }
@@ -797,7 +1004,7 @@ void QtAntdButton::enterEvent(QEvent *event)
 {
     Q_D(QtAntdButton);
     d->isHovered = true;
-    update();
+    QtAntdInternal::requestUpdate(this);
     QPushButton::enterEvent(event);
 }
 
@@ -806,6 +1013,20 @@ void QtAntdButton::leaveEvent(QEvent *event)
     Q_D(QtAntdButton);
     d->isHovered = false;
     d->isPressed = false;
-    update();
+    QtAntdInternal::requestUpdate(this);
     QPushButton::leaveEvent(event);
-}
\ No newline at end of file
+}
+
+void QtAntdButton::changeEvent(QEvent *event)
+{
+    Q_D(QtAntdButton);
+    switch (event->type()) {
+    case QEvent::FontChange:
+    case QEvent::StyleChange:
+        d->invalidateLayout();
+        break;
+    default:
+        break;
+    }
+    QPushButton::changeEvent(event);
+}
@@ -3,11 +3,51 @@
 
 #include <QtGlobal>
 #include <QColor>
-#include <QTimer>
-#include <QPropertyAnimation>
+#include <QRect>
+#include <QString>
+#include "antdlib/qtantdanimationdriver_p.h"
 
 class QtAntdButton;
 
+struct QtAntdButtonColors
+{
+    QColor background;
+    QColor border;
+    QColor text;
+};
+
+// Content geometry of a button: shape, icon, spinner and text placement.
+// Recomputed only when the text, icon, font, widget size or a property that
+// affects the layout (size, shape, loading) changes.
+struct QtAntdButtonLayout
+{
+    // Inputs the cached values were computed from
+    QString text;
+    qint64 iconKey { 0 };
+    QSize iconSize;
+    QSize widgetSize;
+    bool metricsValid { false };
+    bool geometryValid { false };
+
+    int textWidth { 0 };  // horizontalAdvance of text in the widget font
+    QRect shapeRect;
+    int radius { 0 };
+    QRect iconRect;       // Null when no icon is drawn
+    QRect spinnerRect;    // Null when not loading
+    QRect textRect;       // Left edge is where the text starts
+
+    // Style size around text, icon and menu indicator, and the inputs it was
+    // measured from besides text and font
+    QSize styleSize;
+    qint64 styleIconKey { 0 };
+    QSize styleIconSize;
+    bool styleHasMenu { false };
+    bool styleDefault { false };
+    bool styleAutoDefault { false };
+    bool styleFlat { false };
+    bool styleSizeValid { false };
+};
+
 class QtAntdButtonPrivate
 {
     Q_DISABLE_COPY(QtAntdButtonPrivate)
@@ -20,10 +60,26 @@ public:
     void init();
     void updateGeometry();
 
+    // Interaction states used as color table slots
+    enum ColorState {
+        NormalState,
+        HoverState,
+        PressedState,
+        DisabledState,
+        ColorStateCount
+    };
+
+    const QtAntdButtonColors &colors() const;
+    int colorState() const;
+
+    void invalidateLayout();
+    int textWidth() const;
+    QSize styleSize() const;
+    const QtAntdButtonLayout &contentLayout() const;
+
     int getSpinnerSize() const;
     void startLoadingAnimation();
     void stopLoadingAnimation();
-    void drawLoadingSpinner(QPainter *painter, const QRect &rect, const QColor &color);
 
     QtAntdButton *const q_ptr;
 
@@ -40,8 +96,10 @@ public:
     bool isHovered;
     bool isPressed;
 
+    mutable QtAntdButtonLayout layout;
+
     // Loading animation
-    QTimer *loadingTimer;
+    QtAntdInternal::Animation loadingAnimation;
     int loadingAngle;
 };
 
@@ -0,0 +1,334 @@
+#include "qtantdbuttondelegate.h"
+#include "qtantdbuttondelegate_p.h"
+#include <QKeyEvent>
+#include <QPainter>
+#include <QStyle>
+#include <QWidget>
+
+// Space kept between the button and the item border
+static const int gAntdItemMargin = 4;
+// Distinct labels whose size is kept before the cache starts over
+static const int gAntdNaturalSizeLimit = 1024;
+
+/*!
+ * \class QtAntdButtonDelegatePrivate
+ * \internal
+ */
+
+/*!
+ * \internal
+ */
+QtAntdButtonDelegatePrivate::QtAntdButtonDelegatePrivate(QtAntdButtonDelegate *q)
+    : q_ptr(q)
+    , buttonType(QtAntdButton::Default)
+    , buttonSize(QtAntdButton::Small)
+    , buttonShape(QtAntdButton::DefaultShape)
+    , colorPreset(QtAntdButton::PresetDefault)
+    , danger(false)
+    , alignment(Qt::AlignCenter)
+    , interaction([this](const QWidget *view, const QRect &cellRect, const QModelIndex &index) {
+        return hitRect(view, cellRect, index);
+    })
+{
+}
+
+/*!
+ * \internal
+ */
+QtAntdButtonDelegatePrivate::~QtAntdButtonDelegatePrivate()
+{
+}
+
+/*!
+ * \internal
+ * Content and appearance of the button of index; state flags are left unset.
+ */
+void QtAntdButtonDelegatePrivate::initOptions(QtAntdButtonOptions *options, const QFont &font,
+                                              const QModelIndex &index) const
+{
+    options->text = text.isEmpty() ? index.data(Qt::DisplayRole).toString() : text;
+    options->icon = qvariant_cast<QIcon>(index.data(Qt::DecorationRole));
+    options->font = font;
+    options->type = buttonType;
+    options->size = buttonSize;
+    options->shape = buttonShape;
+    options->colorPreset = colorPreset;
+    options->danger = danger;
+}
+
+/*!
+ * \internal
+ * The button keeps its natural size, shrunk to the item if needed.
+ */
+QRect QtAntdButtonDelegatePrivate::buttonRect(const QRect &cellRect, const QtAntdButtonOptions &options) const
+{
+    const QRect area = cellRect.adjusted(gAntdItemMargin, 0, -gAntdItemMargin, 0);
+    const QSize size = naturalSize(options).boundedTo(area.size());
+    return QStyle::alignedRect(Qt::LeftToRight, alignment, size, area);
+}
+
+/*!
+ * \internal
+ * QtAntdButton::sizeHint() of options, measured once per text and icon
+ * presence in one font. Painting and hit-testing a cell then costs a lookup.
+ */
+QSize QtAntdButtonDelegatePrivate::naturalSize(const QtAntdButtonOptions &options) const
+{
+    if (options.font != naturalSizeFont || naturalSizes.size() >= gAntdNaturalSizeLimit) {
+        naturalSizes.clear();
+        naturalSizeFont = options.font;
+    }
+
+    QString key = options.text;
+    key.append(options.icon.isNull() ? QLatin1Char('0') : QLatin1Char('1'));
+    auto it = naturalSizes.constFind(key);
+    if (it == naturalSizes.cend()) {
+        it = naturalSizes.insert(key, QtAntdButton::sizeHint(options));
+    }
+    return it.value();
+}
+
+/*!
+ * \internal
+ * Button area for hover tracking, with the font the view paints the item in.
+ */
+QRect QtAntdButtonDelegatePrivate::hitRect(const QWidget *view, const QRect &cellRect,
+                                           const QModelIndex &index) const
+{
+    QFont font = view ? view->font() : QFont();
+    const QVariant itemFont = index.data(Qt::FontRole);
+    if (itemFont.isValid()) {
+        font = qvariant_cast<QFont>(itemFont).resolve(font);
+    }
+
+    QtAntdButtonOptions options;
+    initOptions(&options, font, index);
+    return buttonRect(cellRect, options);
+}
+
+/*!
+ * \class QtAntdButtonDelegate
+ */
+
+QtAntdButtonDelegate::QtAntdButtonDelegate(QObject *parent)
+    : QStyledItemDelegate(parent)
+    , d_ptr(new QtAntdButtonDelegatePrivate(this))
+{
+}
+
+QtAntdButtonDelegate::QtAntdButtonDelegate(const QString &text, QObject *parent)
+    : QStyledItemDelegate(parent)
+    , d_ptr(new QtAntdButtonDelegatePrivate(this))
+{
+    setText(text);
+}
+
+QtAntdButtonDelegate::~QtAntdButtonDelegate()
+{
+}
+
+void QtAntdButtonDelegate::setText(const QString &text)
+{
+    Q_D(QtAntdButtonDelegate);
+
+    if (d->text != text) {
+        d->text = text;
+        d->naturalSizes.clear();
+        emit sizeHintChanged(QModelIndex());
+    }
+}
+
+QString QtAntdButtonDelegate::text() const
+{
+    Q_D(const QtAntdButtonDelegate);
+
+    return d->text;
+}
+
+void QtAntdButtonDelegate::setButtonType(QtAntdButton::ButtonType type)
+{
+    Q_D(QtAntdButtonDelegate);
+
+    if (d->buttonType != type) {
+        d->buttonType = type;
+        d->interaction.updateViews();
+    }
+}
+
+QtAntdButton::ButtonType QtAntdButtonDelegate::buttonType() const
+{
+    Q_D(const QtAntdButtonDelegate);
+
+    return d->buttonType;
+}
+
+void QtAntdButtonDelegate::setButtonSize(QtAntdButton::ButtonSize size)
+{
+    Q_D(QtAntdButtonDelegate);
+
+    if (d->buttonSize != size) {
+        d->buttonSize = size;
+        d->naturalSizes.clear();
+        emit sizeHintChanged(QModelIndex());
+    }
+}
+
+QtAntdButton::ButtonSize QtAntdButtonDelegate::buttonSize() const
+{
+    Q_D(const QtAntdButtonDelegate);
+
+    return d->buttonSize;
+}
+
+void QtAntdButtonDelegate::setButtonShape(QtAntdButton::ButtonShape shape)
+{
+    Q_D(QtAntdButtonDelegate);
+
+    if (d->buttonShape != shape) {
+        d->buttonShape = shape;
+        d->naturalSizes.clear();
+        emit sizeHintChanged(QModelIndex());
+    }
+}
+
+QtAntdButton::ButtonShape QtAntdButtonDelegate::buttonShape() const
+{
+    Q_D(const QtAntdButtonDelegate);
+
+    return d->buttonShape;
+}
+
+void QtAntdButtonDelegate::setColorPreset(QtAntdButton::ColorPreset preset)
+{
+    Q_D(QtAntdButtonDelegate);
+
+    if (d->colorPreset != preset) {
+        d->colorPreset = preset;
+        d->interaction.updateViews();
+    }
+}
+
+QtAntdButton::ColorPreset QtAntdButtonDelegate::colorPreset() const
+{
+    Q_D(const QtAntdButtonDelegate);
+
+    return d->colorPreset;
+}
+
+void QtAntdButtonDelegate::setDanger(bool danger)
+{
+    Q_D(QtAntdButtonDelegate);
+
+    if (d->danger != danger) {
+        d->danger = danger;
+        d->interaction.updateViews();
+    }
+}
+
+bool QtAntdButtonDelegate::isDanger() const
+{
+    Q_D(const QtAntdButtonDelegate);
+
+    return d->danger;
+}
+
+void QtAntdButtonDelegate::setAlignment(Qt::Alignment alignment)
+{
+    Q_D(QtAntdButtonDelegate);
+
+    if (d->alignment != alignment) {
+        d->alignment = alignment;
+        d->interaction.updateViews();
+    }
+}
+
+Qt::Alignment QtAntdButtonDelegate::alignment() const
+{
+    Q_D(const QtAntdButtonDelegate);
+
+    return d->alignment;
+}
+
+/*!
+ * \reimp
+ */
+void QtAntdButtonDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option,
+                                 const QModelIndex &index) const
+{
+    Q_D(const QtAntdButtonDelegate);
+
+    d->interaction.watch(option.widget);
+
+    QStyleOptionViewItem itemOption = option;
+    initStyleOption(&itemOption, index);
+    QtAntdInternal::drawItemPanel(painter, itemOption);
+
+    QtAntdButtonOptions options;
+    d->initOptions(&options, itemOption.font, index);
+    options.enabled = option.state.testFlag(QStyle::State_Enabled);
+    options.hovered = d->interaction.isHovered(option.widget, index);
+    options.pressed = d->interaction.isDown(option.widget, index);
+    QtAntdButton::paint(painter, d->buttonRect(option.rect, options), options);
+}
+
+/*!
+ * \reimp
+ */
+QSize QtAntdButtonDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    Q_D(const QtAntdButtonDelegate);
+
+    QStyleOptionViewItem itemOption = option;
+    initStyleOption(&itemOption, index);
+
+    QtAntdButtonOptions options;
+    d->initOptions(&options, itemOption.font, index);
+    return d->naturalSize(options) + QSize(2 * gAntdItemMargin, 2 * gAntdItemMargin);
+}
+
+/*!
+ * \reimp
+ */
+QWidget *QtAntdButtonDelegate::createEditor(QWidget *parent, const QStyleOptionViewItem &option,
+                                            const QModelIndex &index) const
+{
+    Q_UNUSED(parent);
+    Q_UNUSED(option);
+    Q_UNUSED(index);
+
+    return nullptr;
+}
+
+/*!
+ * \reimp
+ */
+bool QtAntdButtonDelegate::editorEvent(QEvent *event, QAbstractItemModel *model,
+                                       const QStyleOptionViewItem &option, const QModelIndex &index)
+{
+    Q_UNUSED(model);
+    Q_D(QtAntdButtonDelegate);
+
+    if (!(option.state & QStyle::State_Enabled)) {
+        return false;
+    }
+
+    if (event->type() == QEvent::KeyPress) {
+        const int key = static_cast<QKeyEvent *>(event)->key();
+        if (key != Qt::Key_Space && key != Qt::Key_Select) {
+            return false;
+        }
+        emit clicked(index);
+        return true;
+    }
+
+    switch (d->interaction.mouseEvent(event, option, index)) {
+    case QtAntdInternal::DelegateInteraction::Clicked:
+        emit clicked(index);
+        return true;
+    case QtAntdInternal::DelegateInteraction::Consumed:
+        return true;
+    case QtAntdInternal::DelegateInteraction::Ignored:
+    default:
+        return false;
+    }
+}
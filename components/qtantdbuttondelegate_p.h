@@ -0,0 +1,46 @@
+#ifndef QTANTDBUTTONDELEGATE_P_H
+#define QTANTDBUTTONDELEGATE_P_H
+
+#include <QtGlobal>
+#include <QFont>
+#include <QHash>
+#include <QSize>
+#include <QString>
+#include "antdlib/qtantddelegateinteraction_p.h"
+
+class QtAntdButtonDelegate;
+struct QtAntdButtonOptions;
+
+class QtAntdButtonDelegatePrivate
+{
+    Q_DISABLE_COPY(QtAntdButtonDelegatePrivate)
+    Q_DECLARE_PUBLIC(QtAntdButtonDelegate)
+
+public:
+    QtAntdButtonDelegatePrivate(QtAntdButtonDelegate *q);
+    ~QtAntdButtonDelegatePrivate();
+
+    void initOptions(QtAntdButtonOptions *options, const QFont &font, const QModelIndex &index) const;
+    QSize naturalSize(const QtAntdButtonOptions &options) const;
+    QRect buttonRect(const QRect &cellRect, const QtAntdButtonOptions &options) const;
+    QRect hitRect(const QWidget *view, const QRect &cellRect, const QModelIndex &index) const;
+
+    QtAntdButtonDelegate *const q_ptr;
+
+    QString text;
+    QtAntdButton::ButtonType buttonType;
+    QtAntdButton::ButtonSize buttonSize;
+    QtAntdButton::ButtonShape buttonShape;
+    QtAntdButton::ColorPreset colorPreset;
+    bool danger;
+    Qt::Alignment alignment;
+
+    // QtAntdButton::sizeHint() by label text plus icon flag, in naturalSizeFont
+    mutable QHash<QString, QSize> naturalSizes;
+    mutable QFont naturalSizeFont;
+
+    // Views are watched from the const paint()
+    mutable QtAntdInternal::DelegateInteraction interaction;
+};
+
+#endif // QTANTDBUTTONDELEGATE_P_H
@@ -1,9 +1,85 @@
 #include "qtantddivider.h"
 #include "qtantddivider_p.h"
+#include "antdlib/qtantdthemeregistry_p.h"
+#include "antdlib/qtantdinstrumentation_p.h"
+#include "antdlib/qtantdtextcache_p.h"
 #include "../include/qtantd/lib/qtantdstyle.h"
 #include <QPainter>
 #include <QFontMetrics>
 
+namespace {
+
+void paintDivider(QPainter *painter,
+                  const QRect &r,
+                  const QFontMetrics &fm,
+                  const QString &text,
+                  QtAntdDivider::TextAlignment alignment,
+                  QtAntdDivider::LineStyle lineStyle,
+                  int lineThickness,
+                  const QtAntdDividerColors &colors)
+{
+    const int centerY = r.top() + r.height() / 2;
+
+    // Set up pen for the line
+    QPen pen(colors.line);
+    pen.setWidth(lineThickness);
+
+    switch (lineStyle) {
+        case QtAntdDivider::DashLine:
+            pen.setStyle(Qt::DashLine);
+            break;
+        case QtAntdDivider::DotLine:
+            pen.setStyle(Qt::DotLine);
+            break;
+        case QtAntdDivider::SolidLine:
+        default:
+            pen.setStyle(Qt::SolidLine);
+            break;
+    }
+
+    painter->setPen(pen);
+
+    if (text.isEmpty()) {
+        // Draw full width line
+        painter->drawLine(r.left(), centerY, r.right(), centerY);
+        return;
+    }
+
+    // Draw line with text
+    const int textWidth = fm.horizontalAdvance(text);
+    const int textHeight = fm.height();
+    const int padding = 16; // Space between text and lines
+
+    QRect textRect;
+    switch (alignment) {
+        case QtAntdDivider::Left:
+            textRect = QRect(r.left() + 2 * padding, centerY - textHeight/2, textWidth, textHeight);
+            break;
+        case QtAntdDivider::Right:
+            textRect = QRect(r.right() - textWidth - 2 * padding, centerY - textHeight/2, textWidth, textHeight);
+            break;
+        case QtAntdDivider::Center:
+        default:
+            textRect = QRect(r.left() + (r.width() - textWidth) / 2, centerY - textHeight/2, textWidth, textHeight);
+            break;
+    }
+
+    // left line: from r.left() to textRect.left() - padding
+    if (r.left() < textRect.left() - padding) {
+        painter->drawLine(r.left(), centerY, textRect.left() - padding, centerY);
+    }
+    // right line: from textRect.right() + padding to r.right()
+    if (textRect.right() + padding < r.right()) {
+        painter->drawLine(textRect.right() + padding, centerY, r.right(), centerY);
+    }
+
+    // Draw text
+    painter->setPen(colors.text);
+    QtAntdInternal::drawCachedText(painter, textRect, Qt::AlignCenter, text);
+}
+
+} // namespace
+
 /*!
  * \class QtAntdDividerPrivate
  * \internal
@@ -38,6 +114,23 @@ void QtAntdDividerPrivate::init()
 
     QSizePolicy policy(QSizePolicy::Expanding, QSizePolicy::Fixed);
     q->setSizePolicy(policy);
+
+    QtAntdInternal::ThemeRegistry::instance().registerWidget(q);
+}
+
+/*!
+ * \internal
+ */
+const QtAntdDividerColors &QtAntdDividerPrivate::colors()
+{
+    Q_Q(QtAntdDivider);
+
+    return colorCache.get(0, [q]() {
+        QtAntdDividerColors resolved;
+        resolved.line = q->lineColor();
+        resolved.text = q->textColor();
+        return resolved;
+    });
 }
 
 /*!
@@ -61,6 +154,7 @@ QtAntdDivider::QtAntdDivider(const QString &text, QWidget *parent)
 
 QtAntdDivider::~QtAntdDivider()
 {
+    QtAntdInternal::ThemeRegistry::instance().unregisterWidget(this);
 }
 
 void QtAntdDivider::setUseThemeColors(bool value)
@@ -72,7 +166,8 @@ void QtAntdDivider::setUseThemeColors(bool value)
     }
 
     d->useThemeColors = value;
-    update();
+    d->colorCache.invalidate();
+    QtAntdInternal::requestUpdate(this);
 }
 
 bool QtAntdDivider::useThemeColors() const
@@ -91,7 +186,7 @@ void QtAntdDivider::setText(const QString &text)
     }
 
     d->text = text;
-    update();
+    QtAntdInternal::requestUpdate(this);
 }
 
 QString QtAntdDivider::text() const
@@ -110,7 +205,7 @@ void QtAntdDivider::setTextAlignment(TextAlignment alignment)
     }
 
     d->textAlignment = alignment;
-    update();
+    QtAntdInternal::requestUpdate(this);
 }
 
 QtAntdDivider::TextAlignment QtAntdDivider::textAlignment() const
@@ -129,7 +224,7 @@ void QtAntdDivider::setLineThickness(int thickness)
     }
 
     d->lineThickness = thickness;
-    update();
+    QtAntdInternal::requestUpdate(this);
 }
 
 int QtAntdDivider::lineThickness() const
@@ -146,7 +241,8 @@ void QtAntdDivider::setLineColor(const QColor &color)
     d->lineColor = color;
     
     ANTD_DISABLE_THEME_COLORS
-    update();
+    d->colorCache.invalidate();
+    QtAntdInternal::requestUpdate(this);
 }
 
 QColor QtAntdDivider::lineColor() const
@@ -154,7 +250,7 @@ QColor QtAntdDivider::lineColor() const
     Q_D(const QtAntdDivider);
 
     if (d->useThemeColors || !d->lineColor.isValid()) {
-        return QtAntdStyle::instance().themeColor("border");
+        return QtAntdStyle::instance().themeColor(Antd::ColorBorder);
     } else {
         return d->lineColor;
     }
@@ -167,7 +263,8 @@ void QtAntdDivider::setTextColor(const QColor &color)
     d->textColor = color;
 
     ANTD_DISABLE_THEME_COLORS
-    update();
+    d->colorCache.invalidate();
+    QtAntdInternal::requestUpdate(this);
 }
 
 QColor QtAntdDivider::textColor() const
@@ -175,7 +272,7 @@ QColor QtAntdDivider::textColor() const
     Q_D(const QtAntdDivider);
 
     if (d->useThemeColors || !d->textColor.isValid()) {
-        return QtAntdStyle::instance().themeColor("text");
+        return QtAntdStyle::instance().themeColor(Antd::ColorText);
     } else {
         return d->textColor;
     }
@@ -190,7 +287,7 @@ void QtAntdDivider::setLineStyle(LineStyle style)
     }
 
     d->lineStyle = style;
-    update();
+    QtAntdInternal::requestUpdate(this);
 }
 
 QtAntdDivider::LineStyle QtAntdDivider::lineStyle() const
@@ -237,89 +334,31 @@ void QtAntdDivider::paintEvent(QPaintEvent *event)
 {
     Q_UNUSED(event)
     Q_D(QtAntdDivider);
+    QTANTD_PAINT_SCOPE(this);
 
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing);
 
-    QRect r = rect();
-    const int centerY = r.height() / 2;
-
-    // Set up pen for the line
-    QPen pen(lineColor());
-    pen.setWidth(d->lineThickness);
-    
-    switch (d->lineStyle) {
-        case DashLine:
-            pen.setStyle(Qt::DashLine);
-            break;
-        case DotLine:
-            pen.setStyle(Qt::DotLine);
-            break;
-        case SolidLine:
-        default:
-            pen.setStyle(Qt::SolidLine);
-            break;
-    }
-
-    painter.setPen(pen);
-
-    if (d->text.isEmpty()) {
-        // Draw full width line
-        painter.drawLine(r.left(), centerY, r.right(), centerY);
-    } else {
-        // Draw line with text
-        QFontMetrics fm(font());
-        const int textWidth = fm.horizontalAdvance(d->text);
-        const int textHeight = fm.height();
-        const int padding = 16; // Space between text and lines
-        
-        QRect textRect;
-        int lineLeft = r.left();
-        int lineRight = r.right();
-
-        switch (d->textAlignment) {
-            case Left: {
-                textRect = QRect(r.left() + 2 * padding, centerY - textHeight/2, textWidth, textHeight);
-                // left line: from r.left() to textRect.left() - padding
-                if (r.left() < textRect.left() - padding) {
-                    painter.drawLine(r.left(), centerY, textRect.left() - padding, centerY);
-                }
-                // right line: from textRect.right() + padding to r.right()
-                if (textRect.right() + padding < r.right()) {
-                    painter.drawLine(textRect.right() + padding, centerY, r.right(), centerY);
-                }
-                break;
-            }
-            case Right: {
-                textRect = QRect(r.right() - textWidth - 2 * padding, centerY - textHeight/2, textWidth, textHeight);
-                // left line: from r.left() to textRect.left() - padding
-                if (r.left() < textRect.left() - padding) {
-                    painter.drawLine(r.left(), centerY, textRect.left() - padding, centerY);
-                }
-                // right line: from textRect.right() + padding to r.right()
-                if (textRect.right() + padding < r.right()) {
-                    painter.drawLine(textRect.right() + padding, centerY, r.right(), centerY);
-                }
-                break;
-            }
-            case Center:
-            default: {
-                textRect = QRect((r.width() - textWidth) / 2, centerY - textHeight/2, textWidth, textHeight);
-                int lineLeft = r.left();
-                int lineRight = textRect.left() - padding;
-                if (lineLeft < lineRight) {
-                    painter.drawLine(lineLeft, centerY, lineRight, centerY);
-                }
-                int rightLineStart = textRect.right() + padding;
-                if (rightLineStart < r.right()) {
-                    painter.drawLine(rightLineStart, centerY, r.right(), centerY);
-                }
-                break;
-            }
-        }
-
-        // Draw text
-        painter.setPen(textColor());
-        painter.drawText(textRect, Qt::AlignCenter, d->text);
-    }
+    paintDivider(&painter, rect(), fontMetrics(), d->text, d->textAlignment,
+                 d->lineStyle, d->lineThickness, d->colors());
 }
+
+/*!
+ * Paints a divider with the given options into rect, as a QtAntdDivider would
+ * paint itself, without needing a widget.
+ */
+void QtAntdDivider::paint(QPainter *painter, const QRect &rect, const QtAntdDividerOptions &options)
+{
+    QtAntdStyle &style = QtAntdStyle::instance();
+
+    QtAntdDividerColors colors;
+    colors.line = options.lineColor.isValid() ? options.lineColor : style.themeColor(Antd::ColorBorder);
+    colors.text = options.textColor.isValid() ? options.textColor : style.themeColor(Antd::ColorText);
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setFont(options.font);
+    paintDivider(painter, rect, QFontMetrics(options.font), options.text, options.alignment,
+                 options.lineStyle, qMax(1, options.lineThickness), colors);
+    painter->restore();
+}
\ No newline at end of file
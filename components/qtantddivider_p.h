@@ -3,9 +3,16 @@
 
 #include <QtGlobal>
 #include <QColor>
+#include "antdlib/qtantdcolorcache_p.h"
 
 class QtAntdDivider;
 
+struct QtAntdDividerColors
+{
+    QColor line;
+    QColor text;
+};
+
 class QtAntdDividerPrivate
 {
     Q_DISABLE_COPY(QtAntdDividerPrivate)
@@ -16,6 +23,7 @@ public:
     ~QtAntdDividerPrivate();
 
     void init();
+    const QtAntdDividerColors &colors();
 
     QtAntdDivider *const q_ptr;
     QString text;
@@ -25,6 +33,7 @@ public:
     bool useThemeColors;
     QColor lineColor;
     QColor textColor;
+    QtAntdInternal::ResolvedColorCache<QtAntdDividerColors, 1> colorCache;
 };
 
 #endif // QTANTDDIVIDER_P_H
\ No newline at end of file
@@ -1,5 +1,12 @@
 #include "qtantdinput.h"
 #include "qtantdinput_p.h"
+#include "antdlib/qtantdthemeregistry_p.h"
+#include "antdlib/qtantdinstrumentation_p.h"
+#include "antdlib/qtantdtextcache_p.h"
+#include "antdlib/qtantdninepatch_p.h"
+#include "antdlib/qtantdalphamask_p.h"
+#include "antdlib/qtantdchrome_p.h"
+#include "antdlib/qtantdrendercache_p.h"
 #include "qtantdstyle.h"
 #include <QPainter>
 #include <QPainterPath>
@@ -27,6 +34,193 @@ static const int gAntdBorderWidth = 1;
 static const int gAntdClearButtonSize = 16;
 static const int gAntdIconSpacing = 4;
 
+static const int gFocusGlowCacheKb = 512;
+
+/*!
+ * \internal
+ * Focus glow around a rounded rect of the given radius, extending extent pixels
+ * outward and clipped to the outside of the rect. Rendered once per
+ * (radius, extent, device pixel ratio) as a nine-patch alpha mask tinted with the
+ * border color at paint time: the corners hold the curved part and a one pixel
+ * wide middle is stretched to any input size.
+ */
+static const QtAntdInternal::NinePatch &focusGlowPatch(int radius, int extent, qreal dpr)
+{
+    thread_local QtAntdInternal::RenderCache<QtAntdInternal::NinePatch> cache(gFocusGlowCacheKb);
+
+    QtAntdInternal::RenderCacheKey key;
+    key.add(radius).add(extent).add(dpr);
+    if (const QtAntdInternal::NinePatch *cached = cache.find(key)) {
+        return *cached;
+    }
+
+    // Corner margin covers the glow, the curve and the 2px edge stroke
+    const int margin = extent + radius + 2;
+    const int size = 2 * margin + 1;
+
+    QtAntdInternal::NinePatch patch;
+    patch.margins = QMargins(margin, margin, margin, margin);
+    patch.mask = QtAntdInternal::createAlphaMask(QSize(size, size), dpr);
+
+    // Same half-pixel alignment as the inner rect in paintEvent
+    const QRectF innerRect(extent + 0.5, extent + 0.5, size - 2 * extent - 1, size - 2 * extent - 1);
+
+    QPainter painter(&patch.mask);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    // Only draw OUTSIDE the inner rounded rect
+    QPainterPath clipOuter; clipOuter.addRect(QRectF(0, 0, size, size));
+    QPainterPath clipInner; clipInner.addRoundedRect(innerRect, radius, radius);
+    painter.setClipPath(clipOuter.subtracted(clipInner));
+
+    // Only coverage is kept; the glow color is applied when compositing
+    const QColor base = Qt::black;
+    int alpha = 4;           // start alpha slightly stronger
+    for (int o = extent; o >= 1; --o) {
+        QColor cc = base; cc.setAlpha(alpha);
+        const QRectF rr = innerRect.adjusted(-o, -o, o, o);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(cc);
+        painter.drawRoundedRect(rr, radius + o, radius + o);
+        // decay alpha gradually but keep minimum visibility
+        alpha -= 1; if (alpha < 1) alpha = 1;
+    }
+    // A crisp near-border stroke to enhance edge
+    QColor edge = base; edge.setAlpha(120);
+    const QRectF rr = innerRect.adjusted(-1, -1, 1, 1);
+    painter.setPen(QPen(edge, 2, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
+    painter.setBrush(Qt::NoBrush);
+    painter.drawRoundedRect(rr, radius + 1, radius + 1);
+    painter.end();
+
+    return *cache.insert(key, patch, patch.mask.sizeInBytes());
+}
+
+namespace {
+
+int inputHeightFor(QtAntdInput::InputSize size)
+{
+    switch (size) {
+        case QtAntdInput::Small:  return gAntdInputHeightSmall;
+        case QtAntdInput::Large:  return gAntdInputHeightLarge;
+        case QtAntdInput::Medium:
+        default:                  return gAntdInputHeightMedium;
+    }
+}
+
+int horizontalPaddingFor(QtAntdInput::InputSize size)
+{
+    switch (size) {
+        case QtAntdInput::Small:  return gAntdInputPaddingSmall;
+        case QtAntdInput::Large:  return gAntdInputPaddingLarge;
+        case QtAntdInput::Medium:
+        default:                  return gAntdInputPaddingMedium;
+    }
+}
+
+QColor statusColor(QtAntdInput::InputStatus status, Antd::ColorToken normal)
+{
+    QtAntdStyle &style = QtAntdStyle::instance();
+
+    switch (status) {
+        case QtAntdInput::Error:   return style.themeColor(Antd::ColorError);
+        case QtAntdInput::Warning: return style.themeColor(Antd::ColorWarning);
+        case QtAntdInput::Success: return style.themeColor(Antd::ColorSuccess);
+        case QtAntdInput::Normal:
+        default:                   return style.themeColor(normal);
+    }
+}
+
+QtAntdInputColors resolveInputColors(bool useThemeColors, QtAntdInput::InputStatus status,
+                                     bool enabled, bool focused, bool hovered)
+{
+    QtAntdInputColors colors;
+
+    if (!useThemeColors) {
+        colors.border = QColor("#d9d9d9"); // Default Ant Design border color
+        colors.background = enabled ? Qt::white : QColor("#f5f5f5");
+        colors.text = enabled ? Qt::black : QColor("#bfbfbf");
+        return colors;
+    }
+
+    QtAntdStyle &style = QtAntdStyle::instance();
+
+    // Focused and hovered inputs highlight with the primary color unless a status is set
+    colors.border = statusColor(status, (focused || hovered) ? Antd::ColorPrimary : Antd::ColorBorder);
+    colors.background = style.themeColor(enabled ? Antd::ColorBackground : Antd::ColorDisabledBackground);
+    colors.text = style.themeColor(enabled ? Antd::ColorText : Antd::ColorDisabled);
+    return colors;
+}
+
+/*!
+ * \internal
+ * Prefix (leading) or suffix (trailing) area inside bounds, or a null rect when
+ * there is no affix. Icons take 16px, text its advance in fm.
+ */
+QRect affixRect(const QRect &bounds, const QFontMetrics &fm, int padding, int margin,
+                const QString &text, const QIcon &icon, bool trailing)
+{
+    if (text.isEmpty() && icon.isNull()) {
+        return QRect();
+    }
+
+    const int width = text.isEmpty() ? 16 : fm.horizontalAdvance(text); // Default icon size
+    const int y = bounds.top() + (bounds.height() - 16) / 2;
+    if (trailing) {
+        return QRect(bounds.left() + bounds.width() - padding - width - margin, y, width, 16);
+    }
+    return QRect(bounds.left() + padding + margin, y, width, 16);
+}
+
+void paintAffix(QPainter *painter, const QRect &rect, const QString &text, const QIcon &icon)
+{
+    if (rect.isEmpty()) {
+        return;
+    }
+    if (!text.isEmpty()) {
+        QtAntdInternal::drawCachedText(painter, rect, Qt::AlignCenter, text);
+    } else if (!icon.isNull()) {
+        QPixmap pixmap = icon.pixmap(16, 16);
+        painter->drawPixmap(rect.center() - QPoint(8, 8), pixmap);
+    }
+}
+
+/*!
+ * \internal
+ * Everything drawn above the text: focus glow, border and prefix/suffix. The
+ * glow extends outward from innerRect by up to margin pixels.
+ */
+void paintInputOverlay(QPainter *painter,
+                       const QRect &bounds,
+                       const QRectF &innerRect,
+                       int margin,
+                       const QtAntdInputColors &colors,
+                       bool focused,
+                       const QRect &prefixRect, const QString &prefixText, const QIcon &prefixIcon,
+                       const QRect &suffixRect, const QString &suffixText, const QIcon &suffixIcon)
+{
+    if (focused) {
+        const int glowExtent = qMax(3, margin); // outward pixels
+        const int outset = margin - glowExtent;
+        const QRect glowRect = bounds.adjusted(outset, outset, -outset, -outset);
+        QColor glowColor = colors.border;
+        glowColor.setAlpha(255);
+        QtAntdInternal::drawNinePatch(painter, glowRect,
+                                      focusGlowPatch(gAntdBorderRadius, glowExtent,
+                                                     painter->device()->devicePixelRatioF()),
+                                      glowColor);
+    }
+
+    // Border
+    QtAntdInternal::drawChrome(painter, innerRect, gAntdBorderRadius, QColor(), colors.border, gAntdBorderWidth);
+
+    painter->setPen(colors.text);
+    paintAffix(painter, prefixRect, prefixText, prefixIcon);
+    paintAffix(painter, suffixRect, suffixText, suffixIcon);
+}
+
+} // namespace
+
 QtAntdInputPrivate::QtAntdInputPrivate(QtAntdInput *q)
     : q_ptr(q),
       inputSize(QtAntdInput::Medium),
@@ -68,6 +262,8 @@ void QtAntdInputPrivate::init()
     
     updateGeometry();
     updateTextMargins();
+
+    QtAntdInternal::ThemeRegistry::instance().registerWidget(q);
 }
 
 void QtAntdInputPrivate::updateGeometry()
@@ -130,46 +326,18 @@ void QtAntdInputPrivate::updateClearButton()
 QRect QtAntdInputPrivate::prefixRect() const
 {
     Q_Q(const QtAntdInput);
-    
-    if (prefixText.isEmpty() && prefixIcon.isNull()) {
-        return QRect();
-    }
-    
-    int padding = getHorizontalPadding();
-    int height = getInputHeight();
-    int width = 16; // Default icon size
-    
-    if (!prefixText.isEmpty()) {
-        QFontMetrics fm(q->font());
-        width = fm.horizontalAdvance(prefixText);
-    }
-    
-    // Shift by visual margin
-    int vm = getVisualMargin();
-    return QRect(padding + vm, (height + vm * 2 - 16) / 2, width, 16);
+
+    // The widget height is fixed to the input height plus the visual margin
+    return affixRect(q->rect(), q->fontMetrics(), getHorizontalPadding(), getVisualMargin(),
+                     prefixText, prefixIcon, false);
 }
 
 QRect QtAntdInputPrivate::suffixRect() const
 {
     Q_Q(const QtAntdInput);
-    
-    if (suffixText.isEmpty() && suffixIcon.isNull()) {
-        return QRect();
-    }
-    
-    int padding = getHorizontalPadding();
-    int height = getInputHeight();
-    int width = 16; // Default icon size
-    
-    if (!suffixText.isEmpty()) {
-        QFontMetrics fm(q->font());
-        width = fm.horizontalAdvance(suffixText);
-    }
-    
-    int vm = getVisualMargin();
-    QRect rect = q->rect();
-    // Shift by visual margin
-    return QRect(rect.width() - padding - width - vm, (height + vm * 2 - 16) / 2, width, 16);
+
+    return affixRect(q->rect(), q->fontMetrics(), getHorizontalPadding(), getVisualMargin(),
+                     suffixText, suffixIcon, true);
 }
 
 QRect QtAntdInputPrivate::clearButtonRect() const
@@ -218,22 +386,12 @@ QRect QtAntdInputPrivate::textRect() const
 
 int QtAntdInputPrivate::getInputHeight() const
 {
-    switch (inputSize) {
-        case QtAntdInput::Small:  return gAntdInputHeightSmall;
-        case QtAntdInput::Large:  return gAntdInputHeightLarge;
-        case QtAntdInput::Medium:
-        default:                  return gAntdInputHeightMedium;
-    }
+    return inputHeightFor(inputSize);
 }
 
 int QtAntdInputPrivate::getHorizontalPadding() const
 {
-    switch (inputSize) {
-        case QtAntdInput::Small:  return gAntdInputPaddingSmall;
-        case QtAntdInput::Large:  return gAntdInputPaddingLarge;
-        case QtAntdInput::Medium:
-        default:                  return gAntdInputPaddingMedium;
-    }
+    return horizontalPaddingFor(inputSize);
 }
 
 int QtAntdInputPrivate::getBorderRadius() const
@@ -241,76 +399,22 @@ int QtAntdInputPrivate::getBorderRadius() const
     return gAntdBorderRadius;
 }
 
-QColor QtAntdInputPrivate::getBorderColor() const
+const QtAntdInputColors &QtAntdInputPrivate::colors()
 {
-    if (!useThemeColors) {
-        return QColor("#d9d9d9"); // Default Ant Design border color
-    }
-    
-    QtAntdStyle &style = QtAntdStyle::instance();
-    
-    if (isFocused) {
-        switch (inputStatus) {
-            case QtAntdInput::Error:   return style.themeColor("error");
-            case QtAntdInput::Warning: return style.themeColor("warning");
-            case QtAntdInput::Success: return style.themeColor("success");
-            case QtAntdInput::Normal:
-            default:                   return style.themeColor("primary");
-        }
-    }
-    
-    if (isHovered) {
-        switch (inputStatus) {
-            case QtAntdInput::Error:   return style.themeColor("error");
-            case QtAntdInput::Warning: return style.themeColor("warning");
-            case QtAntdInput::Success: return style.themeColor("success");
-            case QtAntdInput::Normal:
-            default:                   return style.themeColor("primary");
-        }
-    }
-    
-    // Default/normal state
-    switch (inputStatus) {
-        case QtAntdInput::Error:   return style.themeColor("error");
-        case QtAntdInput::Warning: return style.themeColor("warning"); 
-        case QtAntdInput::Success: return style.themeColor("success");
-        case QtAntdInput::Normal:
-        default:                   return style.themeColor("border");
-    }
-}
+    Q_Q(QtAntdInput);
 
-QColor QtAntdInputPrivate::getBackgroundColor() const
-{
-    Q_Q(const QtAntdInput);
-    
-    if (!useThemeColors) {
-        return q->isEnabled() ? Qt::white : QColor("#f5f5f5");
-    }
-    
-    QtAntdStyle &style = QtAntdStyle::instance();
-    
-    if (!q->isEnabled()) {
-        return style.themeColor("disabled-background");
-    }
-    
-    return style.themeColor("background");
+    return colorCache.get(colorState(), [this, q]() {
+        return resolveInputColors(useThemeColors, inputStatus, q->isEnabled(), isFocused, isHovered);
+    });
 }
 
-QColor QtAntdInputPrivate::getTextColor() const
+int QtAntdInputPrivate::colorState() const
 {
     Q_Q(const QtAntdInput);
-    
-    if (!useThemeColors) {
-        return q->isEnabled() ? Qt::black : QColor("#bfbfbf");
-    }
-    
-    QtAntdStyle &style = QtAntdStyle::instance();
-    
-    if (!q->isEnabled()) {
-        return style.themeColor("disabled");
-    }
-    
-    return style.themeColor("text");
+
+    return (q->isEnabled() ? 1 : 0)
+         | (isFocused ? 2 : 0)
+         | (isHovered ? 4 : 0);
 }
 
 // QtAntdInput implementation
@@ -335,6 +439,7 @@ QtAntdInput::QtAntdInput(const QString &placeholder, QWidget *parent)
 
 QtAntdInput::~QtAntdInput()
 {
+    QtAntdInternal::ThemeRegistry::instance().unregisterWidget(this);
 }
 
 void QtAntdInput::setUseThemeColors(bool value)
@@ -342,7 +447,8 @@ void QtAntdInput::setUseThemeColors(bool value)
     Q_D(QtAntdInput);
     if (d->useThemeColors != value) {
         d->useThemeColors = value;
-        update();
+        d->colorCache.invalidate();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -359,7 +465,7 @@ void QtAntdInput::setInputSize(InputSize size)
         d->inputSize = size;
         d->updateGeometry();
         d->updateTextMargins();
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -374,7 +480,8 @@ void QtAntdInput::setInputStatus(InputStatus status)
     Q_D(QtAntdInput);
     if (d->inputStatus != status) {
         d->inputStatus = status;
-        update();
+        d->colorCache.invalidate();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -391,7 +498,7 @@ void QtAntdInput::setClearButtonEnabled(bool enabled)
         d->clearButtonEnabled = enabled;
         d->updateClearButton();
         d->updateTextMargins();
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -408,7 +515,7 @@ void QtAntdInput::setPrefixText(const QString &text)
         d->prefixText = text;
         d->prefixIcon = QIcon(); // Clear icon if text is set
         d->updateTextMargins();
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -419,7 +526,7 @@ void QtAntdInput::setPrefixIcon(const QIcon &icon)
         d->prefixIcon = icon;
         d->prefixText.clear(); // Clear text if icon is set
         d->updateTextMargins();
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -442,7 +549,7 @@ void QtAntdInput::setSuffixText(const QString &text)
         d->suffixText = text;
         d->suffixIcon = QIcon(); // Clear icon if text is set
         d->updateTextMargins();
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -453,7 +560,7 @@ void QtAntdInput::setSuffixIcon(const QIcon &icon)
         d->suffixIcon = icon;
         d->suffixText.clear(); // Clear text if icon is set
         d->updateTextMargins();
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -507,12 +614,14 @@ QSize QtAntdInput::minimumSizeHint() const
 void QtAntdInput::paintEvent(QPaintEvent *event)
 {
     Q_D(QtAntdInput);
+    QTANTD_PAINT_SCOPE(this);
 
     // Define inner rounded rect where background/border live.
     // We reserve a uniform visual margin for glow around it.
     const int vm = d->getVisualMargin();
     const QRectF innerRect = QRectF(this->rect()).adjusted(vm + 0.5, vm + 0.5, -(vm + 0.5), -(vm + 0.5));
     const int radius = d->getBorderRadius();
+    const QtAntdInputColors &colors = d->colors();
 
     // Pass 1: draw custom rounded background first
     {
@@ -520,92 +629,88 @@ void QtAntdInput::paintEvent(QPaintEvent *event)
         bgPainter.setRenderHint(QPainter::Antialiasing);
 
         // Background fill
-        const QColor bgColor = d->getBackgroundColor();
-        bgPainter.setPen(Qt::NoPen);
-        bgPainter.setBrush(bgColor);
-        bgPainter.drawRoundedRect(innerRect, radius, radius);
+        QtAntdInternal::drawChrome(&bgPainter, innerRect, radius, colors.background);
     }
 
     // Let QLineEdit draw text/caret/selection
     QLineEdit::paintEvent(event);
 
-    // Pass 2: outer glow (focus only) drawn on top, clipped to outside of inner rect and inside widget rect
-    {
-        QPainter glowPainter(this);
-        glowPainter.setRenderHint(QPainter::Antialiasing);
-        const QRectF widgetRect = QRectF(this->rect());
-
-        // Build clip so we only draw OUTSIDE the inner rounded rect
-        QPainterPath clipOuter; clipOuter.addRect(widgetRect);
-        QPainterPath clipInner; clipInner.addRoundedRect(innerRect, radius, radius);
-        QPainterPath clipPath = clipOuter.subtracted(clipInner);
-        glowPainter.save();
-        glowPainter.setClipPath(clipPath);
-
-        if (d->isFocused) {
-            QColor base = d->getBorderColor();
-            const int glowExtent = qMax(3,d->getVisualMargin()); // outward pixels
-            int alpha = 4;           // start alpha slightly stronger
-            for (int o = glowExtent; o >= 1; --o) {
-                QColor cc = base; cc.setAlpha(alpha);
-                const QRectF rr = innerRect.adjusted(-o, -o, o, o);
-                glowPainter.setPen(Qt::NoPen);
-                glowPainter.setBrush(cc);
-                glowPainter.drawRoundedRect(rr, radius + o, radius + o);
-                // decay alpha gradually but keep minimum visibility
-                alpha -= 1; if (alpha < 1) alpha = 1;
-            }
-            // A crisp near-border stroke to enhance edge
-            QColor edge = base; edge.setAlpha(120);
-            const QRectF rr = innerRect.adjusted(-1, -1, 1, 1);
-            glowPainter.setPen(QPen(edge, 2, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
-            glowPainter.setBrush(Qt::NoBrush);
-            glowPainter.drawRoundedRect(rr, radius + 1, radius + 1);
-        }
-
-        glowPainter.restore();
-    }
-
-    // Pass 3: draw border and prefix/suffix on very top so the border is always visible
+    // Pass 2: outer glow (focus only) and, on top of it, border and prefix/suffix
+    // so the border is always visible
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing);
-
-    // Border
-    const QColor borderColor = d->getBorderColor();
-    painter.setBrush(Qt::NoBrush);
-    painter.setPen(QPen(borderColor, gAntdBorderWidth));
-    painter.drawRoundedRect(innerRect, radius, radius);
-
-    // Prefix
-    QRect prefixRect = d->prefixRect();
-    if (!prefixRect.isEmpty()) {
-        painter.setPen(d->getTextColor());
-        if (!d->prefixText.isEmpty()) {
-            painter.drawText(prefixRect, Qt::AlignCenter, d->prefixText);
-        } else if (!d->prefixIcon.isNull()) {
-            QPixmap pixmap = d->prefixIcon.pixmap(16, 16);
-            painter.drawPixmap(prefixRect.center() - QPoint(8, 8), pixmap);
+    paintInputOverlay(&painter, this->rect(), innerRect, vm, colors, d->isFocused,
+                      d->prefixRect(), d->prefixText, d->prefixIcon,
+                      d->suffixRect(), d->suffixText, d->suffixIcon);
+}
+
+/*!
+ * Paints an input box with the given options into rect, as a QtAntdInput would
+ * paint itself, without needing a widget. rect includes options.glowMargin on
+ * every side. The text (or placeholder) is elided to the space between the
+ * prefix and suffix; there is no caret or selection.
+ */
+void QtAntdInput::paint(QPainter *painter, const QRect &rect, const QtAntdInputOptions &options)
+{
+    const int margin = options.glowMargin;
+    const QRectF innerRect = QRectF(rect).adjusted(margin + 0.5, margin + 0.5, -(margin + 0.5), -(margin + 0.5));
+    const QtAntdInputColors colors = resolveInputColors(options.useThemeColors, options.status,
+                                                        options.enabled, options.focused, options.hovered);
+    const QFontMetrics fm(options.font);
+    const int padding = horizontalPaddingFor(options.size);
+    const QRect prefix = affixRect(rect, fm, padding, margin, options.prefixText, options.prefixIcon, false);
+    const QRect suffix = affixRect(rect, fm, padding, margin, options.suffixText, options.suffixIcon, true);
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setFont(options.font);
+
+    QtAntdInternal::drawChrome(painter, innerRect, gAntdBorderRadius, colors.background);
+
+    // Text between the affixes
+    const int left = prefix.isNull() ? rect.left() + padding + margin : prefix.right() + 1 + gAntdIconSpacing;
+    const int right = suffix.isNull() ? rect.right() - padding - margin : suffix.left() - 1 - gAntdIconSpacing;
+    const QRect textRect(left, rect.top() + margin, right - left + 1, rect.height() - 2 * margin);
+    const bool placeholder = options.text.isEmpty();
+    const QString &text = placeholder ? options.placeholderText : options.text;
+    if (!text.isEmpty() && textRect.width() > 0) {
+        QColor textColor = colors.text;
+        if (placeholder) {
+            textColor = options.useThemeColors
+                ? QtAntdStyle::instance().themeColor(Antd::ColorTextQuaternary)
+                : QColor("#bfbfbf");
         }
+        painter->setPen(textColor);
+        QtAntdInternal::drawCachedText(painter, textRect, Qt::AlignLeft | Qt::AlignVCenter,
+                                       fm.elidedText(text, Qt::ElideRight, textRect.width()));
     }
 
-    // Suffix
-    QRect suffixRect = d->suffixRect();
-    if (!suffixRect.isEmpty()) {
-        painter.setPen(d->getTextColor());
-        if (!d->suffixText.isEmpty()) {
-            painter.drawText(suffixRect, Qt::AlignCenter, d->suffixText);
-        } else if (!d->suffixIcon.isNull()) {
-            QPixmap pixmap = d->suffixIcon.pixmap(16, 16);
-            painter.drawPixmap(suffixRect.center() - QPoint(8, 8), pixmap);
-        }
+    paintInputOverlay(painter, rect, innerRect, margin, colors, options.focused,
+                      prefix, options.prefixText, options.prefixIcon,
+                      suffix, options.suffixText, options.suffixIcon);
+    painter->restore();
+}
+
+QSize QtAntdInput::sizeHint(const QtAntdInputOptions &options)
+{
+    const QFontMetrics fm(options.font);
+    const QString &text = options.text.isEmpty() ? options.placeholderText : options.text;
+
+    int width = fm.horizontalAdvance(text) + 2 * horizontalPaddingFor(options.size);
+    if (!options.prefixText.isEmpty() || !options.prefixIcon.isNull()) {
+        width += (options.prefixText.isEmpty() ? 16 : fm.horizontalAdvance(options.prefixText)) + gAntdIconSpacing;
+    }
+    if (!options.suffixText.isEmpty() || !options.suffixIcon.isNull()) {
+        width += (options.suffixText.isEmpty() ? 16 : fm.horizontalAdvance(options.suffixText)) + gAntdIconSpacing;
     }
+    return QSize(width + 2 * options.glowMargin, inputHeightFor(options.size) + 2 * options.glowMargin);
 }
 
 void QtAntdInput::focusInEvent(QFocusEvent *event)
 {
     Q_D(QtAntdInput);
     d->isFocused = true;
-    update();
+    QtAntdInternal::requestUpdate(this);
     QLineEdit::focusInEvent(event);
 }
 
@@ -613,7 +718,7 @@ void QtAntdInput::focusOutEvent(QFocusEvent *event)
 {
     Q_D(QtAntdInput);
     d->isFocused = false;
-    update();
+    QtAntdInternal::requestUpdate(this);
     QLineEdit::focusOutEvent(event);
 }
 
@@ -626,7 +731,7 @@ void QtAntdInput::mousePressEvent(QMouseEvent *event)
         QRect clearRect = d->clearButtonRect();
         if (clearRect.contains(event->pos())) {
             d->clearButtonPressed = true;
-            update();
+            QtAntdInternal::requestUpdate(this);
             return;
         }
     }
@@ -647,7 +752,7 @@ void QtAntdInput::mouseReleaseEvent(QMouseEvent *event)
             onClearButtonClicked();
         }
         
-        update();
+        QtAntdInternal::requestUpdate(this);
         return;
     }
     
@@ -668,7 +773,7 @@ void QtAntdInput::mouseMoveEvent(QMouseEvent *event)
     if (d->clearButtonHovered != overClearButton) {
         d->clearButtonHovered = overClearButton;
         setCursor(overClearButton ? Qt::PointingHandCursor : Qt::IBeamCursor);
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
     
     QLineEdit::mouseMoveEvent(event);
@@ -682,7 +787,7 @@ void QtAntdInput::enterEvent(QEvent *event)
 {
     Q_D(QtAntdInput);
     d->isHovered = true;
-    update();
+    QtAntdInternal::requestUpdate(this);
     QLineEdit::enterEvent(event);
 }
 
@@ -692,7 +797,7 @@ void QtAntdInput::leaveEvent(QEvent *event)
     d->isHovered = false;
     d->clearButtonHovered = false;
     setCursor(Qt::IBeamCursor);
-    update();
+    QtAntdInternal::requestUpdate(this);
     QLineEdit::leaveEvent(event);
 }
 
@@ -6,9 +6,17 @@
 #include <QIcon>
 #include <QRect>
 #include <QToolButton>
+#include "antdlib/qtantdcolorcache_p.h"
 
 class QtAntdInput;
 
+struct QtAntdInputColors
+{
+    QColor border;
+    QColor background;
+    QColor text;
+};
+
 class QtAntdInputPrivate
 {
     Q_DISABLE_COPY(QtAntdInputPrivate)
@@ -35,9 +43,8 @@ public:
     int getBorderRadius() const;
     
     // Drawing helpers
-    QColor getBorderColor() const;
-    QColor getBackgroundColor() const;
-    QColor getTextColor() const;
+    const QtAntdInputColors &colors();
+    int colorState() const;
 
     // Visual margin reserved for focus glow (kept constant to avoid layout jump)
     int getVisualMargin() const { return focusGlowExtent; }
@@ -65,6 +72,9 @@ public:
 
     // Reserved outward glow extent (px). Also used as visual margin around inner content rect
     int focusGlowExtent { 4 }; 
+
+    // Resolved colors per (enabled, focused, hovered) state
+    QtAntdInternal::ResolvedColorCache<QtAntdInputColors, 8> colorCache;
 };
 
 #endif // QTANTDINPUT_P_H
\ No newline at end of file
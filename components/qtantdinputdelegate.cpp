@@ -0,0 +1,221 @@
+#include "qtantdinputdelegate.h"
+#include "qtantdinputdelegate_p.h"
+#include <QAbstractItemModel>
+#include <QPainter>
+#include <QStyle>
+
+// Space kept between the input box and the left/right item border
+static const int gAntdItemMargin = 4;
+
+/*!
+ * \class QtAntdInputDelegatePrivate
+ * \internal
+ */
+
+/*!
+ * \internal
+ */
+QtAntdInputDelegatePrivate::QtAntdInputDelegatePrivate(QtAntdInputDelegate *q)
+    : q_ptr(q)
+    , inputSize(QtAntdInput::Small)
+    , useThemeColors(true)
+    , interaction([this](const QWidget *, const QRect &cellRect, const QModelIndex &) {
+        return boxRect(cellRect);
+    })
+{
+}
+
+/*!
+ * \internal
+ */
+QtAntdInputDelegatePrivate::~QtAntdInputDelegatePrivate()
+{
+}
+
+/*!
+ * \internal
+ * Height of the painted box including its glow margin, which is also the fixed
+ * height of a QtAntdInput of the same size.
+ */
+int QtAntdInputDelegatePrivate::boxHeight() const
+{
+    QtAntdInputOptions options;
+    options.size = inputSize;
+    return QtAntdInput::sizeHint(options).height();
+}
+
+/*!
+ * \internal
+ * Area of the painted box and of the editor: the item width, vertically centered.
+ */
+QRect QtAntdInputDelegatePrivate::boxRect(const QRect &cellRect) const
+{
+    const QRect area = cellRect.adjusted(gAntdItemMargin, 0, -gAntdItemMargin, 0);
+    const int height = boxHeight();
+    return QRect(area.left(), area.top() + (area.height() - height) / 2, area.width(), height);
+}
+
+/*!
+ * \class QtAntdInputDelegate
+ */
+
+QtAntdInputDelegate::QtAntdInputDelegate(QObject *parent)
+    : QStyledItemDelegate(parent)
+    , d_ptr(new QtAntdInputDelegatePrivate(this))
+{
+}
+
+QtAntdInputDelegate::~QtAntdInputDelegate()
+{
+}
+
+void QtAntdInputDelegate::setInputSize(QtAntdInput::InputSize size)
+{
+    Q_D(QtAntdInputDelegate);
+
+    if (d->inputSize != size) {
+        d->inputSize = size;
+        emit sizeHintChanged(QModelIndex());
+    }
+}
+
+QtAntdInput::InputSize QtAntdInputDelegate::inputSize() const
+{
+    Q_D(const QtAntdInputDelegate);
+
+    return d->inputSize;
+}
+
+void QtAntdInputDelegate::setPlaceholderText(const QString &text)
+{
+    Q_D(QtAntdInputDelegate);
+
+    if (d->placeholderText != text) {
+        d->placeholderText = text;
+        d->interaction.updateViews();
+    }
+}
+
+QString QtAntdInputDelegate::placeholderText() const
+{
+    Q_D(const QtAntdInputDelegate);
+
+    return d->placeholderText;
+}
+
+void QtAntdInputDelegate::setUseThemeColors(bool value)
+{
+    Q_D(QtAntdInputDelegate);
+
+    if (d->useThemeColors != value) {
+        d->useThemeColors = value;
+        d->interaction.updateViews();
+    }
+}
+
+bool QtAntdInputDelegate::useThemeColors() const
+{
+    Q_D(const QtAntdInputDelegate);
+
+    return d->useThemeColors;
+}
+
+/*!
+ * \reimp
+ */
+void QtAntdInputDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option,
+                                const QModelIndex &index) const
+{
+    Q_D(const QtAntdInputDelegate);
+
+    d->interaction.watch(option.widget);
+
+    QStyleOptionViewItem itemOption = option;
+    initStyleOption(&itemOption, index);
+    QtAntdInternal::drawItemPanel(painter, itemOption);
+
+    QtAntdInputOptions options;
+    options.text = itemOption.text;
+    options.placeholderText = d->placeholderText;
+    options.font = itemOption.font;
+    options.size = d->inputSize;
+    options.useThemeColors = d->useThemeColors;
+    options.enabled = option.state.testFlag(QStyle::State_Enabled);
+    options.hovered = d->interaction.isHovered(option.widget, index);
+    QtAntdInput::paint(painter, d->boxRect(option.rect), options);
+}
+
+/*!
+ * \reimp
+ */
+QSize QtAntdInputDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    Q_D(const QtAntdInputDelegate);
+
+    QStyleOptionViewItem itemOption = option;
+    initStyleOption(&itemOption, index);
+
+    QtAntdInputOptions options;
+    options.text = itemOption.text;
+    options.placeholderText = d->placeholderText;
+    options.font = itemOption.font;
+    options.size = d->inputSize;
+    return QtAntdInput::sizeHint(options) + QSize(2 * gAntdItemMargin, 0);
+}
+
+/*!
+ * \reimp
+ */
+QWidget *QtAntdInputDelegate::createEditor(QWidget *parent, const QStyleOptionViewItem &option,
+                                           const QModelIndex &index) const
+{
+    Q_UNUSED(option);
+    Q_UNUSED(index);
+    Q_D(const QtAntdInputDelegate);
+
+    QtAntdInput *editor = new QtAntdInput(d->placeholderText, parent);
+    editor->setInputSize(d->inputSize);
+    editor->setUseThemeColors(d->useThemeColors);
+    return editor;
+}
+
+/*!
+ * \reimp
+ */
+void QtAntdInputDelegate::setEditorData(QWidget *editor, const QModelIndex &index) const
+{
+    QtAntdInput *input = qobject_cast<QtAntdInput *>(editor);
+    if (!input) {
+        QStyledItemDelegate::setEditorData(editor, index);
+        return;
+    }
+
+    input->setText(index.data(Qt::EditRole).toString());
+}
+
+/*!
+ * \reimp
+ */
+void QtAntdInputDelegate::setModelData(QWidget *editor, QAbstractItemModel *model,
+                                       const QModelIndex &index) const
+{
+    QtAntdInput *input = qobject_cast<QtAntdInput *>(editor);
+    if (!input) {
+        QStyledItemDelegate::setModelData(editor, model, index);
+        return;
+    }
+
+    model->setData(index, input->text(), Qt::EditRole);
+}
+
+/*!
+ * \reimp
+ */
+void QtAntdInputDelegate::updateEditorGeometry(QWidget *editor, const QStyleOptionViewItem &option,
+                                               const QModelIndex &index) const
+{
+    Q_UNUSED(index);
+    Q_D(const QtAntdInputDelegate);
+
+    editor->setGeometry(d->boxRect(option.rect));
+}
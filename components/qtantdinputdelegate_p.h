@@ -0,0 +1,32 @@
+#ifndef QTANTDINPUTDELEGATE_P_H
+#define QTANTDINPUTDELEGATE_P_H
+
+#include <QtGlobal>
+#include <QString>
+#include "antdlib/qtantddelegateinteraction_p.h"
+
+class QtAntdInputDelegate;
+
+class QtAntdInputDelegatePrivate
+{
+    Q_DISABLE_COPY(QtAntdInputDelegatePrivate)
+    Q_DECLARE_PUBLIC(QtAntdInputDelegate)
+
+public:
+    QtAntdInputDelegatePrivate(QtAntdInputDelegate *q);
+    ~QtAntdInputDelegatePrivate();
+
+    int boxHeight() const;
+    QRect boxRect(const QRect &cellRect) const;
+
+    QtAntdInputDelegate *const q_ptr;
+
+    QtAntdInput::InputSize inputSize;
+    QString placeholderText;
+    bool useThemeColors;
+
+    // Views are watched from the const paint()
+    mutable QtAntdInternal::DelegateInteraction interaction;
+};
+
+#endif // QTANTDINPUTDELEGATE_P_H
@@ -0,0 +1,381 @@
+#include "qtantdsearchproxymodel.h"
+#include "qtantdsearchproxymodel_p.h"
+#include <QAbstractItemModel>
+#include <QCoreApplication>
+#include <QPointer>
+#include <QThreadPool>
+
+/*!
+ * \class QtAntdSearchProxyModelPrivate
+ * \internal
+ */
+
+/*!
+ * \internal
+ */
+QtAntdSearchProxyModelPrivate::QtAntdSearchProxyModelPrivate(QtAntdSearchProxyModel *q)
+    : q_ptr(q)
+    , searchColumn(0)
+    , searching(false)
+    , active(false)
+    , generation(new QAtomicInteger<quint64>(0))
+{
+}
+
+/*!
+ * \internal
+ */
+QtAntdSearchProxyModelPrivate::~QtAntdSearchProxyModelPrivate()
+{
+    // Stops searches still running; they hold their own reference to the counter
+    nextGeneration();
+    if (index) {
+        index->removeListener(this);
+    }
+}
+
+/*!
+ * \internal
+ * Rows are hidden while an applied search waits for its index to be rebuilt.
+ */
+bool QtAntdSearchProxyModelPrivate::accepts(int sourceRow) const
+{
+    if (!active) {
+        return true;
+    }
+    if (!index || !index->isReady()) {
+        return false;
+    }
+    const int id = index->index().idOfRow(sourceRow);
+    return id >= 0 && id < matched.size() && matched.testBit(id);
+}
+
+/*!
+ * \internal
+ * Starts a new search generation, cancelling the running search.
+ */
+quint64 QtAntdSearchProxyModelPrivate::nextGeneration()
+{
+    return generation->fetchAndAddOrdered(1) + 1;
+}
+
+void QtAntdSearchProxyModelPrivate::setSearching(bool value)
+{
+    Q_Q(QtAntdSearchProxyModel);
+
+    if (searching == value) {
+        return;
+    }
+    searching = value;
+    emit q->searchingChanged(value);
+}
+
+void QtAntdSearchProxyModelPrivate::clearResult()
+{
+    foldedResultQuery.clear();
+    resultIds.clear();
+    matched.clear();
+}
+
+/*!
+ * \internal
+ * Switches to the shared index of searchColumn in source. It is only built
+ * once something is searched.
+ */
+void QtAntdSearchProxyModelPrivate::attachIndex(QAbstractItemModel *source)
+{
+    nextGeneration();
+    if (index) {
+        index->removeListener(this);
+        index.reset();
+    }
+    active = false;
+    clearResult();
+
+    if (source) {
+        index = QtAntdInternal::SharedSearchIndex::acquire(source, searchColumn);
+        index->addListener(this);
+    }
+    if (foldedQuery.isEmpty()) {
+        setSearching(false);
+    } else {
+        requestSearch();
+    }
+}
+
+/*!
+ * \internal
+ * Checks ids from firstId on, added since the applied result was computed,
+ * against its query.
+ */
+void QtAntdSearchProxyModelPrivate::matchNewIds(int firstId)
+{
+    const QtAntdInternal::SearchIndex &texts = index->index();
+    matched.resize(texts.idLimit());
+    for (int id = firstId; id < texts.idLimit(); ++id) {
+        if (texts.matches(id, foldedResultQuery)) {
+            matched.setBit(id);
+            resultIds.append(id);
+        }
+    }
+}
+
+/*!
+ * \internal
+ * Searches for foldedQuery, once the index is built.
+ */
+void QtAntdSearchProxyModelPrivate::requestSearch()
+{
+    if (!index) {
+        setSearching(false);
+        return;
+    }
+    if (!index->isReady()) {
+        // Searched from searchIndexReady()
+        nextGeneration();
+        setSearching(true);
+        index->ensureBuilt();
+        return;
+    }
+    startSearch();
+}
+
+/*!
+ * \internal
+ * Searches a snapshot of the index for foldedQuery on a worker thread. When
+ * the query extends the applied one, only the rows it matched are checked.
+ */
+void QtAntdSearchProxyModelPrivate::startSearch()
+{
+    Q_Q(QtAntdSearchProxyModel);
+
+    const quint64 current = nextGeneration();
+    setSearching(true);
+
+    const bool narrow = active && !foldedResultQuery.isEmpty() && foldedQuery.contains(foldedResultQuery);
+    const QVector<int> candidates = narrow ? resultIds : QVector<int>();
+    const QtAntdInternal::SearchIndex snapshot = index->index();
+    const QString query = foldedQuery;
+    const int idLimit = snapshot.idLimit();
+    const QSharedPointer<QAtomicInteger<quint64>> token = generation;
+    const QPointer<QtAntdSearchProxyModel> receiver(q);
+    QThreadPool::globalInstance()->start([=]() {
+        const QVector<int> ids = snapshot.search(query, narrow ? &candidates : nullptr, token.data(), current);
+        QCoreApplication *app = QCoreApplication::instance();
+        if (token->loadAcquire() != current || !app) {
+            return;
+        }
+        QMetaObject::invokeMethod(app, [ids, idLimit, current, receiver]() {
+            if (receiver) {
+                receiver->d_func()->applyResult(ids, idLimit, current);
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+/*!
+ * \internal
+ * Shows the rows of ids, the matches among the ids below idLimit; rows added
+ * while the search ran are checked here. When the query extends the applied
+ * one, the base class only re-checks the rows shown.
+ */
+void QtAntdSearchProxyModelPrivate::applyResult(const QVector<int> &ids, int idLimit, quint64 current)
+{
+    Q_Q(QtAntdSearchProxyModel);
+
+    if (generation->loadAcquire() != current) {
+        return;
+    }
+
+    // A query extending the applied one can only hide rows shown now
+    const bool narrow = active && !foldedResultQuery.isEmpty() && foldedQuery.contains(foldedResultQuery);
+
+    matched = QBitArray(index->index().idLimit());
+    for (const int id : ids) {
+        matched.setBit(id);
+    }
+    resultIds = ids;
+    foldedResultQuery = foldedQuery;
+    matchNewIds(idLimit);
+    active = true;
+    setSearching(false);
+    if (narrow) {
+        q->narrowFilter();
+    } else {
+        q->invalidateFilter();
+    }
+}
+
+/*!
+ * \internal
+ */
+void QtAntdSearchProxyModelPrivate::searchIndexReady()
+{
+    if (!foldedQuery.isEmpty()) {
+        startSearch();
+    }
+}
+
+/*!
+ * \internal
+ * Rows inserted or edited in the source; the base class filters them next.
+ */
+void QtAntdSearchProxyModelPrivate::searchIndexIdsAdded(int firstId)
+{
+    if (active && !foldedResultQuery.isEmpty()) {
+        matchNewIds(firstId);
+    }
+}
+
+/*!
+ * \internal
+ * The applied result stays active, hiding every row until the index is built
+ * again and searched.
+ */
+void QtAntdSearchProxyModelPrivate::searchIndexDropped()
+{
+    nextGeneration();
+    clearResult();
+    setSearching(!foldedQuery.isEmpty());
+}
+
+/*!
+ *  \class QtAntdSearchProxyModel
+ */
+
+QtAntdSearchProxyModel::QtAntdSearchProxyModel(QObject *parent)
+    : QtAntdTableProxyModel(parent)
+    , d_ptr(new QtAntdSearchProxyModelPrivate(this))
+{
+}
+
+QtAntdSearchProxyModel::~QtAntdSearchProxyModel()
+{
+}
+
+void QtAntdSearchProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    Q_D(QtAntdSearchProxyModel);
+
+    if (sourceModel == this->sourceModel()) {
+        return;
+    }
+
+    // Acquired ahead of the base class connecting to the source, so the index
+    // already follows a source change when the base class filters the rows
+    d->attachIndex(sourceModel);
+    QtAntdTableProxyModel::setSourceModel(sourceModel);
+    resetFilter();
+}
+
+void QtAntdSearchProxyModel::setSearchColumn(int column)
+{
+    Q_D(QtAntdSearchProxyModel);
+
+    if (d->searchColumn == column) {
+        return;
+    }
+    d->searchColumn = column;
+
+    QAbstractItemModel *source = sourceModel();
+    if (!source) {
+        return;
+    }
+    // The index of the new column may connect to the source only now, and
+    // must still see source changes before the base class
+    QtAntdTableProxyModel::setSourceModel(nullptr);
+    d->attachIndex(source);
+    QtAntdTableProxyModel::setSourceModel(source);
+    resetFilter();
+}
+
+int QtAntdSearchProxyModel::searchColumn() const
+{
+    Q_D(const QtAntdSearchProxyModel);
+
+    return d->searchColumn;
+}
+
+void QtAntdSearchProxyModel::setSearchText(const QString &text)
+{
+    Q_D(QtAntdSearchProxyModel);
+
+    if (d->searchText == text) {
+        return;
+    }
+    d->searchText = text;
+    d->foldedQuery = QtAntdInternal::foldSearchText(text);
+
+    if (d->foldedQuery.isEmpty()) {
+        d->nextGeneration();
+        d->active = false;
+        d->clearResult();
+        d->setSearching(false);
+        resetFilter();
+        return;
+    }
+
+    if (d->active && d->foldedQuery == d->foldedResultQuery) {
+        // Back to the applied result, e.g. after a typo was erased
+        d->nextGeneration();
+        d->setSearching(false);
+        return;
+    }
+
+    d->requestSearch();
+}
+
+QString QtAntdSearchProxyModel::searchText() const
+{
+    Q_D(const QtAntdSearchProxyModel);
+
+    return d->searchText;
+}
+
+bool QtAntdSearchProxyModel::isSearching() const
+{
+    Q_D(const QtAntdSearchProxyModel);
+
+    return d->searching;
+}
+
+QModelIndex QtAntdSearchProxyModel::findExact(const QString &text) const
+{
+    Q_D(const QtAntdSearchProxyModel);
+
+    const QAbstractItemModel *source = sourceModel();
+    if (!source || text.isEmpty()) {
+        return QModelIndex();
+    }
+
+    if (!d->index || !d->index->isReady()) {
+        const QModelIndexList found = source->match(source->index(0, d->searchColumn), Qt::DisplayRole, text, 1,
+                                                    Qt::MatchFixedString | Qt::MatchCaseSensitive);
+        return found.value(0);
+    }
+
+    // Equal texts fold equally, and contain the applied query if text does
+    const QString folded = QtAntdInternal::foldSearchText(text);
+    const bool narrow = d->active && !d->foldedResultQuery.isEmpty() && folded.contains(d->foldedResultQuery);
+    const QtAntdInternal::SearchIndex &texts = d->index->index();
+    for (const int id : texts.search(folded, narrow ? &d->resultIds : nullptr)) {
+        if (!texts.isText(id, folded)) {
+            continue;
+        }
+        const QModelIndex index = source->index(texts.rowOfId(id), d->searchColumn);
+        if (index.data(Qt::DisplayRole).toString() == text) {
+            return index;
+        }
+    }
+    return QModelIndex();
+}
+
+/*!
+ * Accepts rows matching the search text, then the column filters.
+ */
+bool QtAntdSearchProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
+{
+    Q_D(const QtAntdSearchProxyModel);
+
+    return d->accepts(sourceRow) && QtAntdTableProxyModel::filterAcceptsRow(sourceRow, sourceParent);
+}
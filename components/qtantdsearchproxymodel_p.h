@@ -0,0 +1,64 @@
+#ifndef QTANTDSEARCHPROXYMODEL_P_H
+#define QTANTDSEARCHPROXYMODEL_P_H
+
+#include <QtGlobal>
+#include <QAtomicInteger>
+#include <QBitArray>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+#include "antdlib/qtantdsharedsearchindex_p.h"
+
+class QAbstractItemModel;
+class QtAntdSearchProxyModel;
+
+class QtAntdSearchProxyModelPrivate : public QtAntdInternal::SearchIndexListener
+{
+    Q_DISABLE_COPY(QtAntdSearchProxyModelPrivate)
+    Q_DECLARE_PUBLIC(QtAntdSearchProxyModel)
+
+public:
+    QtAntdSearchProxyModelPrivate(QtAntdSearchProxyModel *q);
+    ~QtAntdSearchProxyModelPrivate();
+
+    bool accepts(int sourceRow) const;
+    quint64 nextGeneration();
+    void setSearching(bool value);
+    void clearResult();
+
+    // Index
+    void attachIndex(QAbstractItemModel *source);
+    void matchNewIds(int firstId);
+
+    // Searching
+    void requestSearch();
+    void startSearch();
+    void applyResult(const QVector<int> &ids, int idLimit, quint64 generation);
+
+    // QtAntdInternal::SearchIndexListener, told before the base class sees a
+    // source change
+    void searchIndexReady() override;
+    void searchIndexIdsAdded(int firstId) override;
+    void searchIndexDropped() override;
+
+    QtAntdSearchProxyModel *const q_ptr;
+
+    int searchColumn;
+    QString searchText;
+    QString foldedQuery;
+    bool searching;
+
+    // Index of the source texts in searchColumn, shared with other users
+    QSharedPointer<QtAntdInternal::SharedSearchIndex> index;
+
+    // Applied result: matched is by index id, for foldedResultQuery
+    bool active;
+    QString foldedResultQuery;
+    QVector<int> resultIds; // Ascending
+    QBitArray matched;
+
+    // Bumped for every search; a search holding an older value stops
+    QSharedPointer<QAtomicInteger<quint64>> generation;
+};
+
+#endif // QTANTDSEARCHPROXYMODEL_P_H
@@ -0,0 +1,1332 @@
+#include "qtantdselect.h"
+#include "qtantdselect_p.h"
+#include "qtantdinput.h"
+#include "qtantdsearchproxymodel.h"
+#include "antdlib/qtantdalphamask_p.h"
+#include "antdlib/qtantdchrome_p.h"
+#include "antdlib/qtantdinstrumentation_p.h"
+#include "antdlib/qtantdrendercache_p.h"
+#include "antdlib/qtantdtextcache_p.h"
+#include "antdlib/qtantdthemeregistry_p.h"
+#include "../include/qtantd/lib/qtantdstyle.h"
+#include <QAbstractItemModel>
+#include <QApplication>
+#include <QGuiApplication>
+#include <QKeyEvent>
+#include <QLineEdit>
+#include <QListView>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPainterPath>
+#include <QScreen>
+#include <QVBoxLayout>
+#include <algorithm>
+
+namespace {
+
+const int gGlyphSize = 12;
+const int gGlyphCacheKb = 64;
+const int gItemHeight = 32;
+const int gItemPadding = 12;
+const int gItemRadius = 4;
+const int gPopupPadding = 4;
+const int gPopupRadius = 8;
+const int gPopupGap = 4;
+const int gTagPadding = 8;
+const int gTagSpacing = 4;
+const int gTagRadius = 4;
+const int gTagMaxTextWidth = 160;
+const int gMultipleInset = 4; // Left inset of the tags in the box
+const int gSearchMinWidth = 40;
+const int gMinimumWidth = 120;
+
+enum Glyph {
+    ChevronGlyph,
+    CheckGlyph,
+    CloseGlyph
+};
+
+// Glyph coverage, shared by every select; colored when drawn
+const QImage &glyphMask(Glyph glyph, qreal dpr)
+{
+    thread_local QtAntdInternal::RenderCache<QImage> cache(gGlyphCacheKb);
+
+    QtAntdInternal::RenderCacheKey key;
+    key.add(int(glyph)).add(dpr);
+
+    if (const QImage *cached = cache.find(key)) {
+        return *cached;
+    }
+
+    QImage mask = QtAntdInternal::createAlphaMask(QSize(gGlyphSize, gGlyphSize), dpr);
+
+    QPainter painter(&mask);
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    painter.setBrush(Qt::NoBrush);
+
+    QPainterPath path;
+    switch (glyph) {
+    case ChevronGlyph:
+        painter.setPen(QPen(Qt::black, 1.5, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
+        path.moveTo(2.5, 4.5);
+        path.lineTo(6, 8);
+        path.lineTo(9.5, 4.5);
+        break;
+    case CheckGlyph:
+        painter.setPen(QPen(Qt::black, 1.5, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
+        path.moveTo(2, 6.5);
+        path.lineTo(5, 9.5);
+        path.lineTo(10, 3);
+        break;
+    case CloseGlyph:
+        painter.setPen(QPen(Qt::black, 1.2, Qt::SolidLine, Qt::RoundCap));
+        path.moveTo(3.5, 3.5);
+        path.lineTo(8.5, 8.5);
+        path.moveTo(8.5, 3.5);
+        path.lineTo(3.5, 8.5);
+        break;
+    }
+    painter.drawPath(path);
+    painter.end();
+
+    return *cache.insert(key, mask, mask.sizeInBytes());
+}
+
+// Draws glyph centered in rect
+void drawGlyph(QPainter *painter, const QRect &rect, Glyph glyph, const QColor &color)
+{
+    const QImage &mask = glyphMask(glyph, painter->device()->devicePixelRatioF());
+    const QRectF target(rect.x() + (rect.width() - gGlyphSize) / 2,
+                        rect.y() + (rect.height() - gGlyphSize) / 2,
+                        gGlyphSize, gGlyphSize);
+    QtAntdInternal::drawAlphaMask(painter, target, mask, mask.rect(), color);
+}
+
+QtAntdInput::InputSize inputSizeFor(QtAntdSelect::SelectSize size)
+{
+    switch (size) {
+    case QtAntdSelect::Small:
+        return QtAntdInput::Small;
+    case QtAntdSelect::Large:
+        return QtAntdInput::Large;
+    case QtAntdSelect::Medium:
+    default:
+        return QtAntdInput::Medium;
+    }
+}
+
+int tagHeightFor(QtAntdSelect::SelectSize size)
+{
+    switch (size) {
+    case QtAntdSelect::Small:
+        return 16;
+    case QtAntdSelect::Large:
+        return 32;
+    case QtAntdSelect::Medium:
+    default:
+        return 24;
+    }
+}
+
+} // namespace
+
+/*!
+ * \class QtAntdSelectPopup
+ * \internal
+ */
+
+QtAntdSelectPopup::QtAntdSelectPopup(QtAntdSelectPrivate *select)
+    : QFrame(select->q_ptr, Qt::Popup | Qt::FramelessWindowHint | Qt::NoDropShadowWindowHint)
+    , view(new QListView(this))
+    , m_select(select)
+{
+    setAttribute(Qt::WA_TranslucentBackground, true);
+
+    // Uniform rows let the view place any row without measuring the others
+    view->setUniformItemSizes(true);
+    view->setFrameShape(QFrame::NoFrame);
+    view->setFocusPolicy(Qt::NoFocus);
+    view->setSelectionMode(QAbstractItemView::NoSelection);
+    view->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    view->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    view->setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+    view->setAutoFillBackground(false);
+    view->viewport()->setAutoFillBackground(false);
+    view->setMouseTracking(true);
+    view->viewport()->setMouseTracking(true);
+    view->installEventFilter(this);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(gPopupPadding, gPopupPadding, gPopupPadding, gPopupPadding);
+    layout->addWidget(view);
+
+    installEventFilter(this);
+}
+
+/*!
+ * \internal
+ * The popup grabs the keyboard: navigation keys drive the list and everything
+ * else is typed into the search field of the select.
+ */
+bool QtAntdSelectPopup::eventFilter(QObject *watched, QEvent *event)
+{
+    if (event->type() == QEvent::InputMethod && m_select->isSearchable()) {
+        QApplication::sendEvent(m_select->search, event);
+        return true;
+    }
+    if (event->type() != QEvent::KeyPress) {
+        return QFrame::eventFilter(watched, event);
+    }
+
+    QKeyEvent *keyEvent = static_cast<QKeyEvent *>(event);
+    switch (keyEvent->key()) {
+    case Qt::Key_Up:
+    case Qt::Key_Down:
+    case Qt::Key_PageUp:
+    case Qt::Key_PageDown:
+        if (watched != view) {
+            QApplication::sendEvent(view, event);
+            return true;
+        }
+        return false;
+    case Qt::Key_Return:
+    case Qt::Key_Enter:
+        m_select->activateCurrent();
+        return true;
+    case Qt::Key_Escape:
+    case Qt::Key_Tab:
+    case Qt::Key_Backtab:
+        hide();
+        return true;
+    case Qt::Key_Backspace:
+        if (m_select->mode != QtAntdSelect::Single && m_select->search->text().isEmpty()) {
+            m_select->removeEntry(m_select->entries.size() - 1);
+            return true;
+        }
+        break;
+    default:
+        break;
+    }
+
+    if (m_select->isSearchable()) {
+        QApplication::sendEvent(m_select->search, event);
+    }
+    return true;
+}
+
+void QtAntdSelectPopup::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event)
+
+    const QtAntdSelectColors &colors = m_select->colors();
+
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+    QtAntdInternal::drawChrome(&painter, QRectF(rect()).adjusted(0.5, 0.5, -0.5, -0.5), gPopupRadius,
+                               colors.popup, colors.popupBorder, 1);
+
+    if (m_select->filter->rowCount() == 0 && !m_select->filter->isPending()
+        && !m_select->filter->isSearching()) {
+        painter.setPen(colors.placeholder);
+        QtAntdInternal::drawCachedText(&painter, rect(), Qt::AlignCenter, QtAntdSelect::tr("No data"));
+    }
+}
+
+/*!
+ * \internal
+ * A press outside closes the popup. On a tag close button it removes the tag
+ * and keeps the popup open; elsewhere on the select it is not replayed, so it
+ * does not reopen the popup.
+ */
+void QtAntdSelectPopup::mousePressEvent(QMouseEvent *event)
+{
+    QWidget *select = m_select->q_ptr;
+    if (!rect().contains(event->pos())) {
+        const QPoint pos = select->mapFromGlobal(mapToGlobal(event->pos()));
+        if (select->rect().contains(pos)) {
+            const QVector<QtAntdSelectTag> tags = m_select->layoutTags();
+            for (const QtAntdSelectTag &tag : tags) {
+                if (tag.closeRect.contains(pos)) {
+                    m_select->removeEntry(tag.entry);
+                    return;
+                }
+            }
+            setAttribute(Qt::WA_NoMouseReplay);
+        }
+    }
+    QFrame::mousePressEvent(event);
+}
+
+void QtAntdSelectPopup::hideEvent(QHideEvent *event)
+{
+    QFrame::hideEvent(event);
+    m_select->popupHidden();
+}
+
+/*!
+ * \class QtAntdSelectItemDelegate
+ * \internal
+ */
+
+QtAntdSelectItemDelegate::QtAntdSelectItemDelegate(QtAntdSelectPrivate *select, QObject *parent)
+    : QStyledItemDelegate(parent)
+    , m_select(select)
+{
+}
+
+void QtAntdSelectItemDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option,
+                                     const QModelIndex &index) const
+{
+    const QtAntdSelectColors &colors = m_select->colors();
+    const bool selected = m_select->isSelected(m_select->filter->mapToSource(index));
+    const bool active = index == m_select->popup->view->currentIndex();
+    const bool enabled = index.flags().testFlag(Qt::ItemIsEnabled);
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+
+    if (selected) {
+        QtAntdInternal::drawChrome(painter, option.rect, gItemRadius, colors.itemSelected);
+    } else if (active && enabled) {
+        QtAntdInternal::drawChrome(painter, option.rect, gItemRadius, colors.itemActive);
+    }
+
+    QRect textRect = option.rect.adjusted(gItemPadding, 0, -gItemPadding, 0);
+    if (selected && m_select->mode != QtAntdSelect::Single) {
+        const QRect checkRect(textRect.right() + 1 - gGlyphSize, textRect.top(), gGlyphSize, textRect.height());
+        drawGlyph(painter, checkRect, CheckGlyph, colors.check);
+        textRect.setRight(checkRect.left() - gTagSpacing);
+    }
+
+    QFont font = option.font;
+    if (selected) {
+        font.setWeight(QFont::DemiBold);
+    }
+    painter->setFont(font);
+    painter->setPen(enabled ? colors.itemText : colors.itemDisabled);
+
+    const QString text = index.data(Qt::DisplayRole).toString();
+    QtAntdInternal::drawCachedText(painter, textRect, Qt::AlignLeft | Qt::AlignVCenter,
+                                   QFontMetrics(font).elidedText(text, Qt::ElideRight, textRect.width()));
+
+    painter->restore();
+}
+
+QSize QtAntdSelectItemDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    const QString text = index.data(Qt::DisplayRole).toString();
+    return QSize(option.fontMetrics.horizontalAdvance(text) + 2 * gItemPadding, gItemHeight);
+}
+
+/*!
+ * \class QtAntdSelectPrivate
+ * \internal
+ */
+
+/*!
+ * \internal
+ */
+QtAntdSelectPrivate::QtAntdSelectPrivate(QtAntdSelect *q)
+    : q_ptr(q)
+    , model(nullptr)
+    , modelColumn(0)
+    , mode(QtAntdSelect::Single)
+    , selectSize(QtAntdSelect::Medium)
+    , showSearch(false)
+    , useThemeColors(true)
+    , hovered(false)
+    , maxVisibleItems(8)
+    , selectedRowsDirty(false)
+    , filter(nullptr)
+    , popup(nullptr)
+    , delegate(nullptr)
+    , search(nullptr)
+{
+}
+
+/*!
+ * \internal
+ */
+QtAntdSelectPrivate::~QtAntdSelectPrivate()
+{
+}
+
+/*!
+ * \internal
+ */
+void QtAntdSelectPrivate::init()
+{
+    Q_Q(QtAntdSelect);
+
+    q->setFocusPolicy(Qt::StrongFocus);
+    q->setAttribute(Qt::WA_Hover, true);
+    q->setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Fixed);
+
+    filter = new QtAntdSearchProxyModel(q);
+    popup = new QtAntdSelectPopup(this);
+    delegate = new QtAntdSelectItemDelegate(this, q);
+    popup->view->setItemDelegate(delegate);
+    popup->view->setModel(filter);
+
+    search = new QLineEdit(q);
+    search->setFrame(false);
+    search->setFocusPolicy(Qt::ClickFocus);
+    search->setAttribute(Qt::WA_MacShowFocusRect, false);
+    QPalette palette = search->palette();
+    palette.setColor(QPalette::Base, Qt::transparent);
+    search->setPalette(palette);
+    search->hide();
+
+    QObject::connect(search, &QLineEdit::textChanged, q, [this](const QString &text) {
+        filter->setSearchText(text);
+        updateSearchGeometry();
+        QtAntdInternal::requestUpdate(q_ptr);
+    });
+
+    QListView *view = popup->view;
+    QObject::connect(view, &QAbstractItemView::entered, view, [view](const QModelIndex &index) {
+        if (index.flags().testFlag(Qt::ItemIsEnabled)) {
+            view->setCurrentIndex(index);
+        }
+    });
+    QObject::connect(view, &QAbstractItemView::clicked, q, [this](const QModelIndex &index) {
+        activate(filter->mapToSource(index));
+    });
+
+    QObject::connect(filter, &QAbstractItemModel::modelReset, q, [this]() { filterChanged(); });
+    QObject::connect(filter, &QAbstractItemModel::layoutChanged, q, [this]() { filterChanged(); });
+    QObject::connect(filter, &QAbstractItemModel::rowsInserted, q, [this]() { filterChanged(); });
+    QObject::connect(filter, &QAbstractItemModel::rowsRemoved, q, [this]() { filterChanged(); });
+    QObject::connect(filter, &QtAntdTableProxyModel::pendingChanged, q, [this]() { QtAntdInternal::requestUpdate(popup); });
+    QObject::connect(filter, &QtAntdSearchProxyModel::searchingChanged, q, [this]() { QtAntdInternal::requestUpdate(popup); });
+
+    QtAntdInternal::ThemeRegistry &registry = QtAntdInternal::ThemeRegistry::instance();
+    registry.registerWidget(q);
+    registry.registerWidget(popup);
+}
+
+/*!
+ * \internal
+ */
+const QtAntdSelectColors &QtAntdSelectPrivate::colors()
+{
+    Q_Q(QtAntdSelect);
+
+    return colorCache.get(0, [this, q]() {
+        QtAntdSelectColors resolved;
+        if (useThemeColors) {
+            QtAntdStyle &style = QtAntdStyle::instance();
+            resolved.text = style.themeColor(Antd::ColorText);
+            resolved.placeholder = style.themeColor(Antd::ColorTextQuaternary);
+            resolved.arrow = style.themeColor(Antd::ColorTextQuaternary);
+            resolved.tag = style.themeColor(Antd::ColorSurfaceVariant);
+            resolved.tagText = style.themeColor(Antd::ColorText);
+            resolved.tagClose = style.themeColor(Antd::ColorTextTertiary);
+            resolved.popup = style.themeColor(Antd::ColorBackground);
+            resolved.popupBorder = style.themeColor(Antd::ColorBorderSecondary);
+            resolved.itemActive = style.themeColor(Antd::ColorSurfaceVariant);
+            resolved.itemSelected = style.themeColor(Antd::ColorPrimaryBackground);
+            resolved.itemText = style.themeColor(Antd::ColorText);
+            resolved.itemDisabled = style.themeColor(Antd::ColorTextDisabled);
+            resolved.check = style.themeColor(Antd::ColorPrimary);
+        } else {
+            const QPalette palette = q->palette();
+            resolved.text = palette.color(QPalette::Text);
+            resolved.placeholder = palette.color(QPalette::Mid);
+            resolved.arrow = palette.color(QPalette::Mid);
+            resolved.tag = palette.color(QPalette::Button);
+            resolved.tagText = palette.color(QPalette::ButtonText);
+            resolved.tagClose = palette.color(QPalette::Mid);
+            resolved.popup = palette.color(QPalette::Base);
+            resolved.popupBorder = palette.color(QPalette::Mid);
+            resolved.itemActive = palette.color(QPalette::Midlight);
+            resolved.itemSelected = palette.color(QPalette::Highlight);
+            resolved.itemSelected.setAlpha(64);
+            resolved.itemText = palette.color(QPalette::Text);
+            resolved.itemDisabled = palette.color(QPalette::Disabled, QPalette::Text);
+            resolved.check = palette.color(QPalette::Highlight);
+        }
+        return resolved;
+    });
+}
+
+/*!
+ * \internal
+ * The visible box, inside the margin kept for the focus glow.
+ */
+QRect QtAntdSelectPrivate::boxRect() const
+{
+    Q_Q(const QtAntdSelect);
+
+    QtAntdInputOptions options;
+    const int margin = options.glowMargin;
+    return q->rect().adjusted(margin, margin, -margin, -margin);
+}
+
+/*!
+ * \internal
+ * Area for the value, tags and search field, left of the arrow.
+ */
+QRect QtAntdSelectPrivate::contentRect() const
+{
+    const QRect box = boxRect();
+    const int padding = horizontalPadding();
+    const int left = mode == QtAntdSelect::Single ? padding : gMultipleInset;
+    return QRect(box.left() + left, box.top() + 1,
+                 arrowRect().left() - gTagSpacing - box.left() - left, box.height() - 2);
+}
+
+QRect QtAntdSelectPrivate::arrowRect() const
+{
+    const QRect box = boxRect();
+    return QRect(box.right() + 1 - horizontalPadding() - gGlyphSize, box.top(), gGlyphSize, box.height());
+}
+
+int QtAntdSelectPrivate::horizontalPadding() const
+{
+    return selectSize == QtAntdSelect::Small ? 7 : 11;
+}
+
+/*!
+ * \internal
+ * Tags of the selected entries on one line. Entries that do not fit are
+ * summarized by a final "+ N ..." tag.
+ */
+QVector<QtAntdSelectTag> QtAntdSelectPrivate::layoutTags() const
+{
+    Q_Q(const QtAntdSelect);
+
+    QVector<QtAntdSelectTag> tags;
+    if (mode == QtAntdSelect::Single || entries.isEmpty()) {
+        return tags;
+    }
+
+    const QRect content = contentRect();
+    const QFontMetrics fm(q->font());
+    const int height = qMin(tagHeightFor(selectSize), content.height());
+    const int top = content.top() + (content.height() - height) / 2;
+    const int right = content.right() + 1 - (search->isVisible() ? gSearchMinWidth : 0);
+
+    int x = content.left();
+    for (int i = 0; i < entries.size(); ++i) {
+        const QString text = fm.elidedText(entryText(entries.at(i)), Qt::ElideRight, gTagMaxTextWidth);
+        const int width = fm.horizontalAdvance(text) + 2 * gTagPadding + gGlyphSize + gTagSpacing;
+
+        int reserved = 0;
+        if (i < entries.size() - 1) {
+            reserved = gTagSpacing + fm.horizontalAdvance(QStringLiteral("+ %1 ...").arg(entries.size() - i - 1))
+                + 2 * gTagPadding;
+        }
+
+        if (x + width + reserved > right) {
+            const QString more = QStringLiteral("+ %1 ...").arg(entries.size() - i);
+            QtAntdSelectTag tag;
+            tag.rect = QRect(x, top, fm.horizontalAdvance(more) + 2 * gTagPadding, height);
+            tag.text = more;
+            tag.entry = -1;
+            tags.append(tag);
+            break;
+        }
+
+        QtAntdSelectTag tag;
+        tag.rect = QRect(x, top, width, height);
+        tag.closeRect = QRect(tag.rect.right() + 1 - gTagPadding - gGlyphSize, top, gGlyphSize, height);
+        tag.text = text;
+        tag.entry = i;
+        tags.append(tag);
+        x += width + gTagSpacing;
+    }
+    return tags;
+}
+
+void QtAntdSelectPrivate::updateSearchGeometry()
+{
+    if (!search->isVisible()) {
+        return;
+    }
+
+    const QRect content = contentRect();
+    int left = content.left();
+    if (mode != QtAntdSelect::Single) {
+        const QVector<QtAntdSelectTag> tags = layoutTags();
+        left = tags.isEmpty() ? content.left() + horizontalPadding() - gMultipleInset
+                              : tags.last().rect.right() + 1 + gTagSpacing;
+    }
+    search->setGeometry(left, content.top(), qMax(1, content.right() + 1 - left), content.height());
+}
+
+/*!
+ * \internal
+ * Below the box when it fits on the screen, above otherwise.
+ */
+void QtAntdSelectPrivate::updatePopupGeometry()
+{
+    Q_Q(QtAntdSelect);
+
+    const int rows = filter->rowCount();
+    const int visibleRows = rows == 0 ? 2 : qMin(rows, maxVisibleItems);
+    const int height = visibleRows * gItemHeight + 2 * gPopupPadding;
+
+    const QRect box = boxRect();
+    QRect geometry(q->mapToGlobal(QPoint(box.left(), box.bottom() + 1 + gPopupGap)), QSize(box.width(), height));
+
+    if (QScreen *screen = QGuiApplication::screenAt(q->mapToGlobal(box.center()))) {
+        const QRect available = screen->availableGeometry();
+        if (geometry.bottom() > available.bottom()) {
+            geometry.moveBottom(q->mapToGlobal(QPoint(0, box.top() - gPopupGap)).y() - 1);
+        }
+    }
+    popup->setGeometry(geometry);
+}
+
+bool QtAntdSelectPrivate::isSearchable() const
+{
+    return mode != QtAntdSelect::Single || showSearch;
+}
+
+bool QtAntdSelectPrivate::isSelected(const QModelIndex &sourceIndex) const
+{
+    if (!sourceIndex.isValid()) {
+        return false;
+    }
+
+    if (selectedRowsDirty) {
+        selectedRows.clear();
+        for (const QtAntdSelectEntry &entry : entries) {
+            if (entry.index.isValid()) {
+                selectedRows.insert(entry.index.row());
+            }
+        }
+        selectedRowsDirty = false;
+    }
+    return selectedRows.contains(sourceIndex.row());
+}
+
+QString QtAntdSelectPrivate::entryText(const QtAntdSelectEntry &entry) const
+{
+    return entry.index.isValid() ? entry.index.data(Qt::DisplayRole).toString() : entry.text;
+}
+
+void QtAntdSelectPrivate::setEntries(const QVector<QtAntdSelectEntry> &value)
+{
+    Q_Q(QtAntdSelect);
+
+    bool changed = value.size() != entries.size();
+    for (int i = 0; !changed && i < value.size(); ++i) {
+        changed = value.at(i).index != entries.at(i).index || value.at(i).text != entries.at(i).text;
+    }
+    if (!changed) {
+        return;
+    }
+
+    entries = value;
+    selectedRowsDirty = true;
+    updateSearchGeometry();
+    QtAntdInternal::requestUpdate(q);
+    QtAntdInternal::requestUpdate(popup->view->viewport());
+    emit q->selectionChanged();
+}
+
+/*!
+ * \internal
+ * An option was chosen in the dropdown.
+ */
+void QtAntdSelectPrivate::activate(const QModelIndex &sourceIndex)
+{
+    if (!sourceIndex.isValid() || !sourceIndex.flags().testFlag(Qt::ItemIsEnabled)) {
+        return;
+    }
+
+    QtAntdSelectEntry entry;
+    entry.index = sourceIndex.sibling(sourceIndex.row(), modelColumn);
+
+    if (mode == QtAntdSelect::Single) {
+        setEntries(QVector<QtAntdSelectEntry>() << entry);
+        popup->hide();
+        return;
+    }
+
+    QVector<QtAntdSelectEntry> value = entries;
+    const auto it = std::find_if(value.begin(), value.end(), [&entry](const QtAntdSelectEntry &other) {
+        return other.index == entry.index;
+    });
+    if (it != value.end()) {
+        value.erase(it);
+    } else {
+        value.append(entry);
+    }
+    setEntries(value);
+    search->clear();
+}
+
+/*!
+ * \internal
+ * Source index of the option whose text is exactly text, looked up in the
+ * search index the typed text was searched in.
+ */
+QModelIndex QtAntdSelectPrivate::findOption(const QString &text) const
+{
+    return filter->findExact(text);
+}
+
+/*!
+ * \internal
+ * Enter in the dropdown. In Tags mode, typed text becomes a tag unless an
+ * option has exactly that text; that option is chosen instead.
+ */
+void QtAntdSelectPrivate::activateCurrent()
+{
+    const QModelIndex current = filter->mapToSource(popup->view->currentIndex());
+    const QString typed = search->text().trimmed();
+
+    if (mode == QtAntdSelect::Tags && !typed.isEmpty()
+        && (!current.isValid() || current.data(Qt::DisplayRole).toString() != typed)) {
+        const QModelIndex option = findOption(typed);
+        if (option.isValid()) {
+            activate(option);
+            return;
+        }
+        addTag(typed);
+        search->clear();
+        return;
+    }
+    activate(current);
+}
+
+void QtAntdSelectPrivate::addTag(const QString &text)
+{
+    for (const QtAntdSelectEntry &entry : entries) {
+        if (entryText(entry) == text) {
+            return;
+        }
+    }
+
+    QtAntdSelectEntry entry;
+    entry.text = text;
+    setEntries(QVector<QtAntdSelectEntry>(entries) << entry);
+}
+
+void QtAntdSelectPrivate::removeEntry(int entry)
+{
+    if (entry < 0 || entry >= entries.size()) {
+        return;
+    }
+
+    QVector<QtAntdSelectEntry> value = entries;
+    value.remove(entry);
+    setEntries(value);
+}
+
+/*!
+ * \internal
+ * Drops entries whose option was removed from the model.
+ */
+void QtAntdSelectPrivate::purgeEntries()
+{
+    QVector<QtAntdSelectEntry> value;
+    value.reserve(entries.size());
+    for (const QtAntdSelectEntry &entry : entries) {
+        if (entry.index.isValid() || !entry.text.isEmpty()) {
+            value.append(entry);
+        }
+    }
+    selectedRowsDirty = true;
+    setEntries(value);
+}
+
+void QtAntdSelectPrivate::connectModel()
+{
+    Q_Q(QtAntdSelect);
+
+    if (!model) {
+        return;
+    }
+
+    const auto rowsMoved = [this, q]() {
+        selectedRowsDirty = true;
+        QtAntdInternal::requestUpdate(q);
+    };
+    modelConnections
+        << QObject::connect(model, &QAbstractItemModel::rowsInserted, q, rowsMoved)
+        << QObject::connect(model, &QAbstractItemModel::rowsMoved, q, rowsMoved)
+        << QObject::connect(model, &QAbstractItemModel::layoutChanged, q, rowsMoved)
+        << QObject::connect(model, &QAbstractItemModel::rowsRemoved, q, [this]() { purgeEntries(); })
+        << QObject::connect(model, &QAbstractItemModel::modelReset, q, [this]() { purgeEntries(); })
+        << QObject::connect(model, &QAbstractItemModel::dataChanged, q, [this, q]() {
+               updateSearchGeometry();
+               QtAntdInternal::requestUpdate(q);
+           })
+        << QObject::connect(model, &QObject::destroyed, q, [this]() {
+               disconnectModel();
+               model = nullptr;
+               filter->setSourceModel(nullptr);
+               purgeEntries();
+           });
+}
+
+void QtAntdSelectPrivate::disconnectModel()
+{
+    for (const QMetaObject::Connection &connection : modelConnections) {
+        QObject::disconnect(connection);
+    }
+    modelConnections.clear();
+}
+
+/*!
+ * \internal
+ * The filtered options changed: resize the dropdown and keep an active option.
+ */
+void QtAntdSelectPrivate::filterChanged()
+{
+    if (!popup->isVisible()) {
+        return;
+    }
+
+    updatePopupGeometry();
+    QListView *view = popup->view;
+    if (!view->currentIndex().isValid() && filter->rowCount() > 0) {
+        view->setCurrentIndex(filter->index(0, modelColumn));
+    }
+    QtAntdInternal::requestUpdate(popup);
+}
+
+void QtAntdSelectPrivate::popupHidden()
+{
+    Q_Q(QtAntdSelect);
+
+    const bool hadFocus = search->hasFocus();
+    search->hide();
+    search->clear();
+    if (hadFocus) {
+        q->setFocus(Qt::PopupFocusReason);
+    }
+    QtAntdInternal::requestUpdate(q);
+}
+
+/*!
+ * \class QtAntdSelect
+ */
+
+QtAntdSelect::QtAntdSelect(QWidget *parent)
+    : QWidget(parent)
+    , d_ptr(new QtAntdSelectPrivate(this))
+{
+    d_func()->init();
+}
+
+QtAntdSelect::~QtAntdSelect()
+{
+    Q_D(QtAntdSelect);
+
+    d->disconnectModel();
+    QtAntdInternal::ThemeRegistry &registry = QtAntdInternal::ThemeRegistry::instance();
+    registry.unregisterWidget(this);
+    registry.unregisterWidget(d->popup);
+}
+
+void QtAntdSelect::setMode(SelectMode mode)
+{
+    Q_D(QtAntdSelect);
+
+    if (d->mode == mode) {
+        return;
+    }
+
+    hidePopup();
+    d->mode = mode;
+
+    // Keep what the new mode can hold
+    const QVector<QtAntdSelectEntry> &entries = d->entries;
+    QVector<QtAntdSelectEntry> value;
+    for (const QtAntdSelectEntry &entry : entries) {
+        if (entry.index.isValid() || mode == Tags) {
+            value.append(entry);
+        }
+    }
+    if (mode == Single && value.size() > 1) {
+        value.resize(1);
+    }
+    d->setEntries(value);
+    QtAntdInternal::requestUpdate(this);
+}
+
+QtAntdSelect::SelectMode QtAntdSelect::mode() const
+{
+    Q_D(const QtAntdSelect);
+
+    return d->mode;
+}
+
+void QtAntdSelect::setSelectSize(SelectSize size)
+{
+    Q_D(QtAntdSelect);
+
+    if (d->selectSize == size) {
+        return;
+    }
+
+    d->selectSize = size;
+    updateGeometry();
+    d->updateSearchGeometry();
+    QtAntdInternal::requestUpdate(this);
+}
+
+QtAntdSelect::SelectSize QtAntdSelect::selectSize() const
+{
+    Q_D(const QtAntdSelect);
+
+    return d->selectSize;
+}
+
+void QtAntdSelect::setUseThemeColors(bool value)
+{
+    Q_D(QtAntdSelect);
+
+    if (d->useThemeColors == value) {
+        return;
+    }
+
+    d->useThemeColors = value;
+    d->colorCache.invalidate();
+    QtAntdInternal::requestUpdate(this);
+}
+
+bool QtAntdSelect::useThemeColors() const
+{
+    Q_D(const QtAntdSelect);
+
+    return d->useThemeColors;
+}
+
+void QtAntdSelect::setModel(QAbstractItemModel *model)
+{
+    Q_D(QtAntdSelect);
+
+    if (d->model == model) {
+        return;
+    }
+
+    hidePopup();
+    d->disconnectModel();
+    d->model = model;
+    d->connectModel();
+    d->filter->setSourceModel(model);
+    d->setEntries(QVector<QtAntdSelectEntry>());
+}
+
+QAbstractItemModel *QtAntdSelect::model() const
+{
+    Q_D(const QtAntdSelect);
+
+    return d->model;
+}
+
+void QtAntdSelect::setModelColumn(int column)
+{
+    Q_D(QtAntdSelect);
+
+    if (d->modelColumn == column) {
+        return;
+    }
+
+    hidePopup();
+    d->modelColumn = column;
+    d->filter->setSearchColumn(column);
+    d->popup->view->setModelColumn(column);
+
+    QVector<QtAntdSelectEntry> value = d->entries;
+    for (QtAntdSelectEntry &entry : value) {
+        if (entry.index.isValid()) {
+            entry.index = entry.index.sibling(entry.index.row(), column);
+        }
+    }
+    d->setEntries(value);
+    QtAntdInternal::requestUpdate(this);
+}
+
+int QtAntdSelect::modelColumn() const
+{
+    Q_D(const QtAntdSelect);
+
+    return d->modelColumn;
+}
+
+void QtAntdSelect::setPlaceholderText(const QString &text)
+{
+    Q_D(QtAntdSelect);
+
+    if (d->placeholderText == text) {
+        return;
+    }
+
+    d->placeholderText = text;
+    updateGeometry();
+    QtAntdInternal::requestUpdate(this);
+}
+
+QString QtAntdSelect::placeholderText() const
+{
+    Q_D(const QtAntdSelect);
+
+    return d->placeholderText;
+}
+
+void QtAntdSelect::setShowSearch(bool value)
+{
+    Q_D(QtAntdSelect);
+
+    d->showSearch = value;
+}
+
+bool QtAntdSelect::showSearch() const
+{
+    Q_D(const QtAntdSelect);
+
+    return d->showSearch;
+}
+
+void QtAntdSelect::setMaxVisibleItems(int count)
+{
+    Q_D(QtAntdSelect);
+
+    d->maxVisibleItems = qMax(1, count);
+    if (d->popup->isVisible()) {
+        d->updatePopupGeometry();
+    }
+}
+
+int QtAntdSelect::maxVisibleItems() const
+{
+    Q_D(const QtAntdSelect);
+
+    return d->maxVisibleItems;
+}
+
+void QtAntdSelect::setCurrentIndex(const QModelIndex &index)
+{
+    Q_D(QtAntdSelect);
+
+    QVector<QtAntdSelectEntry> value;
+    if (index.isValid() && index.model() == d->model) {
+        QtAntdSelectEntry entry;
+        entry.index = index.sibling(index.row(), d->modelColumn);
+        value.append(entry);
+    }
+    d->setEntries(value);
+}
+
+QModelIndex QtAntdSelect::currentIndex() const
+{
+    Q_D(const QtAntdSelect);
+
+    for (const QtAntdSelectEntry &entry : d->entries) {
+        if (entry.index.isValid()) {
+            return entry.index;
+        }
+    }
+    return QModelIndex();
+}
+
+QString QtAntdSelect::currentText() const
+{
+    Q_D(const QtAntdSelect);
+
+    return d->entries.isEmpty() ? QString() : d->entryText(d->entries.first());
+}
+
+void QtAntdSelect::setSelectedIndexes(const QModelIndexList &indexes)
+{
+    Q_D(QtAntdSelect);
+
+    QVector<QtAntdSelectEntry> value;
+    QSet<int> rows;
+    for (const QModelIndex &index : indexes) {
+        if (!index.isValid() || index.model() != d->model || rows.contains(index.row())) {
+            continue;
+        }
+        rows.insert(index.row());
+
+        QtAntdSelectEntry entry;
+        entry.index = index.sibling(index.row(), d->modelColumn);
+        value.append(entry);
+        if (d->mode == Single) {
+            break;
+        }
+    }
+    d->setEntries(value);
+}
+
+QModelIndexList QtAntdSelect::selectedIndexes() const
+{
+    Q_D(const QtAntdSelect);
+
+    QModelIndexList indexes;
+    for (const QtAntdSelectEntry &entry : d->entries) {
+        if (entry.index.isValid()) {
+            indexes.append(entry.index);
+        }
+    }
+    return indexes;
+}
+
+QStringList QtAntdSelect::selectedTexts() const
+{
+    Q_D(const QtAntdSelect);
+
+    QStringList texts;
+    for (const QtAntdSelectEntry &entry : d->entries) {
+        texts.append(d->entryText(entry));
+    }
+    return texts;
+}
+
+void QtAntdSelect::clearSelection()
+{
+    Q_D(QtAntdSelect);
+
+    d->setEntries(QVector<QtAntdSelectEntry>());
+}
+
+void QtAntdSelect::showPopup()
+{
+    Q_D(QtAntdSelect);
+
+    if (!d->model || d->popup->isVisible()) {
+        return;
+    }
+
+    // Start at the selected option; only the rows around it are laid out
+    QListView *view = d->popup->view;
+    QModelIndex start;
+    if (!d->entries.isEmpty() && d->entries.first().index.isValid()) {
+        start = d->filter->mapFromSource(d->entries.first().index);
+    }
+    if (!start.isValid()) {
+        start = d->filter->index(0, d->modelColumn);
+    }
+
+    d->updatePopupGeometry();
+    d->popup->setAttribute(Qt::WA_NoMouseReplay, false);
+    d->popup->show();
+    view->setCurrentIndex(start);
+    if (start.isValid()) {
+        view->scrollTo(start, QAbstractItemView::PositionAtCenter);
+    }
+
+    if (d->isSearchable()) {
+        d->search->show();
+        d->updateSearchGeometry();
+        d->search->setFocus(Qt::PopupFocusReason);
+    }
+    QtAntdInternal::requestUpdate(this);
+}
+
+void QtAntdSelect::hidePopup()
+{
+    Q_D(QtAntdSelect);
+
+    d->popup->hide();
+}
+
+bool QtAntdSelect::isPopupVisible() const
+{
+    Q_D(const QtAntdSelect);
+
+    return d->popup->isVisible();
+}
+
+QSize QtAntdSelect::sizeHint() const
+{
+    Q_D(const QtAntdSelect);
+
+    QtAntdInputOptions options;
+    options.size = inputSizeFor(d->selectSize);
+    options.font = font();
+    options.placeholderText = d->placeholderText;
+
+    const QSize hint = QtAntdInput::sizeHint(options);
+    return QSize(qMax(gMinimumWidth, hint.width() + gGlyphSize + gTagSpacing), hint.height());
+}
+
+QSize QtAntdSelect::minimumSizeHint() const
+{
+    Q_D(const QtAntdSelect);
+
+    QtAntdInputOptions options;
+    options.size = inputSizeFor(d->selectSize);
+    options.font = font();
+
+    const QSize hint = QtAntdInput::sizeHint(options);
+    return QSize(hint.width() + gGlyphSize + gSearchMinWidth, hint.height());
+}
+
+void QtAntdSelect::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event)
+    Q_D(QtAntdSelect);
+    QTANTD_PAINT_SCOPE(this);
+
+    const bool open = d->popup->isVisible();
+
+    QPainter painter(this);
+
+    // The box is an input box without text
+    QtAntdInputOptions box;
+    box.size = inputSizeFor(d->selectSize);
+    box.font = font();
+    box.useThemeColors = d->useThemeColors;
+    box.enabled = isEnabled();
+    box.hovered = d->hovered;
+    box.focused = hasFocus() || open;
+    QtAntdInput::paint(&painter, rect(), box);
+
+    const QtAntdSelectColors &colors = d->colors();
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setFont(font());
+    drawGlyph(&painter, d->arrowRect(), ChevronGlyph, colors.arrow);
+
+    const QFontMetrics fm(font());
+    const QRect content = d->contentRect();
+    const bool searching = d->search->isVisible() && !d->search->text().isEmpty();
+
+    if (d->mode == Single) {
+        if (searching) {
+            return;
+        }
+        const bool placeholder = d->entries.isEmpty();
+        const QString text = placeholder ? d->placeholderText : d->entryText(d->entries.first());
+        // The value is dimmed while the search field is open over it
+        painter.setPen(placeholder || d->search->isVisible() ? colors.placeholder : colors.text);
+        QtAntdInternal::drawCachedText(&painter, content, Qt::AlignLeft | Qt::AlignVCenter,
+                                       fm.elidedText(text, Qt::ElideRight, content.width()));
+        return;
+    }
+
+    const QVector<QtAntdSelectTag> tags = d->layoutTags();
+    if (tags.isEmpty()) {
+        if (!searching) {
+            const QRect placeholderRect = content.adjusted(d->horizontalPadding() - gMultipleInset, 0, 0, 0);
+            painter.setPen(colors.placeholder);
+            QtAntdInternal::drawCachedText(&painter, placeholderRect, Qt::AlignLeft | Qt::AlignVCenter,
+                                           fm.elidedText(d->placeholderText, Qt::ElideRight,
+                                                         placeholderRect.width()));
+        }
+        return;
+    }
+
+    for (const QtAntdSelectTag &tag : tags) {
+        QtAntdInternal::drawChrome(&painter, tag.rect, gTagRadius, colors.tag);
+
+        QRect textRect = tag.rect.adjusted(gTagPadding, 0, -gTagPadding, 0);
+        if (!tag.closeRect.isNull()) {
+            textRect.setRight(tag.closeRect.left() - gTagSpacing);
+            drawGlyph(&painter, tag.closeRect, CloseGlyph, colors.tagClose);
+        }
+        painter.setPen(colors.tagText);
+        QtAntdInternal::drawCachedText(&painter, textRect, Qt::AlignLeft | Qt::AlignVCenter, tag.text);
+    }
+}
+
+void QtAntdSelect::mousePressEvent(QMouseEvent *event)
+{
+    Q_D(QtAntdSelect);
+
+    if (event->button() != Qt::LeftButton) {
+        QWidget::mousePressEvent(event);
+        return;
+    }
+
+    setFocus(Qt::MouseFocusReason);
+
+    const QVector<QtAntdSelectTag> tags = d->layoutTags();
+    for (const QtAntdSelectTag &tag : tags) {
+        if (tag.closeRect.contains(event->pos())) {
+            d->removeEntry(tag.entry);
+            return;
+        }
+    }
+
+    if (isPopupVisible()) {
+        hidePopup();
+    } else {
+        showPopup();
+    }
+}
+
+void QtAntdSelect::keyPressEvent(QKeyEvent *event)
+{
+    Q_D(QtAntdSelect);
+
+    switch (event->key()) {
+    case Qt::Key_Down:
+    case Qt::Key_Up:
+    case Qt::Key_Space:
+    case Qt::Key_Return:
+    case Qt::Key_Enter:
+    case Qt::Key_F4:
+        showPopup();
+        return;
+    case Qt::Key_Backspace:
+        if (d->mode != Single && !d->entries.isEmpty()) {
+            d->removeEntry(d->entries.size() - 1);
+            return;
+        }
+        break;
+    default:
+        // Typing opens the dropdown and starts a search
+        if (d->isSearchable() && !event->text().isEmpty() && event->text().at(0).isPrint()) {
+            showPopup();
+            if (isPopupVisible()) {
+                QApplication::sendEvent(d->search, event);
+                return;
+            }
+        }
+        break;
+    }
+    QWidget::keyPressEvent(event);
+}
+
+void QtAntdSelect::focusInEvent(QFocusEvent *event)
+{
+    QWidget::focusInEvent(event);
+    QtAntdInternal::requestUpdate(this);
+}
+
+void QtAntdSelect::focusOutEvent(QFocusEvent *event)
+{
+    QWidget::focusOutEvent(event);
+    QtAntdInternal::requestUpdate(this);
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+void QtAntdSelect::enterEvent(QEnterEvent *event)
+#else
+void QtAntdSelect::enterEvent(QEvent *event)
+#endif
+{
+    Q_D(QtAntdSelect);
+
+    d->hovered = true;
+    QtAntdInternal::requestUpdate(this);
+    QWidget::enterEvent(event);
+}
+
+void QtAntdSelect::leaveEvent(QEvent *event)
+{
+    Q_D(QtAntdSelect);
+
+    d->hovered = false;
+    QtAntdInternal::requestUpdate(this);
+    QWidget::leaveEvent(event);
+}
+
+void QtAntdSelect::resizeEvent(QResizeEvent *event)
+{
+    Q_D(QtAntdSelect);
+
+    QWidget::resizeEvent(event);
+    d->updateSearchGeometry();
+    if (d->popup->isVisible()) {
+        d->updatePopupGeometry();
+    }
+}
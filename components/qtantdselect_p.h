@@ -0,0 +1,150 @@
+#ifndef QTANTDSELECT_P_H
+#define QTANTDSELECT_P_H
+
+#include <QtGlobal>
+#include <QColor>
+#include <QFrame>
+#include <QMetaObject>
+#include <QPersistentModelIndex>
+#include <QRect>
+#include <QSet>
+#include <QStyledItemDelegate>
+#include <QVector>
+#include "antdlib/qtantdcolorcache_p.h"
+
+class QAbstractItemModel;
+class QLineEdit;
+class QListView;
+class QtAntdSelect;
+class QtAntdSelectPrivate;
+class QtAntdSearchProxyModel;
+
+struct QtAntdSelectColors
+{
+    QColor text;
+    QColor placeholder;
+    QColor arrow;
+    QColor tag;
+    QColor tagText;
+    QColor tagClose;
+    QColor popup;
+    QColor popupBorder;
+    QColor itemActive;
+    QColor itemSelected;
+    QColor itemText;
+    QColor itemDisabled;
+    QColor check;
+};
+
+// One selected value: a model option, or typed text in Tags mode
+struct QtAntdSelectEntry
+{
+    QPersistentModelIndex index;
+    QString text; // Only for typed tags
+};
+
+// A tag shown in the box; entry is -1 for the "+ N ..." overflow tag
+struct QtAntdSelectTag
+{
+    QRect rect;
+    QRect closeRect;
+    QString text;
+    int entry;
+};
+
+// Dropdown window holding the option list
+class QtAntdSelectPopup : public QFrame
+{
+public:
+    explicit QtAntdSelectPopup(QtAntdSelectPrivate *select);
+
+    QListView *view;
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) Q_DECL_OVERRIDE;
+    void paintEvent(QPaintEvent *event) Q_DECL_OVERRIDE;
+    void mousePressEvent(QMouseEvent *event) Q_DECL_OVERRIDE;
+    void hideEvent(QHideEvent *event) Q_DECL_OVERRIDE;
+
+private:
+    QtAntdSelectPrivate *const m_select;
+};
+
+// Option rows of the dropdown
+class QtAntdSelectItemDelegate : public QStyledItemDelegate
+{
+public:
+    QtAntdSelectItemDelegate(QtAntdSelectPrivate *select, QObject *parent);
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option,
+               const QModelIndex &index) const Q_DECL_OVERRIDE;
+    QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const Q_DECL_OVERRIDE;
+
+private:
+    QtAntdSelectPrivate *const m_select;
+};
+
+class QtAntdSelectPrivate
+{
+    Q_DISABLE_COPY(QtAntdSelectPrivate)
+    Q_DECLARE_PUBLIC(QtAntdSelect)
+
+public:
+    QtAntdSelectPrivate(QtAntdSelect *q);
+    ~QtAntdSelectPrivate();
+
+    void init();
+    const QtAntdSelectColors &colors();
+
+    // Layout
+    QRect boxRect() const;
+    QRect contentRect() const;
+    QRect arrowRect() const;
+    int horizontalPadding() const;
+    QVector<QtAntdSelectTag> layoutTags() const;
+    void updateSearchGeometry();
+    void updatePopupGeometry();
+
+    // Selection
+    bool isSearchable() const;
+    bool isSelected(const QModelIndex &sourceIndex) const;
+    QString entryText(const QtAntdSelectEntry &entry) const;
+    void setEntries(const QVector<QtAntdSelectEntry> &value);
+    QModelIndex findOption(const QString &text) const;
+    void activate(const QModelIndex &sourceIndex);
+    void activateCurrent();
+    void addTag(const QString &text);
+    void removeEntry(int entry);
+    void purgeEntries();
+
+    // Model
+    void connectModel();
+    void disconnectModel();
+    void filterChanged();
+    void popupHidden();
+
+    QtAntdSelect *const q_ptr;
+
+    QAbstractItemModel *model;
+    int modelColumn;
+    QtAntdSelect::SelectMode mode;
+    QtAntdSelect::SelectSize selectSize;
+    QString placeholderText;
+    bool showSearch;
+    bool useThemeColors;
+    bool hovered;
+    int maxVisibleItems;
+
+    QVector<QtAntdSelectEntry> entries;
+    mutable QSet<int> selectedRows; // Source rows of entries, for painting options
+    mutable bool selectedRowsDirty;
+
+    QtAntdSearchProxyModel *filter;
+    QtAntdSelectPopup *popup;
+    QtAntdSelectItemDelegate *delegate;
+    QLineEdit *search;
+    QVector<QMetaObject::Connection> modelConnections;
+    QtAntdInternal::ResolvedColorCache<QtAntdSelectColors, 1> colorCache;
+};
+
+#endif // QTANTDSELECT_P_H
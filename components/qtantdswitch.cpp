@@ -1,8 +1,13 @@
 #include "qtantdswitch.h"
 #include "qtantdswitch_p.h"
+#include "antdlib/qtantdthemeregistry_p.h"
+#include "antdlib/qtantdinstrumentation_p.h"
 
 #include "qtantdstyle.h"
 #include "antdlib/qtantdrippleoverlay_p.h"
+#include "antdlib/qtantdspinneratlas_p.h"
+#include "antdlib/qtantdtextcache_p.h"
+#include "antdlib/qtantdchrome_p.h"
 #include <QPainter>
 #include <QFontMetrics>
 #include <QApplication>
@@ -10,9 +15,7 @@
 #include <QKeyEvent>
 #include <QFocusEvent>
 #include <QEnterEvent>
-#include <QPropertyAnimation>
 #include <QEasingCurve>
-#include <QTimer>
 #include <QtMath>
 #include <QDebug>
 
@@ -32,7 +35,204 @@ static const int gLargeHandleSize = 24;
 
 static const int gHandlePadding = 2; // Padding around handle inside track
 static const int gAnimationDuration = 200; // milliseconds
-static const int gLoadingSpinnerSpeed = 16; // ms per frame (~60fps)
+static const qreal gLoadingDegreesPerMs = 0.375; // ~960ms per revolution
+
+struct SwitchMetrics
+{
+    int trackWidth;
+    int trackHeight;
+    int handleSize;
+    int handlePadding;
+};
+
+SwitchMetrics switchMetrics(QtAntdSwitch::SwitchSize size)
+{
+    switch (size) {
+    case QtAntdSwitch::Small:
+        return { gSmallTrackWidth, gSmallTrackHeight, gSmallHandleSize, gHandlePadding };
+    case QtAntdSwitch::Large:
+        return { gLargeTrackWidth, gLargeTrackHeight, gLargeHandleSize, gHandlePadding };
+    case QtAntdSwitch::Medium:
+    default:
+        return { gMediumTrackWidth, gMediumTrackHeight, gMediumHandleSize, gHandlePadding };
+    }
+}
+
+QtAntdSwitchColors resolveSwitchColors(bool useThemeColors, bool enabled, bool checked,
+                                       bool hovered, bool pressed)
+{
+    QtAntdSwitchColors colors;
+
+    if (!useThemeColors) {
+        colors.track = checked ? QColor("#1890ff") : QColor("#d9d9d9"); // Default blue / gray
+        colors.handle = QColor("#ffffff");
+        colors.text = QColor("#ffffff");
+        return colors;
+    }
+
+    QtAntdStyle &style = QtAntdStyle::instance();
+
+    if (!enabled) {
+        colors.track = style.themeColor(Antd::ColorDisabledBackground);
+        colors.handle = style.themeColor(Antd::ColorDisabled);
+        colors.text = style.themeColor(Antd::ColorTextDisabled);
+        return colors;
+    }
+
+    if (checked) {
+        if (pressed) {
+            colors.track = style.themeColor(Antd::ColorPrimaryActive);
+        } else if (hovered) {
+            colors.track = style.themeColor(Antd::ColorPrimaryHover);
+        } else {
+            colors.track = style.themeColor(Antd::ColorPrimary);
+        }
+    } else {
+        QColor borderColor = style.themeColor(Antd::ColorBorder);
+        if (pressed) {
+            colors.track = borderColor.darker(120);
+        } else if (hovered) {
+            colors.track = borderColor.darker(110);
+        } else {
+            colors.track = borderColor;
+        }
+    }
+    colors.handle = style.themeColor(Antd::ColorBackground);
+    colors.text = style.themeColor(Antd::ColorBackground);
+    return colors;
+}
+
+QRect switchTrackRect(const QRect &bounds, const SwitchMetrics &metrics)
+{
+    int x = bounds.x() + (bounds.width() - metrics.trackWidth) / 2;
+    int y = bounds.y() + (bounds.height() - metrics.trackHeight) / 2;
+    return QRect(x, y, metrics.trackWidth, metrics.trackHeight);
+}
+
+QRect switchHandleRect(const QRect &trackRect, const SwitchMetrics &metrics, qreal position)
+{
+    int handlePos = static_cast<int>(position * (metrics.trackWidth - metrics.handleSize - 2 * metrics.handlePadding));
+    int x = trackRect.x() + metrics.handlePadding + handlePos;
+    int y = trackRect.y() + (metrics.trackHeight - metrics.handleSize) / 2;
+    return QRect(x, y, metrics.handleSize, metrics.handleSize);
+}
+
+QRect switchTextRect(const QRect &trackRect, const SwitchMetrics &metrics, bool checked)
+{
+    // Text area is the track minus handle area
+    int width = metrics.trackWidth - metrics.handleSize - 3 * metrics.handlePadding;
+    int x;
+    if (checked) {
+        // Text on the left when checked
+        x = trackRect.x() + metrics.handlePadding;
+    } else {
+        // Text on the right when unchecked
+        x = trackRect.x() + metrics.handleSize + 2 * metrics.handlePadding;
+    }
+    return QRect(x, trackRect.y(), width, trackRect.height());
+}
+
+/*!
+ * \internal
+ * Track, content, handle, spinner and focus outline of a switch. Shared by
+ * QtAntdSwitch::paintEvent() and QtAntdSwitch::paint().
+ */
+void paintSwitch(QPainter *painter,
+                 const QRect &trackRect,
+                 const SwitchMetrics &metrics,
+                 const QtAntdSwitchOptions &options,
+                 qreal position,
+                 const QtAntdSwitchColors &colors,
+                 const QFont &trackFont)
+{
+    const QRect handleRect = switchHandleRect(trackRect, metrics, position);
+    const bool checked = options.checked;
+
+    // Draw track
+    QColor trackColor = colors.track;
+    QtAntdInternal::drawChrome(painter, trackRect, trackRect.height() / 2, trackColor);
+
+    // Draw text/icon in track
+    painter->save(); // save and restore painter state around text drawing
+    const QString &trackText = checked ? options.checkedText : options.uncheckedText;
+    if (!trackText.isEmpty()) {
+        painter->setPen(colors.text);
+        painter->setFont(trackFont);
+        QtAntdInternal::drawCachedText(painter, switchTextRect(trackRect, metrics, checked), Qt::AlignCenter, trackText);
+    }
+    painter->restore();
+
+    // Draw icons
+    const QIcon &trackIcon = checked ? options.checkedIcon : options.uncheckedIcon;
+    if (!trackIcon.isNull()) {
+        painter->save(); // save and restore painter state around icon drawing
+        QRect textRect = switchTextRect(trackRect, metrics, checked);
+        QSize iconSize(textRect.height() * 0.6, textRect.height() * 0.6);
+        QRect iconRect(textRect.center() - QPoint(iconSize.width()/2, iconSize.height()/2), iconSize);
+        trackIcon.paint(painter, iconRect);
+        painter->restore();
+    }
+
+    // Prepare handle draw rect (pressed -> horizontal oval for dynamic effect)
+    QRect handleDrawRect = handleRect;
+    if (!options.loading && options.enabled && options.pressed) {
+        int extra = qMax(2, metrics.handleSize / 6); // how much to stretch
+        if (checked) {
+            // stretch toward the left when checked (handle on the right)
+            handleDrawRect.adjust(-extra, 0, 0, 0);
+        } else {
+            // stretch toward the right when unchecked (handle on the left)
+            handleDrawRect.adjust(0, 0, +extra, 0);
+        }
+        // Keep inside the track's inner area
+        const int inset = (metrics.trackHeight - metrics.handleSize) / 2;
+        QRect innerTrack = trackRect.adjusted(metrics.handlePadding, inset, -metrics.handlePadding, -inset);
+        handleDrawRect = handleDrawRect.intersected(innerTrack);
+    }
+
+    // Draw handle. A round handle is a fully rounded rect and comes from the chrome
+    // cache; the transient pressed oval is drawn directly.
+    QColor handleColor = colors.handle;
+    const bool roundHandle = handleDrawRect.width() == handleDrawRect.height();
+    auto drawHandleShape = [&](const QRect &rect, const QColor &color) {
+        if (roundHandle) {
+            QtAntdInternal::drawChrome(painter, rect, rect.width() / 2.0, color);
+        } else {
+            painter->setPen(Qt::NoPen);
+            painter->setBrush(color);
+            painter->drawEllipse(rect);
+        }
+    };
+
+    // Add subtle shadow for handle
+    if (options.enabled) {
+        QColor shadowColor = Qt::black;
+        shadowColor.setAlpha(30);
+        drawHandleShape(handleDrawRect.adjusted(1, 1, 1, 1), shadowColor);
+    }
+
+    drawHandleShape(handleDrawRect, handleColor);
+
+    // Draw loading spinner if loading
+    if (options.loading) {
+        // Use floating-point geometry to keep the arc perfectly centered
+        const QRectF spinnerRect = QRectF(handleDrawRect).adjusted(2.0, 2.0, -2.0, -2.0);
+
+        // Pen width considered in the diameter to avoid visual offset
+        const qreal penWidth = 1.5;
+        const qreal diameter = qMin(spinnerRect.width(), spinnerRect.height()) - penWidth;
+
+        QtAntdInternal::drawSpinner(painter, spinnerRect.center(), diameter, penWidth, 80,
+                                    trackColor.darker(150), options.loadingAngle);
+    }
+
+    // Draw focus outline
+    if (options.focused && !options.loading) {
+        QRect focusRect = trackRect.adjusted(-2, -2, 2, 2);
+        QtAntdInternal::drawChrome(painter, focusRect, focusRect.height() / 2, QColor(),
+                                   trackColor, 2, Qt::DashLine);
+    }
+}
 }
 
 QtAntdSwitchPrivate::QtAntdSwitchPrivate(QtAntdSwitch *q)
@@ -43,9 +243,12 @@ QtAntdSwitchPrivate::QtAntdSwitchPrivate(QtAntdSwitch *q)
     , isHovered(false)
     , isPressed(false)
     , hasFocus(false)
-    , toggleAnimation(nullptr)
+    , toggleAnimation(q)
+    , toggleEasing(QEasingCurve::OutCubic)
+    , toggleStartValue(0.0)
+    , toggleEndValue(0.0)
     , animationValue(0.0)
-    , loadingTimer(nullptr)
+    , loadingAnimation(q)
     , loadingAngle(0)
     , trackWidth(gMediumTrackWidth)
     , trackHeight(gMediumTrackHeight)
@@ -56,9 +259,6 @@ QtAntdSwitchPrivate::QtAntdSwitchPrivate(QtAntdSwitch *q)
 
 QtAntdSwitchPrivate::~QtAntdSwitchPrivate()
 {
-    if (loadingTimer) {
-        loadingTimer->stop();
-    }
 }
 
 void QtAntdSwitchPrivate::init()
@@ -66,214 +266,121 @@ void QtAntdSwitchPrivate::init()
     Q_Q(QtAntdSwitch);
     
     // Setup animation
-    toggleAnimation = new QPropertyAnimation(q, "animationValue");
-    toggleAnimation->setDuration(gAnimationDuration);
-    toggleAnimation->setEasingCurve(QEasingCurve::OutCubic);
-    
-    // Setup loading timer
-    loadingTimer = new QTimer(q);
-    QObject::connect(loadingTimer, &QTimer::timeout, [this]() {
-        // 6 degrees per tick at ~60fps => ~480ms per revolution
-        loadingAngle = (loadingAngle + 6) % 360;
-        q_ptr->update();
+    toggleAnimation.setTickFunction([this](qint64 elapsed) {
+        const qreal progress = qMin<qreal>(1.0, qreal(elapsed) / gAnimationDuration);
+        const qreal eased = toggleEasing.valueForProgress(progress);
+        q_ptr->setAnimationValue(toggleStartValue + (toggleEndValue - toggleStartValue) * eased);
+        if (progress >= 1.0) {
+            toggleAnimation.stop();
+        }
+    });
+
+    // Setup loading animation
+    loadingAnimation.setTickFunction([this](qint64 elapsed) {
+        loadingAngle = int(elapsed * gLoadingDegreesPerMs) % 360;
+        QtAntdInternal::requestUpdate(q_ptr);
     });
     
     updateGeometry();
     
     // Set initial animation value based on checked state
     animationValue = q->isChecked() ? 1.0 : 0.0;
+
+    QtAntdInternal::ThemeRegistry::instance().registerWidget(q);
 }
 
 void QtAntdSwitchPrivate::updateGeometry()
 {
-    switch (switchSize) {
-    case QtAntdSwitch::Small:
-        trackWidth = gSmallTrackWidth;
-        trackHeight = gSmallTrackHeight;
-        handleSize = gSmallHandleSize;
-        break;
-    case QtAntdSwitch::Medium:
-        trackWidth = gMediumTrackWidth;
-        trackHeight = gMediumTrackHeight;
-        handleSize = gMediumHandleSize;
-        break;
-    case QtAntdSwitch::Large:
-        trackWidth = gLargeTrackWidth;
-        trackHeight = gLargeTrackHeight;
-        handleSize = gLargeHandleSize;
-        break;
-    }
+    const SwitchMetrics metrics = switchMetrics(switchSize);
+    trackWidth = metrics.trackWidth;
+    trackHeight = metrics.trackHeight;
+    handleSize = metrics.handleSize;
+    handlePadding = metrics.handlePadding;
     
     q_ptr->updateGeometry();
 }
 
-QColor QtAntdSwitchPrivate::getTrackColor() const
+const QtAntdSwitchColors &QtAntdSwitchPrivate::colors()
 {
-    Q_Q(const QtAntdSwitch);
-    
-    if (!useThemeColors) {
-        if (q->isChecked()) {
-            return QColor("#1890ff"); // Default blue
-        } else {
-            return QColor("#d9d9d9"); // Default gray
-        }
-    }
-    
-    QtAntdStyle &style = QtAntdStyle::instance();
-    
-    if (!q->isEnabled()) {
-        return style.themeColor("disabled-background");
-    }
-    
-    if (q->isChecked()) {
-        if (isPressed) {
-            return style.themeColor("primary-active");
-        } else if (isHovered) {
-            return style.themeColor("primary-hover");
-        } else {
-            return style.themeColor("primary");
-        }
-    } else {
-        QColor borderColor = style.themeColor("border");
-        if (isPressed) {
-            return borderColor.darker(120);
-        } else if (isHovered) {
-            return borderColor.darker(110);
-        } else {
-            return borderColor;
-        }
-    }
+    Q_Q(QtAntdSwitch);
+
+    return colorCache.get(colorState(), [this, q]() {
+        return resolveSwitchColors(useThemeColors, q->isEnabled(), q->isChecked(), isHovered, isPressed);
+    });
 }
 
-QColor QtAntdSwitchPrivate::getHandleColor() const
+int QtAntdSwitchPrivate::colorState() const
 {
     Q_Q(const QtAntdSwitch);
-    
-    if (!useThemeColors) {
-        return QColor("#ffffff");
-    }
-    
-    QtAntdStyle &style = QtAntdStyle::instance();
-    
-    if (!q->isEnabled()) {
-        return style.themeColor("disabled");
-    }
-    
-    return style.themeColor("background");
+
+    return (q->isEnabled() ? 1 : 0)
+         | (q->isChecked() ? 2 : 0)
+         | (isHovered ? 4 : 0)
+         | (isPressed ? 8 : 0);
 }
 
-QColor QtAntdSwitchPrivate::getTextColor() const
+const QFont &QtAntdSwitchPrivate::textFont()
 {
-    Q_Q(const QtAntdSwitch);
-    
-    if (!useThemeColors) {
-        return QColor("#ffffff");
-    }
-    
-    QtAntdStyle &style = QtAntdStyle::instance();
-    
-    if (!q->isEnabled()) {
-        return style.themeColor("text-disabled");
+    Q_Q(QtAntdSwitch);
+
+    // Widget font scaled to the track, derived again only when either changes
+    const int pixelSize = int(trackHeight * 0.5);
+    if (trackFontBase != q->font() || trackFont.pixelSize() != pixelSize) {
+        trackFontBase = q->font();
+        trackFont = trackFontBase;
+        trackFont.setPixelSize(pixelSize);
     }
-    
-    return style.themeColor("background");
+    return trackFont;
 }
 
-QRect QtAntdSwitchPrivate::getTrackRect() const
+void QtAntdSwitchPrivate::initOptions(QtAntdSwitchOptions *options) const
 {
     Q_Q(const QtAntdSwitch);
-    QRect rect = q->rect();
-    int x = (rect.width() - trackWidth) / 2;
-    int y = (rect.height() - trackHeight) / 2;
-    return QRect(x, y, trackWidth, trackHeight);
-}
 
-QRect QtAntdSwitchPrivate::getHandleRect() const
-{
-    QRect trackRect = getTrackRect();
-    int handlePos = static_cast<int>(animationValue * (trackWidth - handleSize - 2 * handlePadding));
-    int x = trackRect.x() + handlePadding + handlePos;
-    int y = trackRect.y() + (trackHeight - handleSize) / 2;
-    return QRect(x, y, handleSize, handleSize);
+    options->size = switchSize;
+    options->checked = q->isChecked();
+    options->position = animationValue;
+    options->checkedText = checkedText;
+    options->uncheckedText = uncheckedText;
+    options->checkedIcon = checkedIcon;
+    options->uncheckedIcon = uncheckedIcon;
+    options->font = q->font();
+    options->useThemeColors = useThemeColors;
+    options->enabled = q->isEnabled();
+    options->hovered = isHovered;
+    options->pressed = isPressed;
+    options->focused = hasFocus;
+    options->loading = isLoading;
+    options->loadingAngle = loadingAngle;
 }
 
-QRect QtAntdSwitchPrivate::getTextRect() const
+QRect QtAntdSwitchPrivate::getTrackRect() const
 {
-    QRect trackRect = getTrackRect();
-    // Text area is the track minus handle area
-    int textAreaWidth = trackWidth - handleSize - 3 * handlePadding;
-    int x, width;
-    
     Q_Q(const QtAntdSwitch);
-    if (q->isChecked()) {
-        // Text on the left when checked
-        x = trackRect.x() + handlePadding;
-        width = textAreaWidth;
-    } else {
-        // Text on the right when unchecked  
-        x = trackRect.x() + handleSize + 2 * handlePadding;
-        width = textAreaWidth;
-    }
-    
-    return QRect(x, trackRect.y(), width, trackRect.height());
+    return switchTrackRect(q->rect(), switchMetrics(switchSize));
 }
 
 void QtAntdSwitchPrivate::startToggleAnimation()
 {
     Q_Q(QtAntdSwitch);
     
-    if (toggleAnimation->state() == QAbstractAnimation::Running) {
-        toggleAnimation->stop();
-    }
-    
-    qreal targetValue = q->isChecked() ? 1.0 : 0.0;
-    
-    toggleAnimation->setStartValue(animationValue);
-    toggleAnimation->setEndValue(targetValue);
-    toggleAnimation->start();
+    // Restarting from the current value keeps a reversed toggle continuous
+    toggleStartValue = animationValue;
+    toggleEndValue = q->isChecked() ? 1.0 : 0.0;
+    toggleAnimation.start();
 }
 
 void QtAntdSwitchPrivate::startLoadingAnimation()
 {
-    if (loadingTimer && !loadingTimer->isActive()) {
+    if (!loadingAnimation.isRunning()) {
         loadingAngle = 0;
-        loadingTimer->start(gLoadingSpinnerSpeed);
+        loadingAnimation.start();
     }
 }
 
 void QtAntdSwitchPrivate::stopLoadingAnimation()
 {
-    if (loadingTimer) {
-        loadingTimer->stop();
-    }
-}
-
-void QtAntdSwitchPrivate::drawLoadingSpinner(QPainter *painter, const QRect &rect, const QColor &color)
-{
-    painter->save();
-    
-    // Use floating-point geometry to keep the arc perfectly centered
-    QRectF spinnerRect = QRectF(rect).adjusted(2.0, 2.0, -2.0, -2.0);
-    QPointF center = spinnerRect.center();
-    painter->setRenderHint(QPainter::Antialiasing, true);
-
-    // Pen width considered in radius to avoid visual offset
-    const qreal penWidth = 1.5;
-    const qreal radius = qMin(spinnerRect.width(), spinnerRect.height()) / 2.0 - penWidth / 2.0;
-
-    painter->translate(center);
-    painter->rotate(static_cast<qreal>(loadingAngle));
-    
-    // Draw spinning arc
-    QPen pen(color, penWidth);
-    pen.setCapStyle(Qt::RoundCap);
-    painter->setPen(pen);
-    painter->setBrush(Qt::NoBrush);
-    
-    QRectF arcRect(-radius, -radius, radius * 2.0, radius * 2.0);
-    painter->drawArc(arcRect, 0, 80 * 16); // 80 degrees in 1/16th degree units
-
-    painter->restore();
+    loadingAnimation.stop();
 }
 
 // QtAntdSwitch Implementation
@@ -302,6 +409,7 @@ QtAntdSwitch::QtAntdSwitch(const QString &text, QWidget *parent)
 
 QtAntdSwitch::~QtAntdSwitch()
 {
+    QtAntdInternal::ThemeRegistry::instance().unregisterWidget(this);
 }
 
 void QtAntdSwitch::setUseThemeColors(bool value)
@@ -309,7 +417,8 @@ void QtAntdSwitch::setUseThemeColors(bool value)
     Q_D(QtAntdSwitch);
     if (d->useThemeColors != value) {
         d->useThemeColors = value;
-        update();
+        d->colorCache.invalidate();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -325,7 +434,7 @@ void QtAntdSwitch::setSwitchSize(SwitchSize size)
     if (d->switchSize != size) {
         d->switchSize = size;
         d->updateGeometry();
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -340,7 +449,7 @@ void QtAntdSwitch::setCheckedText(const QString &text)
     Q_D(QtAntdSwitch);
     if (d->checkedText != text) {
         d->checkedText = text;
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -355,7 +464,7 @@ void QtAntdSwitch::setUncheckedText(const QString &text)
     Q_D(QtAntdSwitch);
     if (d->uncheckedText != text) {
         d->uncheckedText = text;
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -369,7 +478,7 @@ void QtAntdSwitch::setCheckedIcon(const QIcon &icon)
 {
     Q_D(QtAntdSwitch);
     d->checkedIcon = icon;
-    update();
+    QtAntdInternal::requestUpdate(this);
 }
 
 QIcon QtAntdSwitch::checkedIcon() const
@@ -382,7 +491,7 @@ void QtAntdSwitch::setUncheckedIcon(const QIcon &icon)
 {
     Q_D(QtAntdSwitch);
     d->uncheckedIcon = icon;
-    update();
+    QtAntdInternal::requestUpdate(this);
 }
 
 QIcon QtAntdSwitch::uncheckedIcon() const
@@ -403,7 +512,7 @@ void QtAntdSwitch::setLoading(bool loading)
             d->stopLoadingAnimation();
             setEnabled(true);
         }
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -435,7 +544,7 @@ void QtAntdSwitch::setAnimationValue(qreal value)
     Q_D(QtAntdSwitch);
     if (d->animationValue != value) {
         d->animationValue = value;
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
 }
 
@@ -443,99 +552,40 @@ void QtAntdSwitch::paintEvent(QPaintEvent *event)
 {
     Q_UNUSED(event);
     Q_D(QtAntdSwitch);
+    QTANTD_PAINT_SCOPE(this);
     
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing);
-    
-    QRect trackRect = d->getTrackRect();
-    QRect handleRect = d->getHandleRect();
-    
-    // Draw track
-    QColor trackColor = d->getTrackColor();
-    painter.setBrush(trackColor);
-    painter.setPen(Qt::NoPen);
-    painter.drawRoundedRect(trackRect, trackRect.height() / 2, trackRect.height() / 2);
-    
-    // Draw text/icon in track
-    painter.save(); // save and restore painter state around text drawing
-    if (isChecked() && !d->checkedText.isEmpty()) {
-        painter.setPen(d->getTextColor());
-        QFont font = painter.font();
-        font.setPixelSize(d->trackHeight * 0.5); // Scale font to track
-        painter.setFont(font);
-        QRect textRect = d->getTextRect();
-        painter.drawText(textRect, Qt::AlignCenter, d->checkedText);
-    } else if (!isChecked() && !d->uncheckedText.isEmpty()) {
-        painter.setPen(d->getTextColor());
-        QFont font = painter.font();
-        font.setPixelSize(d->trackHeight * 0.5);
-        painter.setFont(font);
-        QRect textRect = d->getTextRect();
-        painter.drawText(textRect, Qt::AlignCenter, d->uncheckedText);
-    }
-    painter.restore();
-    
-    // Draw icons
-    painter.save(); // save and restore painter state around icon drawing
-    if (isChecked() && !d->checkedIcon.isNull()) {
-        QRect textRect = d->getTextRect();
-        QSize iconSize(textRect.height() * 0.6, textRect.height() * 0.6);
-        QRect iconRect(textRect.center() - QPoint(iconSize.width()/2, iconSize.height()/2), iconSize);
-        d->checkedIcon.paint(&painter, iconRect);
-    } else if (!isChecked() && !d->uncheckedIcon.isNull()) {
-        QRect textRect = d->getTextRect();
-        QSize iconSize(textRect.height() * 0.6, textRect.height() * 0.6);
-        QRect iconRect(textRect.center() - QPoint(iconSize.width()/2, iconSize.height()/2), iconSize);
-        d->uncheckedIcon.paint(&painter, iconRect);
-    }
-    painter.restore();
-    
-    // Prepare handle draw rect (pressed -> horizontal oval for dynamic effect)
-    QRect handleDrawRect = handleRect;
-    if (!d->isLoading && isEnabled() && d->isPressed) {
-        int extra = qMax(2, d->handleSize / 6); // how much to stretch
-        if (isChecked()) {
-            // stretch toward the left when checked (handle on the right)
-            handleDrawRect.adjust(-extra, 0, 0, 0);
-        } else {
-            // stretch toward the right when unchecked (handle on the left)
-            handleDrawRect.adjust(0, 0, +extra, 0);
-        }
-        // Keep inside the track's inner area
-        QRect innerTrack = trackRect.adjusted(d->handlePadding, (d->trackHeight - d->handleSize) / 2,
-                                              -d->handlePadding, -(d->trackHeight - d->handleSize) / 2);
-        handleDrawRect = handleDrawRect.intersected(innerTrack);
-    }
-    
-    // Draw handle
-    QColor handleColor = d->getHandleColor();
-    painter.setBrush(handleColor);
-    
-    // Add subtle shadow for handle
-    if (isEnabled()) {
-        QColor shadowColor = Qt::black;
-        shadowColor.setAlpha(30);
-        painter.setBrush(shadowColor);
-        painter.drawEllipse(handleDrawRect.adjusted(1, 1, 1, 1));
-    }
-    
-    painter.setBrush(handleColor);
-    painter.drawEllipse(handleDrawRect);
-    
-    // Draw loading spinner if loading
-    if (d->isLoading) {
-        d->drawLoadingSpinner(&painter, handleDrawRect, trackColor.darker(150));
-    }
-    
-    // Draw focus outline
-    if (d->hasFocus && !d->isLoading) {
-        QPen focusPen(d->getTrackColor(), 2);
-        focusPen.setStyle(Qt::DashLine);
-        painter.setPen(focusPen);
-        painter.setBrush(Qt::NoBrush);
-        QRect focusRect = trackRect.adjusted(-2, -2, 2, 2);
-        painter.drawRoundedRect(focusRect, focusRect.height() / 2, focusRect.height() / 2);
-    }
+
+    QtAntdSwitchOptions options;
+    d->initOptions(&options);
+    paintSwitch(&painter, d->getTrackRect(), switchMetrics(d->switchSize), options,
+                d->animationValue, d->colors(), d->textFont());
+}
+
+/*!
+ * Paints a switch with the given options centered in rect, exactly as a
+ * QtAntdSwitch would paint itself, without needing a widget.
+ */
+void QtAntdSwitch::paint(QPainter *painter, const QRect &rect, const QtAntdSwitchOptions &options)
+{
+    const SwitchMetrics metrics = switchMetrics(options.size);
+    const qreal position = options.position < 0 ? (options.checked ? 1.0 : 0.0) : options.position;
+    const QtAntdSwitchColors colors = resolveSwitchColors(options.useThemeColors, options.enabled,
+                                                          options.checked, options.hovered, options.pressed);
+    QFont trackFont = options.font;
+    trackFont.setPixelSize(int(metrics.trackHeight * 0.5));
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+    paintSwitch(painter, switchTrackRect(rect, metrics), metrics, options, position, colors, trackFont);
+    painter->restore();
+}
+
+QSize QtAntdSwitch::sizeHint(const QtAntdSwitchOptions &options)
+{
+    const SwitchMetrics metrics = switchMetrics(options.size);
+    return QSize(metrics.trackWidth + 4, metrics.trackHeight + 4);
 }
 
 void QtAntdSwitch::mousePressEvent(QMouseEvent *event)
@@ -543,7 +593,7 @@ void QtAntdSwitch::mousePressEvent(QMouseEvent *event)
     Q_D(QtAntdSwitch);
     if (event->button() == Qt::LeftButton && !d->isLoading) {
         d->isPressed = true;
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
     QAbstractButton::mousePressEvent(event);
 }
@@ -560,8 +610,8 @@ void QtAntdSwitch::mouseReleaseEvent(QMouseEvent *event)
             QRect inner = d->getTrackRect();
             int cornerRadius = inner.height() / 2;
             QColor rippleColor = d->useThemeColors
-                ? QtAntdStyle::instance().themeColor("primary-hover")
-                : d->getTrackColor();
+                ? QtAntdStyle::instance().themeColor(Antd::ColorPrimaryHover)
+                : d->colors().track;
             QtAntdInternal::StartOuterRippleOverlay(this,
                                                     inner,
                                                     cornerRadius,
@@ -569,7 +619,7 @@ void QtAntdSwitch::mouseReleaseEvent(QMouseEvent *event)
                                                     rippleColor,
                                                     QtAntdInternal::kAntdWaveExpandDistance);
         }
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
     QAbstractButton::mouseReleaseEvent(event);
 }
@@ -583,7 +633,7 @@ void QtAntdSwitch::enterEvent(QEvent *event)
     Q_D(QtAntdSwitch);
     if (!d->isLoading) {
         d->isHovered = true;
-        update();
+        QtAntdInternal::requestUpdate(this);
     }
     QAbstractButton::enterEvent(event);
 }
@@ -593,7 +643,7 @@ void QtAntdSwitch::leaveEvent(QEvent *event)
     Q_D(QtAntdSwitch);
     d->isHovered = false;
     d->isPressed = false;
-    update();
+    QtAntdInternal::requestUpdate(this);
     QAbstractButton::leaveEvent(event);
 }
 
@@ -601,7 +651,7 @@ void QtAntdSwitch::focusInEvent(QFocusEvent *event)
 {
     Q_D(QtAntdSwitch);
     d->hasFocus = true;
-    update();
+    QtAntdInternal::requestUpdate(this);
     QAbstractButton::focusInEvent(event);
 }
 
@@ -609,7 +659,7 @@ void QtAntdSwitch::focusOutEvent(QFocusEvent *event)
 {
     Q_D(QtAntdSwitch);
     d->hasFocus = false;
-    update();
+    QtAntdInternal::requestUpdate(this);
     QAbstractButton::focusOutEvent(event);
 }
 
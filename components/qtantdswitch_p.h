@@ -3,12 +3,22 @@
 
 #include <QtGlobal>
 #include <QColor>
-#include <QTimer>
-#include <QPropertyAnimation>
+#include <QEasingCurve>
 #include <QIcon>
 #include <QString>
+#include <QFont>
+#include "antdlib/qtantdcolorcache_p.h"
+#include "antdlib/qtantdanimationdriver_p.h"
 
 class QtAntdSwitch;
+struct QtAntdSwitchOptions;
+
+struct QtAntdSwitchColors
+{
+    QColor track;
+    QColor handle;
+    QColor text;
+};
 
 class QtAntdSwitchPrivate
 {
@@ -23,12 +33,11 @@ public:
     void updateGeometry();
 
     // Drawing helpers
-    QColor getTrackColor() const;
-    QColor getHandleColor() const;
-    QColor getTextColor() const;
+    const QtAntdSwitchColors &colors();
+    int colorState() const;
+    const QFont &textFont();
+    void initOptions(QtAntdSwitchOptions *options) const;
     QRect getTrackRect() const;
-    QRect getHandleRect() const;
-    QRect getTextRect() const;
     int getTrackWidth() const;
     int getTrackHeight() const;
     int getHandleSize() const;
@@ -36,10 +45,8 @@ public:
 
     // Animation
     void startToggleAnimation();
-    void updateAnimationValue();
     void startLoadingAnimation();
     void stopLoadingAnimation();
-    void drawLoadingSpinner(QPainter *painter, const QRect &rect, const QColor &color);
 
     QtAntdSwitch *const q_ptr;
 
@@ -56,11 +63,16 @@ public:
     QString uncheckedText;
     QIcon checkedIcon;
     QIcon uncheckedIcon;
+    QFont trackFontBase;
+    QFont trackFont;
 
     // Animation
-    QPropertyAnimation *toggleAnimation;
+    QtAntdInternal::Animation toggleAnimation;
+    QEasingCurve toggleEasing;
+    qreal toggleStartValue;
+    qreal toggleEndValue;
     qreal animationValue; // 0.0 = off, 1.0 = on
-    QTimer *loadingTimer;
+    QtAntdInternal::Animation loadingAnimation;
     int loadingAngle;
 
     // Cached dimensions based on size
@@ -68,6 +80,9 @@ public:
     int trackHeight;
     int handleSize;
     int handlePadding;
+
+    // Resolved colors per (enabled, checked, hovered, pressed) state
+    QtAntdInternal::ResolvedColorCache<QtAntdSwitchColors, 16> colorCache;
 };
 
 #endif // QTANTDSWITCH_P_H
\ No newline at end of file
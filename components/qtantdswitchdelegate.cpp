@@ -0,0 +1,297 @@
+#include "qtantdswitchdelegate.h"
+#include "qtantdswitchdelegate_p.h"
+#include <QAbstractItemModel>
+#include <QKeyEvent>
+#include <QPainter>
+#include <QStyle>
+
+// Space kept between the switch and the item border
+static const int gAntdItemMargin = 4;
+
+/*!
+ * \class QtAntdSwitchDelegatePrivate
+ * \internal
+ */
+
+/*!
+ * \internal
+ */
+QtAntdSwitchDelegatePrivate::QtAntdSwitchDelegatePrivate(QtAntdSwitchDelegate *q)
+    : q_ptr(q)
+    , checkedRole(Qt::CheckStateRole)
+    , switchSize(QtAntdSwitch::Medium)
+    , alignment(Qt::AlignCenter)
+    , useThemeColors(true)
+    , interaction([this](const QWidget *, const QRect &cellRect, const QModelIndex &) {
+        return switchRect(cellRect);
+    })
+{
+}
+
+/*!
+ * \internal
+ */
+QtAntdSwitchDelegatePrivate::~QtAntdSwitchDelegatePrivate()
+{
+}
+
+/*!
+ * \internal
+ * Area the switch is painted into, which is also the clickable area.
+ */
+QRect QtAntdSwitchDelegatePrivate::switchRect(const QRect &cellRect) const
+{
+    QtAntdSwitchOptions options;
+    options.size = switchSize;
+    const QRect area = cellRect.adjusted(gAntdItemMargin, 0, -gAntdItemMargin, 0);
+    return QStyle::alignedRect(Qt::LeftToRight, alignment, QtAntdSwitch::sizeHint(options), area);
+}
+
+/*!
+ * \internal
+ */
+bool QtAntdSwitchDelegatePrivate::isChecked(const QModelIndex &index) const
+{
+    const QVariant value = index.data(checkedRole);
+    if (checkedRole == Qt::CheckStateRole) {
+        return value.toInt() == Qt::Checked;
+    }
+    return value.toBool();
+}
+
+/*!
+ * \internal
+ */
+void QtAntdSwitchDelegatePrivate::initOptions(QtAntdSwitchOptions *options,
+                                              const QStyleOptionViewItem &option,
+                                              const QModelIndex &index) const
+{
+    options->size = switchSize;
+    options->checked = isChecked(index);
+    options->checkedText = checkedText;
+    options->uncheckedText = uncheckedText;
+    options->font = option.font;
+    options->useThemeColors = useThemeColors;
+    options->enabled = option.state.testFlag(QStyle::State_Enabled);
+    options->hovered = interaction.isHovered(option.widget, index);
+    options->pressed = interaction.isDown(option.widget, index);
+}
+
+/*!
+ * \internal
+ */
+bool QtAntdSwitchDelegatePrivate::toggle(QAbstractItemModel *model, const QModelIndex &index)
+{
+    Q_Q(QtAntdSwitchDelegate);
+
+    const Qt::ItemFlags flags = model->flags(index);
+    const Qt::ItemFlag required = checkedRole == Qt::CheckStateRole ? Qt::ItemIsUserCheckable : Qt::ItemIsEditable;
+    if (!(flags & Qt::ItemIsEnabled) || !(flags & required)) {
+        return false;
+    }
+
+    const bool checked = !isChecked(index);
+    const QVariant value = checkedRole == Qt::CheckStateRole
+        ? QVariant(int(checked ? Qt::Checked : Qt::Unchecked))
+        : QVariant(checked);
+    if (!model->setData(index, value, checkedRole)) {
+        return false;
+    }
+
+    emit q->toggled(index, checked);
+    return true;
+}
+
+/*!
+ * \class QtAntdSwitchDelegate
+ */
+
+QtAntdSwitchDelegate::QtAntdSwitchDelegate(QObject *parent)
+    : QStyledItemDelegate(parent)
+    , d_ptr(new QtAntdSwitchDelegatePrivate(this))
+{
+}
+
+QtAntdSwitchDelegate::~QtAntdSwitchDelegate()
+{
+}
+
+void QtAntdSwitchDelegate::setCheckedRole(int role)
+{
+    Q_D(QtAntdSwitchDelegate);
+
+    if (d->checkedRole != role) {
+        d->checkedRole = role;
+        d->interaction.updateViews();
+    }
+}
+
+int QtAntdSwitchDelegate::checkedRole() const
+{
+    Q_D(const QtAntdSwitchDelegate);
+
+    return d->checkedRole;
+}
+
+void QtAntdSwitchDelegate::setSwitchSize(QtAntdSwitch::SwitchSize size)
+{
+    Q_D(QtAntdSwitchDelegate);
+
+    if (d->switchSize != size) {
+        d->switchSize = size;
+        emit sizeHintChanged(QModelIndex());
+    }
+}
+
+QtAntdSwitch::SwitchSize QtAntdSwitchDelegate::switchSize() const
+{
+    Q_D(const QtAntdSwitchDelegate);
+
+    return d->switchSize;
+}
+
+void QtAntdSwitchDelegate::setCheckedText(const QString &text)
+{
+    Q_D(QtAntdSwitchDelegate);
+
+    if (d->checkedText != text) {
+        d->checkedText = text;
+        d->interaction.updateViews();
+    }
+}
+
+QString QtAntdSwitchDelegate::checkedText() const
+{
+    Q_D(const QtAntdSwitchDelegate);
+
+    return d->checkedText;
+}
+
+void QtAntdSwitchDelegate::setUncheckedText(const QString &text)
+{
+    Q_D(QtAntdSwitchDelegate);
+
+    if (d->uncheckedText != text) {
+        d->uncheckedText = text;
+        d->interaction.updateViews();
+    }
+}
+
+QString QtAntdSwitchDelegate::uncheckedText() const
+{
+    Q_D(const QtAntdSwitchDelegate);
+
+    return d->uncheckedText;
+}
+
+void QtAntdSwitchDelegate::setAlignment(Qt::Alignment alignment)
+{
+    Q_D(QtAntdSwitchDelegate);
+
+    if (d->alignment != alignment) {
+        d->alignment = alignment;
+        d->interaction.updateViews();
+    }
+}
+
+Qt::Alignment QtAntdSwitchDelegate::alignment() const
+{
+    Q_D(const QtAntdSwitchDelegate);
+
+    return d->alignment;
+}
+
+void QtAntdSwitchDelegate::setUseThemeColors(bool value)
+{
+    Q_D(QtAntdSwitchDelegate);
+
+    if (d->useThemeColors != value) {
+        d->useThemeColors = value;
+        d->interaction.updateViews();
+    }
+}
+
+bool QtAntdSwitchDelegate::useThemeColors() const
+{
+    Q_D(const QtAntdSwitchDelegate);
+
+    return d->useThemeColors;
+}
+
+/*!
+ * \reimp
+ */
+void QtAntdSwitchDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option,
+                                 const QModelIndex &index) const
+{
+    Q_D(const QtAntdSwitchDelegate);
+
+    d->interaction.watch(option.widget);
+
+    QStyleOptionViewItem itemOption = option;
+    initStyleOption(&itemOption, index);
+    QtAntdInternal::drawItemPanel(painter, itemOption);
+
+    QtAntdSwitchOptions options;
+    d->initOptions(&options, itemOption, index);
+    QtAntdSwitch::paint(painter, d->switchRect(option.rect), options);
+}
+
+/*!
+ * \reimp
+ */
+QSize QtAntdSwitchDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    Q_UNUSED(option);
+    Q_UNUSED(index);
+    Q_D(const QtAntdSwitchDelegate);
+
+    QtAntdSwitchOptions options;
+    options.size = d->switchSize;
+    return QtAntdSwitch::sizeHint(options) + QSize(2 * gAntdItemMargin, 2 * gAntdItemMargin);
+}
+
+/*!
+ * \reimp
+ */
+QWidget *QtAntdSwitchDelegate::createEditor(QWidget *parent, const QStyleOptionViewItem &option,
+                                            const QModelIndex &index) const
+{
+    Q_UNUSED(parent);
+    Q_UNUSED(option);
+    Q_UNUSED(index);
+
+    return nullptr;
+}
+
+/*!
+ * \reimp
+ */
+bool QtAntdSwitchDelegate::editorEvent(QEvent *event, QAbstractItemModel *model,
+                                       const QStyleOptionViewItem &option, const QModelIndex &index)
+{
+    Q_D(QtAntdSwitchDelegate);
+
+    if (!(option.state & QStyle::State_Enabled)) {
+        return false;
+    }
+
+    if (event->type() == QEvent::KeyPress) {
+        const int key = static_cast<QKeyEvent *>(event)->key();
+        if (key != Qt::Key_Space && key != Qt::Key_Select) {
+            return false;
+        }
+        return d->toggle(model, index);
+    }
+
+    switch (d->interaction.mouseEvent(event, option, index)) {
+    case QtAntdInternal::DelegateInteraction::Clicked:
+        d->toggle(model, index);
+        return true;
+    case QtAntdInternal::DelegateInteraction::Consumed:
+        return true;
+    case QtAntdInternal::DelegateInteraction::Ignored:
+    default:
+        return false;
+    }
+}
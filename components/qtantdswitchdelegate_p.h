@@ -0,0 +1,40 @@
+#ifndef QTANTDSWITCHDELEGATE_P_H
+#define QTANTDSWITCHDELEGATE_P_H
+
+#include <QtGlobal>
+#include <QString>
+#include "antdlib/qtantddelegateinteraction_p.h"
+
+class QAbstractItemModel;
+class QtAntdSwitchDelegate;
+struct QtAntdSwitchOptions;
+
+class QtAntdSwitchDelegatePrivate
+{
+    Q_DISABLE_COPY(QtAntdSwitchDelegatePrivate)
+    Q_DECLARE_PUBLIC(QtAntdSwitchDelegate)
+
+public:
+    QtAntdSwitchDelegatePrivate(QtAntdSwitchDelegate *q);
+    ~QtAntdSwitchDelegatePrivate();
+
+    QRect switchRect(const QRect &cellRect) const;
+    bool isChecked(const QModelIndex &index) const;
+    void initOptions(QtAntdSwitchOptions *options, const QStyleOptionViewItem &option,
+                     const QModelIndex &index) const;
+    bool toggle(QAbstractItemModel *model, const QModelIndex &index);
+
+    QtAntdSwitchDelegate *const q_ptr;
+
+    int checkedRole;
+    QtAntdSwitch::SwitchSize switchSize;
+    QString checkedText;
+    QString uncheckedText;
+    Qt::Alignment alignment;
+    bool useThemeColors;
+
+    // Views are watched from the const paint()
+    mutable QtAntdInternal::DelegateInteraction interaction;
+};
+
+#endif // QTANTDSWITCHDELEGATE_P_H
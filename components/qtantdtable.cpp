@@ -0,0 +1,907 @@
+#include "qtantdtable.h"
+#include "qtantdtable_p.h"
+#include "qtantdtableproxymodel.h"
+#include "antdlib/qtantdalphamask_p.h"
+#include "antdlib/qtantdinstrumentation_p.h"
+#include "antdlib/qtantdrendercache_p.h"
+#include "antdlib/qtantdtextcache_p.h"
+#include "antdlib/qtantdthemeregistry_p.h"
+#include "../include/qtantd/lib/qtantdstyle.h"
+#include <QCursor>
+#include <QIcon>
+#include <QItemSelectionModel>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPolygonF>
+
+namespace {
+
+// Sort carets are stacked at the right of a sortable header section
+const int gCaretWidth = 8;
+const int gCaretHeight = 5;
+const int gCaretSpacing = 4;
+const int gIconSpacing = 8;
+const int gCaretCacheKb = 64;
+
+int rowHeightFor(QtAntdTable::TableSize size)
+{
+    switch (size) {
+    case QtAntdTable::Middle:
+        return 47;
+    case QtAntdTable::Small:
+        return 39;
+    case QtAntdTable::Large:
+    default:
+        return 55;
+    }
+}
+
+int paddingFor(QtAntdTable::TableSize size)
+{
+    switch (size) {
+    case QtAntdTable::Middle:
+        return 12;
+    case QtAntdTable::Small:
+        return 8;
+    case QtAntdTable::Large:
+    default:
+        return 16;
+    }
+}
+
+// Coverage of one caret, shared by every table and both colors
+const QImage &caretMask(bool up, qreal dpr)
+{
+    thread_local QtAntdInternal::RenderCache<QImage> cache(gCaretCacheKb);
+
+    QtAntdInternal::RenderCacheKey key;
+    key.add(up).add(dpr);
+
+    if (const QImage *cached = cache.find(key)) {
+        return *cached;
+    }
+
+    QImage mask = QtAntdInternal::createAlphaMask(QSize(gCaretWidth, gCaretHeight), dpr);
+
+    QPainter painter(&mask);
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(Qt::black);
+
+    QPolygonF caret;
+    if (up) {
+        caret << QPointF(gCaretWidth / 2.0, 0) << QPointF(gCaretWidth, gCaretHeight) << QPointF(0, gCaretHeight);
+    } else {
+        caret << QPointF(0, 0) << QPointF(gCaretWidth, 0) << QPointF(gCaretWidth / 2.0, gCaretHeight);
+    }
+    painter.drawPolygon(caret);
+    painter.end();
+
+    return *cache.insert(key, mask, mask.sizeInBytes());
+}
+
+QIcon decorationIcon(const QVariant &value)
+{
+    switch (value.userType()) {
+    case QMetaType::QIcon:
+        return qvariant_cast<QIcon>(value);
+    case QMetaType::QPixmap:
+        return QIcon(qvariant_cast<QPixmap>(value));
+    case QMetaType::QImage:
+        return QIcon(QPixmap::fromImage(qvariant_cast<QImage>(value)));
+    default:
+        return QIcon();
+    }
+}
+
+} // namespace
+
+/*!
+ * \class QtAntdTableHeader
+ * \internal
+ */
+
+QtAntdTableHeader::QtAntdTableHeader(QtAntdTablePrivate *table, QWidget *parent)
+    : QHeaderView(Qt::Horizontal, parent)
+    , m_table(table)
+{
+    setSectionsClickable(true);
+    setHighlightSections(false);
+    setSortIndicatorShown(false);
+    setStretchLastSection(true);
+    setDefaultAlignment(Qt::AlignLeft | Qt::AlignVCenter);
+}
+
+QSize QtAntdTableHeader::sizeHint() const
+{
+    return QSize(QHeaderView::sizeHint().width(), m_table->rowHeight());
+}
+
+void QtAntdTableHeader::paintSection(QPainter *painter, const QRect &rect, int logicalIndex) const
+{
+    if (!rect.isValid() || !model()) {
+        return;
+    }
+
+    const QtAntdTableColors &colors = m_table->colors();
+    const int padding = m_table->padding();
+
+    painter->fillRect(rect, colors.header);
+    painter->fillRect(QRect(rect.left(), rect.bottom(), rect.width(), 1), colors.border);
+    if (visualIndex(logicalIndex) < count() - 1) {
+        // Short separator between sections
+        painter->fillRect(QRect(rect.right(), rect.top() + rect.height() / 4, 1, rect.height() / 2), colors.border);
+    }
+
+    QRect textRect = rect.adjusted(padding, 0, -padding, -1);
+    if (m_table->sortableColumns.contains(logicalIndex)) {
+        const QtAntdTableProxyModel *proxy = m_table->proxy;
+        const bool sorted = proxy->sortColumn() == logicalIndex;
+        const bool ascending = sorted && proxy->sortOrder() == Qt::AscendingOrder;
+        const bool descending = sorted && proxy->sortOrder() == Qt::DescendingOrder;
+
+        const qreal dpr = painter->device()->devicePixelRatioF();
+        const int left = textRect.right() + 1 - gCaretWidth;
+        const int centerY = textRect.center().y();
+        const QImage &up = caretMask(true, dpr);
+        const QImage &down = caretMask(false, dpr);
+        QtAntdInternal::drawAlphaMask(painter, QRectF(left, centerY - gCaretHeight, gCaretWidth, gCaretHeight),
+                                      up, up.rect(), ascending ? colors.sortActive : colors.sortInactive);
+        QtAntdInternal::drawAlphaMask(painter, QRectF(left, centerY + 1, gCaretWidth, gCaretHeight),
+                                      down, down.rect(), descending ? colors.sortActive : colors.sortInactive);
+
+        textRect.setRight(left - gCaretSpacing);
+    }
+
+    const QString text = model()->headerData(logicalIndex, Qt::Horizontal, Qt::DisplayRole).toString();
+    if (text.isEmpty() || textRect.width() <= 0) {
+        return;
+    }
+
+    const QVariant alignmentValue = model()->headerData(logicalIndex, Qt::Horizontal, Qt::TextAlignmentRole);
+    const int alignment = alignmentValue.isValid() ? alignmentValue.toInt() : int(defaultAlignment());
+
+    QFont font = this->font();
+    font.setWeight(QFont::DemiBold);
+    painter->setFont(font);
+    painter->setPen(colors.headerText);
+
+    const QString elided = QFontMetrics(font).elidedText(text, Qt::ElideRight, textRect.width());
+    QtAntdInternal::drawCachedText(painter, textRect, alignment, elided);
+}
+
+QSize QtAntdTableHeader::sectionSizeFromContents(int logicalIndex) const
+{
+    QFont font = this->font();
+    font.setWeight(QFont::DemiBold);
+
+    const QString text = model() ? model()->headerData(logicalIndex, Qt::Horizontal, Qt::DisplayRole).toString()
+                                 : QString();
+    int width = QFontMetrics(font).horizontalAdvance(text) + 2 * m_table->padding();
+    if (m_table->sortableColumns.contains(logicalIndex)) {
+        width += gCaretWidth + gCaretSpacing;
+    }
+    return QSize(width, m_table->rowHeight());
+}
+
+/*!
+ * \class QtAntdTableDelegate
+ * \internal
+ */
+
+QtAntdTableDelegate::QtAntdTableDelegate(QtAntdTablePrivate *table, QObject *parent)
+    : QStyledItemDelegate(parent)
+    , m_table(table)
+{
+}
+
+void QtAntdTableDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option,
+                                const QModelIndex &index) const
+{
+    const QtAntdTableColors &colors = m_table->colors();
+    const int padding = m_table->padding();
+    QRect rect = option.rect.adjusted(padding, 0, -padding, -1);
+
+    const QIcon icon = decorationIcon(index.data(Qt::DecorationRole));
+    if (!icon.isNull()) {
+        const int extent = option.decorationSize.height();
+        const QRect iconRect(rect.left(), rect.top() + (rect.height() - extent) / 2, extent, extent);
+        icon.paint(painter, iconRect, Qt::AlignCenter,
+                   option.state.testFlag(QStyle::State_Enabled) ? QIcon::Normal : QIcon::Disabled);
+        rect.setLeft(iconRect.right() + 1 + gIconSpacing);
+    }
+
+    const QString text = displayText(index.data(Qt::DisplayRole), option.locale);
+    if (text.isEmpty() || rect.width() <= 0) {
+        return;
+    }
+
+    QFont font = option.font;
+    const QVariant fontValue = index.data(Qt::FontRole);
+    if (fontValue.isValid()) {
+        font = qvariant_cast<QFont>(fontValue).resolve(option.font);
+    }
+
+    QColor color = option.state.testFlag(QStyle::State_Selected) ? colors.selectedText : colors.text;
+    const QVariant foreground = index.data(Qt::ForegroundRole);
+    if (foreground.isValid()) {
+        color = qvariant_cast<QBrush>(foreground).color();
+    }
+    if (!option.state.testFlag(QStyle::State_Enabled)) {
+        color.setAlphaF(color.alphaF() * 0.5);
+    }
+
+    const QVariant alignmentValue = index.data(Qt::TextAlignmentRole);
+    const int alignment = alignmentValue.isValid() ? alignmentValue.toInt() : int(Qt::AlignLeft | Qt::AlignVCenter);
+
+    painter->save();
+    painter->setFont(font);
+    painter->setPen(color);
+
+    const QTableView *view = qobject_cast<const QTableView *>(option.widget);
+    if (view && view->wordWrap()) {
+        painter->drawText(rect.adjusted(0, padding, 0, -padding), alignment | Qt::TextWordWrap, text);
+    } else {
+        const QString elided = QFontMetrics(font).elidedText(text, Qt::ElideRight, rect.width());
+        QtAntdInternal::drawCachedText(painter, rect, alignment, elided);
+    }
+
+    painter->restore();
+}
+
+QSize QtAntdTableDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    const int padding = m_table->padding();
+
+    QFont font = option.font;
+    const QVariant fontValue = index.data(Qt::FontRole);
+    if (fontValue.isValid()) {
+        font = qvariant_cast<QFont>(fontValue).resolve(option.font);
+    }
+    const QFontMetrics fm(font);
+
+    const QString text = displayText(index.data(Qt::DisplayRole), option.locale);
+    int iconWidth = 0;
+    if (!decorationIcon(index.data(Qt::DecorationRole)).isNull()) {
+        iconWidth = option.decorationSize.width() + gIconSpacing;
+    }
+
+    const int width = fm.horizontalAdvance(text) + iconWidth + 2 * padding;
+    int height = m_table->rowHeight();
+
+    const QTableView *view = qobject_cast<const QTableView *>(option.widget);
+    if (view && view->wordWrap() && option.rect.width() > 0) {
+        const int textWidth = qMax(1, option.rect.width() - iconWidth - 2 * padding);
+        const QRect bounds = fm.boundingRect(QRect(0, 0, textWidth, 0), Qt::TextWordWrap, text);
+        height = qMax(height, bounds.height() + 2 * padding + 1);
+    }
+    return QSize(width, height);
+}
+
+/*!
+ * \class QtAntdTablePrivate
+ * \internal
+ */
+
+/*!
+ * \internal
+ */
+QtAntdTablePrivate::QtAntdTablePrivate(QtAntdTable *q)
+    : q_ptr(q)
+    , proxy(nullptr)
+    , header(nullptr)
+    , delegate(nullptr)
+    , tableSize(QtAntdTable::Large)
+    , uniformRowHeights(true)
+    , striped(false)
+    , useThemeColors(true)
+    , hoverRow(-1)
+    , measuring(false)
+{
+}
+
+/*!
+ * \internal
+ */
+QtAntdTablePrivate::~QtAntdTablePrivate()
+{
+}
+
+/*!
+ * \internal
+ */
+void QtAntdTablePrivate::init()
+{
+    Q_Q(QtAntdTable);
+
+    proxy = new QtAntdTableProxyModel(q);
+    header = new QtAntdTableHeader(this, q);
+    delegate = new QtAntdTableDelegate(this, q);
+
+    q->setHorizontalHeader(header);
+    q->setItemDelegate(delegate);
+    q->QTableView::setModel(proxy);
+
+    q->setShowGrid(false);
+    q->setWordWrap(false);
+    q->setSelectionBehavior(QAbstractItemView::SelectRows);
+    q->setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+    q->setHorizontalScrollMode(QAbstractItemView::ScrollPerPixel);
+    q->setFrameShape(QFrame::NoFrame);
+
+    // Rows are painted in full by paintRows(), not by the palette
+    q->viewport()->setAutoFillBackground(false);
+    q->viewport()->setMouseTracking(true);
+
+    QHeaderView *vertical = q->verticalHeader();
+    vertical->hide();
+    vertical->setSectionResizeMode(QHeaderView::Fixed);
+    vertical->setMinimumSectionSize(1);
+    vertical->setDefaultSectionSize(rowHeight());
+
+    QObject::connect(header, &QHeaderView::sectionClicked, q, [this](int section) { cycleSort(section); });
+    QObject::connect(header, &QHeaderView::sectionResized, q, [this, q]() {
+        if (q->wordWrap()) {
+            resetRowHeights();
+        }
+    });
+
+    // Rows may be laid out differently after any change of the shown rows
+    QObject::connect(proxy, &QAbstractItemModel::rowsInserted, q,
+                     [this](const QModelIndex &, int first, int last) {
+                         if (first <= measured.size()) {
+                             measured.insert(first, last - first + 1, false);
+                         }
+                         hoverRow = -1;
+                         scheduleMeasure();
+                     });
+    QObject::connect(proxy, &QAbstractItemModel::rowsRemoved, q,
+                     [this](const QModelIndex &, int first, int last) {
+                         if (first < measured.size()) {
+                             measured.remove(first, qMin(last + 1, measured.size()) - first);
+                         }
+                         hoverRow = -1;
+                         scheduleMeasure();
+                     });
+    QObject::connect(proxy, &QAbstractItemModel::layoutAboutToBeChanged, q, [this]() {
+        resetRowHeights();
+        hoverRow = -1;
+    });
+    QObject::connect(proxy, &QAbstractItemModel::layoutChanged, q, [this]() { scheduleMeasure(); });
+    QObject::connect(proxy, &QAbstractItemModel::modelReset, q, [this]() {
+        measured.clear();
+        hoverRow = -1;
+        scheduleMeasure();
+    });
+
+    measureTimer.setSingleShot(true);
+    measureTimer.setInterval(0);
+    QObject::connect(&measureTimer, &QTimer::timeout, q, [this]() { measureVisibleRows(); });
+
+    registerViewport(q->viewport());
+    registerViewport(header->viewport());
+}
+
+/*!
+ * \internal
+ * Repaints viewport on theme changes until it is destroyed, also when it is
+ * replaced through setViewport() or setHorizontalHeader().
+ */
+void QtAntdTablePrivate::registerViewport(QWidget *viewport)
+{
+    QtAntdInternal::ThemeRegistry &registry = QtAntdInternal::ThemeRegistry::instance();
+    registry.registerWidget(viewport);
+    QObject::connect(viewport, &QObject::destroyed, &registry, [viewport]() {
+        QtAntdInternal::ThemeRegistry::instance().unregisterWidget(viewport);
+    });
+}
+
+void QtAntdTablePrivate::updateHeader()
+{
+    if (header) {
+        QtAntdInternal::requestUpdate(header->viewport());
+    }
+}
+
+/*!
+ * \internal
+ */
+const QtAntdTableColors &QtAntdTablePrivate::colors()
+{
+    Q_Q(QtAntdTable);
+
+    return colorCache.get(0, [this, q]() {
+        QtAntdTableColors resolved;
+        if (useThemeColors) {
+            QtAntdStyle &style = QtAntdStyle::instance();
+            resolved.background = style.themeColor(Antd::ColorBackground);
+            resolved.stripe = style.themeColor(Antd::ColorBackgroundSecondary);
+            resolved.hover = style.themeColor(Antd::ColorSurfaceVariant);
+            resolved.selected = style.themeColor(Antd::ColorPrimaryBackground);
+            resolved.border = style.themeColor(Antd::ColorBorderSecondary);
+            resolved.header = style.themeColor(Antd::ColorBackgroundSecondary);
+            resolved.headerText = style.themeColor(Antd::ColorText);
+            resolved.text = style.themeColor(Antd::ColorText);
+            resolved.selectedText = style.themeColor(Antd::ColorText);
+            resolved.sortInactive = style.themeColor(Antd::ColorTextQuaternary);
+            resolved.sortActive = style.themeColor(Antd::ColorPrimary);
+        } else {
+            const QPalette palette = q->palette();
+            resolved.background = palette.color(QPalette::Base);
+            resolved.stripe = palette.color(QPalette::AlternateBase);
+            resolved.hover = palette.color(QPalette::Midlight);
+            resolved.selected = palette.color(QPalette::Highlight);
+            resolved.border = palette.color(QPalette::Mid);
+            resolved.header = palette.color(QPalette::Button);
+            resolved.headerText = palette.color(QPalette::ButtonText);
+            resolved.text = palette.color(QPalette::Text);
+            resolved.selectedText = palette.color(QPalette::HighlightedText);
+            resolved.sortInactive = palette.color(QPalette::Mid);
+            resolved.sortActive = palette.color(QPalette::Highlight);
+        }
+        return resolved;
+    });
+}
+
+int QtAntdTablePrivate::rowHeight() const
+{
+    return rowHeightFor(tableSize);
+}
+
+int QtAntdTablePrivate::padding() const
+{
+    return paddingFor(tableSize);
+}
+
+/*!
+ * \internal
+ * Background, hover and selection of the rows crossing rect, one fill per row
+ * instead of one per cell.
+ */
+void QtAntdTablePrivate::paintRows(QPainter *painter, const QRect &rect)
+{
+    Q_Q(QtAntdTable);
+
+    const QtAntdTableColors &colors = this->colors();
+    painter->fillRect(rect, colors.background);
+
+    const int count = proxy->rowCount();
+    if (count == 0) {
+        return;
+    }
+
+    int first = q->rowAt(rect.top());
+    int last = q->rowAt(rect.bottom());
+    if (first < 0) {
+        first = 0;
+    }
+    if (last < 0) {
+        last = count - 1;
+    }
+
+    const QItemSelectionModel *selection = q->selectionModel();
+    const int width = qMin(rect.right() + 1, q->horizontalHeader()->length() - q->horizontalOffset());
+    if (width <= rect.left()) {
+        return;
+    }
+    for (int row = first; row <= last; ++row) {
+        const int height = q->rowHeight(row);
+        if (height <= 0) {
+            continue;
+        }
+
+        const int top = q->rowViewportPosition(row);
+        if (top > rect.bottom()) {
+            break;
+        }
+
+        const QRect rowRect(rect.left(), top, width - rect.left(), height);
+        if (selection && selection->isRowSelected(row, q->rootIndex())) {
+            painter->fillRect(rowRect, colors.selected);
+        } else if (row == hoverRow) {
+            painter->fillRect(rowRect, colors.hover);
+        } else if (striped && (row & 1)) {
+            painter->fillRect(rowRect, colors.stripe);
+        }
+        painter->fillRect(QRect(rowRect.left(), rowRect.bottom(), rowRect.width(), 1), colors.border);
+    }
+}
+
+void QtAntdTablePrivate::setHoverRow(int row)
+{
+    if (hoverRow == row) {
+        return;
+    }
+
+    const int previous = hoverRow;
+    hoverRow = row;
+    updateRow(previous);
+    updateRow(row);
+}
+
+/*!
+ * \internal
+ * Scrolling moves rows under a still cursor.
+ */
+void QtAntdTablePrivate::updateHoverFromCursor()
+{
+    Q_Q(QtAntdTable);
+
+    QWidget *viewport = q->viewport();
+    if (!viewport->underMouse()) {
+        setHoverRow(-1);
+        return;
+    }
+    setHoverRow(q->rowAt(viewport->mapFromGlobal(QCursor::pos()).y()));
+}
+
+void QtAntdTablePrivate::updateRow(int row)
+{
+    Q_Q(QtAntdTable);
+
+    if (row < 0 || row >= proxy->rowCount()) {
+        return;
+    }
+
+    QWidget *viewport = q->viewport();
+    QtAntdInternal::requestUpdate(viewport, QRect(0, q->rowViewportPosition(row), viewport->width(), q->rowHeight(row)));
+}
+
+/*!
+ * \internal
+ * Header clicks go from unsorted to ascending, descending and back.
+ */
+void QtAntdTablePrivate::cycleSort(int column)
+{
+    if (!sortableColumns.contains(column)) {
+        return;
+    }
+
+    if (proxy->sortColumn() != column) {
+        proxy->sort(column, Qt::AscendingOrder);
+    } else if (proxy->sortOrder() == Qt::AscendingOrder) {
+        proxy->sort(column, Qt::DescendingOrder);
+    } else {
+        proxy->sort(-1);
+    }
+    updateHeader();
+}
+
+void QtAntdTablePrivate::scheduleMeasure()
+{
+    if (!uniformRowHeights) {
+        measureTimer.start();
+    }
+}
+
+/*!
+ * \internal
+ * Sizes the rows in the viewport that were never measured. Growing a row pushes
+ * the next ones down, so rows are measured until the viewport is filled. Their
+ * positions are summed here rather than asked from the header: after a resize,
+ * QHeaderView walks every section to answer a position, so all resizes are
+ * applied together at the end.
+ */
+void QtAntdTablePrivate::measureVisibleRows()
+{
+    Q_Q(QtAntdTable);
+
+    if (uniformRowHeights || measuring) {
+        return;
+    }
+
+    const int count = proxy->rowCount();
+    int row = q->rowAt(0);
+    if (row < 0) {
+        return;
+    }
+    if (measured.size() < count) {
+        measured.resize(count);
+    }
+
+    QHeaderView *vertical = q->verticalHeader();
+    const int bottom = q->viewport()->height();
+    QVector<QPair<int, int>> heights;
+    for (int y = q->rowViewportPosition(row); row < count && y < bottom; ++row) {
+        if (vertical->isSectionHidden(row)) {
+            continue;
+        }
+        int height = vertical->sectionSize(row);
+        if (!measured.at(row)) {
+            measured[row] = true;
+            const int natural = qMax(rowHeight(), q->sizeHintForRow(row));
+            if (natural != height) {
+                heights.append(qMakePair(row, natural));
+                height = natural;
+            }
+        }
+        y += height;
+    }
+
+    measuring = true;
+    resizeRows(heights);
+    measuring = false;
+}
+
+/*!
+ * \internal
+ * Returns measured rows to the default height, to be measured again.
+ */
+void QtAntdTablePrivate::resetRowHeights()
+{
+    Q_Q(QtAntdTable);
+
+    QHeaderView *vertical = q->verticalHeader();
+    const int count = qMin(measured.size(), vertical->count());
+    const int height = rowHeight();
+    QVector<QPair<int, int>> heights;
+    for (int row = 0; row < count; ++row) {
+        if (measured.at(row) && vertical->sectionSize(row) != height) {
+            heights.append(qMakePair(row, height));
+        }
+    }
+    resizeRows(heights);
+    measured.clear();
+    scheduleMeasure();
+}
+
+/*!
+ * \internal
+ * Resizes rows given as (row, height) with the vertical header's updates off.
+ * QHeaderView::resizeSection() then skips looking up the section position to
+ * repaint, which walks every section after the first resize; the view still
+ * relayouts from sectionResized(), once for the batch.
+ */
+void QtAntdTablePrivate::resizeRows(const QVector<QPair<int, int>> &heights)
+{
+    Q_Q(QtAntdTable);
+
+    if (heights.isEmpty()) {
+        return;
+    }
+
+    QHeaderView *vertical = q->verticalHeader();
+    const bool updatesEnabled = vertical->updatesEnabled();
+    vertical->setUpdatesEnabled(false);
+    for (const QPair<int, int> &entry : heights) {
+        vertical->resizeSection(entry.first, entry.second);
+    }
+    vertical->setUpdatesEnabled(updatesEnabled);
+}
+
+/*!
+ * \class QtAntdTable
+ */
+
+QtAntdTable::QtAntdTable(QWidget *parent)
+    : QTableView(parent)
+    , d_ptr(new QtAntdTablePrivate(this))
+{
+    d_func()->init();
+}
+
+QtAntdTable::~QtAntdTable()
+{
+}
+
+void QtAntdTable::setModel(QAbstractItemModel *model)
+{
+    Q_D(QtAntdTable);
+
+    d->proxy->setSourceModel(model);
+}
+
+QAbstractItemModel *QtAntdTable::sourceModel() const
+{
+    Q_D(const QtAntdTable);
+
+    return d->proxy->sourceModel();
+}
+
+QtAntdTableProxyModel *QtAntdTable::proxyModel() const
+{
+    Q_D(const QtAntdTable);
+
+    return d->proxy;
+}
+
+void QtAntdTable::setTableSize(TableSize size)
+{
+    Q_D(QtAntdTable);
+
+    if (d->tableSize == size) {
+        return;
+    }
+
+    d->resetRowHeights();
+    d->tableSize = size;
+    verticalHeader()->setDefaultSectionSize(d->rowHeight());
+    updateGeometries();
+    d->scheduleMeasure();
+    QtAntdInternal::requestUpdate(viewport());
+    d->updateHeader();
+}
+
+QtAntdTable::TableSize QtAntdTable::tableSize() const
+{
+    Q_D(const QtAntdTable);
+
+    return d->tableSize;
+}
+
+void QtAntdTable::setUniformRowHeights(bool value)
+{
+    Q_D(QtAntdTable);
+
+    if (d->uniformRowHeights == value) {
+        return;
+    }
+
+    d->resetRowHeights();
+    d->uniformRowHeights = value;
+    d->scheduleMeasure();
+}
+
+bool QtAntdTable::uniformRowHeights() const
+{
+    Q_D(const QtAntdTable);
+
+    return d->uniformRowHeights;
+}
+
+void QtAntdTable::setStriped(bool value)
+{
+    Q_D(QtAntdTable);
+
+    if (d->striped == value) {
+        return;
+    }
+
+    d->striped = value;
+    QtAntdInternal::requestUpdate(viewport());
+}
+
+bool QtAntdTable::isStriped() const
+{
+    Q_D(const QtAntdTable);
+
+    return d->striped;
+}
+
+void QtAntdTable::setUseThemeColors(bool value)
+{
+    Q_D(QtAntdTable);
+
+    if (d->useThemeColors == value) {
+        return;
+    }
+
+    d->useThemeColors = value;
+    d->colorCache.invalidate();
+    QtAntdInternal::requestUpdate(viewport());
+    d->updateHeader();
+}
+
+bool QtAntdTable::useThemeColors() const
+{
+    Q_D(const QtAntdTable);
+
+    return d->useThemeColors;
+}
+
+void QtAntdTable::setColumnSortable(int column, bool sortable)
+{
+    Q_D(QtAntdTable);
+
+    if (d->sortableColumns.contains(column) == sortable) {
+        return;
+    }
+
+    if (sortable) {
+        d->sortableColumns.insert(column);
+    } else {
+        d->sortableColumns.remove(column);
+        if (d->proxy->sortColumn() == column) {
+            d->proxy->sort(-1);
+        }
+    }
+    d->updateHeader();
+}
+
+bool QtAntdTable::isColumnSortable(int column) const
+{
+    Q_D(const QtAntdTable);
+
+    return d->sortableColumns.contains(column);
+}
+
+void QtAntdTable::setColumnFilter(int column, const QString &text)
+{
+    Q_D(QtAntdTable);
+
+    d->proxy->setColumnFilter(column, text);
+}
+
+QString QtAntdTable::columnFilter(int column) const
+{
+    Q_D(const QtAntdTable);
+
+    return d->proxy->columnFilter(column);
+}
+
+bool QtAntdTable::viewportEvent(QEvent *event)
+{
+    Q_D(QtAntdTable);
+
+    switch (event->type()) {
+    case QEvent::MouseMove:
+        d->setHoverRow(rowAt(static_cast<QMouseEvent *>(event)->pos().y()));
+        break;
+    case QEvent::Leave:
+        d->setHoverRow(-1);
+        break;
+    default:
+        break;
+    }
+    return QTableView::viewportEvent(event);
+}
+
+void QtAntdTable::paintEvent(QPaintEvent *event)
+{
+    Q_D(QtAntdTable);
+    QTANTD_PAINT_SCOPE(this);
+
+    {
+        QPainter painter(viewport());
+        d->paintRows(&painter, event->rect());
+    }
+    QTableView::paintEvent(event);
+}
+
+void QtAntdTable::resizeEvent(QResizeEvent *event)
+{
+    Q_D(QtAntdTable);
+
+    QTableView::resizeEvent(event);
+    d->scheduleMeasure();
+}
+
+void QtAntdTable::changeEvent(QEvent *event)
+{
+    Q_D(QtAntdTable);
+
+    switch (event->type()) {
+    case QEvent::PaletteChange:
+        d->colorCache.invalidate();
+        break;
+    case QEvent::FontChange:
+        d->resetRowHeights();
+        break;
+    default:
+        break;
+    }
+    QTableView::changeEvent(event);
+}
+
+void QtAntdTable::scrollContentsBy(int dx, int dy)
+{
+    Q_D(QtAntdTable);
+
+    QTableView::scrollContentsBy(dx, dy);
+    if (dy != 0) {
+        // Measured before the newly exposed rows are painted
+        d->measureVisibleRows();
+        d->updateHoverFromCursor();
+    }
+}
+
+/*!
+ * Viewports set with setViewport() also repaint on theme changes.
+ */
+void QtAntdTable::setupViewport(QWidget *viewport)
+{
+    Q_D(QtAntdTable);
+
+    QTableView::setupViewport(viewport);
+    d->registerViewport(viewport);
+}
@@ -0,0 +1,108 @@
+#ifndef QTANTDTABLE_P_H
+#define QTANTDTABLE_P_H
+
+#include <QtGlobal>
+#include <QColor>
+#include <QHeaderView>
+#include <QPair>
+#include <QPointer>
+#include <QSet>
+#include <QStyledItemDelegate>
+#include <QTimer>
+#include <QVector>
+#include "antdlib/qtantdcolorcache_p.h"
+
+class QtAntdTable;
+class QtAntdTablePrivate;
+class QtAntdTableProxyModel;
+
+struct QtAntdTableColors
+{
+    QColor background;
+    QColor stripe;
+    QColor hover;
+    QColor selected;
+    QColor border;
+    QColor header;
+    QColor headerText;
+    QColor text;
+    QColor selectedText;
+    QColor sortInactive;
+    QColor sortActive;
+};
+
+// Column header with the antd background, separators and sort carets
+class QtAntdTableHeader : public QHeaderView
+{
+public:
+    QtAntdTableHeader(QtAntdTablePrivate *table, QWidget *parent);
+
+    QSize sizeHint() const Q_DECL_OVERRIDE;
+
+protected:
+    void paintSection(QPainter *painter, const QRect &rect, int logicalIndex) const Q_DECL_OVERRIDE;
+    QSize sectionSizeFromContents(int logicalIndex) const Q_DECL_OVERRIDE;
+
+private:
+    QtAntdTablePrivate *const m_table;
+};
+
+// Cell contents; the row background is painted once per row by the table
+class QtAntdTableDelegate : public QStyledItemDelegate
+{
+public:
+    QtAntdTableDelegate(QtAntdTablePrivate *table, QObject *parent);
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option,
+               const QModelIndex &index) const Q_DECL_OVERRIDE;
+    QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const Q_DECL_OVERRIDE;
+
+private:
+    QtAntdTablePrivate *const m_table;
+};
+
+class QtAntdTablePrivate
+{
+    Q_DISABLE_COPY(QtAntdTablePrivate)
+    Q_DECLARE_PUBLIC(QtAntdTable)
+
+public:
+    QtAntdTablePrivate(QtAntdTable *q);
+    ~QtAntdTablePrivate();
+
+    void init();
+    void registerViewport(QWidget *viewport);
+    void updateHeader();
+    const QtAntdTableColors &colors();
+    int rowHeight() const;
+    int padding() const;
+
+    void paintRows(QPainter *painter, const QRect &rect);
+    void setHoverRow(int row);
+    void updateHoverFromCursor();
+    void updateRow(int row);
+    void cycleSort(int column);
+
+    // Variable row heights
+    void scheduleMeasure();
+    void measureVisibleRows();
+    void resetRowHeights();
+    void resizeRows(const QVector<QPair<int, int>> &heights);
+
+    QtAntdTable *const q_ptr;
+    QtAntdTableProxyModel *proxy;
+    QPointer<QtAntdTableHeader> header; // Null once replaced by setHorizontalHeader()
+    QtAntdTableDelegate *delegate;
+    QtAntdTable::TableSize tableSize;
+    bool uniformRowHeights;
+    bool striped;
+    bool useThemeColors;
+    QSet<int> sortableColumns;
+    int hoverRow;
+    QVector<bool> measured; // By proxy row
+    bool measuring;
+    QTimer measureTimer;
+    QtAntdInternal::ResolvedColorCache<QtAntdTableColors, 1> colorCache;
+};
+
+#endif // QTANTDTABLE_P_H
@@ -0,0 +1,1448 @@
+#include "qtantdtableproxymodel.h"
+#include "qtantdtableproxymodel_p.h"
+#include <QBitArray>
+#include <QDate>
+#include <QDateTime>
+#include <QTime>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <numeric>
+
+namespace {
+
+// Rows sorted with std::sort before the merge passes
+const int gRunLength = 4096;
+// Larger source changes are re-evaluated in the background instead of row by row
+const int gIncrementalLimit = 1000;
+// Row entries shifted by the range signals of an applied evaluation; beyond
+// this a model reset is cheaper
+const qint64 gRowShiftBudget = qint64(1) << 26;
+
+QtAntdTableSortKey makeSortKey(const QVariant &value)
+{
+    QtAntdTableSortKey key;
+    switch (value.userType()) {
+    case QMetaType::Bool:
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::Long:
+    case QMetaType::ULong:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::Short:
+    case QMetaType::UShort:
+    case QMetaType::Float:
+    case QMetaType::Double:
+        key.numeric = true;
+        key.number = value.toDouble();
+        break;
+    case QMetaType::QDate:
+        key.numeric = true;
+        key.number = double(value.toDate().toJulianDay());
+        break;
+    case QMetaType::QTime:
+        key.numeric = true;
+        key.number = value.toTime().msecsSinceStartOfDay();
+        break;
+    case QMetaType::QDateTime:
+        key.numeric = true;
+        key.number = double(value.toDateTime().toMSecsSinceEpoch());
+        break;
+    default:
+        key.text = value.toString();
+        break;
+    }
+    return key;
+}
+
+// Numbers sort before text
+int compareSortKeys(const QtAntdTableSortKey &left, const QtAntdTableSortKey &right)
+{
+    if (left.numeric != right.numeric) {
+        return left.numeric ? -1 : 1;
+    }
+    if (left.numeric) {
+        return left.number < right.number ? -1 : (right.number < left.number ? 1 : 0);
+    }
+    return left.text.compare(right.text, Qt::CaseInsensitive);
+}
+
+} // namespace
+
+/*!
+ * \class QtAntdTableProxyModelPrivate
+ * \internal
+ */
+
+/*!
+ * \internal
+ */
+QtAntdTableProxyModelPrivate::QtAntdTableProxyModelPrivate(QtAntdTableProxyModel *q)
+    : q_ptr(q)
+    , sortColumn(-1)
+    , sortOrder(Qt::AscendingOrder)
+    , sortRole(Qt::DisplayRole)
+    , timeSlice(8)
+    , customFilter(false)
+    , identityMapping(true)
+    , sourceToProxyDirty(true)
+    , stage(Idle)
+    , pending(false)
+    , rowSetChanged(false)
+    , narrowing(false)
+    , cursor(0)
+    , runWidth(gRunLength)
+    , mergeLow(0)
+    , mergeMid(0)
+    , mergeHigh(0)
+    , mergeLeft(0)
+    , mergeRight(0)
+    , mergeOut(0)
+    , merging(false)
+    , resetting(false)
+{
+}
+
+/*!
+ * \internal
+ */
+QtAntdTableProxyModelPrivate::~QtAntdTableProxyModelPrivate()
+{
+}
+
+/*!
+ * \internal
+ */
+void QtAntdTableProxyModelPrivate::init()
+{
+    timer.setSingleShot(true);
+    timer.setInterval(0);
+    QObject::connect(&timer, &QTimer::timeout, [this]() { runSlice(timeSlice); });
+}
+
+int QtAntdTableProxyModelPrivate::sourceRowCount() const
+{
+    Q_Q(const QtAntdTableProxyModel);
+
+    const QAbstractItemModel *source = q->sourceModel();
+    return source ? source->rowCount() : 0;
+}
+
+int QtAntdTableProxyModelPrivate::toSource(int proxyRow) const
+{
+    if (identityMapping) {
+        return proxyRow;
+    }
+    return proxyRow >= 0 && proxyRow < proxyToSource.size() ? proxyToSource.at(proxyRow) : -1;
+}
+
+/*!
+ * \internal
+ * Proxy row of sourceRow, or -1 when it is filtered out. The reverse table is
+ * rebuilt on demand after the mapping changed.
+ */
+int QtAntdTableProxyModelPrivate::fromSource(int sourceRow) const
+{
+    const int count = sourceRowCount();
+    if (sourceRow < 0 || sourceRow >= count) {
+        return -1;
+    }
+    if (identityMapping) {
+        return sourceRow;
+    }
+
+    if (sourceToProxyDirty) {
+        sourceToProxy.fill(-1, count);
+        for (int row = 0; row < proxyToSource.size(); ++row) {
+            const int source = proxyToSource.at(row);
+            if (source < count) {
+                sourceToProxy[source] = row;
+            }
+        }
+        sourceToProxyDirty = false;
+    }
+    return sourceToProxy.at(sourceRow);
+}
+
+bool QtAntdTableProxyModelPrivate::accepts(int sourceRow) const
+{
+    Q_Q(const QtAntdTableProxyModel);
+
+    return q->filterAcceptsRow(sourceRow, QModelIndex());
+}
+
+QtAntdTableSortKey QtAntdTableProxyModelPrivate::sortKey(int sourceRow) const
+{
+    Q_Q(const QtAntdTableProxyModel);
+
+    const QAbstractItemModel *source = q->sourceModel();
+    return makeSortKey(source->data(source->index(sourceRow, sortColumn), sortRole));
+}
+
+/*!
+ * \internal
+ * Row order for sortOrder; equal keys keep the source order.
+ */
+bool QtAntdTableProxyModelPrivate::lessThan(const QVector<QtAntdTableSortKey> &sortKeys,
+                                            int leftRow, int rightRow) const
+{
+    const int result = compareSortKeys(sortKeys.at(leftRow), sortKeys.at(rightRow));
+    if (result == 0) {
+        return leftRow < rightRow;
+    }
+    return sortOrder == Qt::AscendingOrder ? result < 0 : result > 0;
+}
+
+/*!
+ * \internal
+ * Starts evaluating the current settings from scratch. The current mapping is
+ * kept until the evaluation is applied. narrow evaluates only the rows shown
+ * now, for filters that can only hide more rows.
+ */
+void QtAntdTableProxyModelPrivate::invalidate(bool rowSetChange, bool narrow)
+{
+    rowSetChanged = rowSetChanged || rowSetChange;
+    narrowing = narrow;
+    candidates = narrow ? proxyToSource : QVector<int>();
+    if (!narrow) {
+        // Every row is checked again
+        dirtyRows.clear();
+    }
+    work.clear();
+    workKeys.clear();
+    buffer.clear();
+    cursor = 0;
+    merging = false;
+
+    if (isIdentity()) {
+        stage = Idle;
+        timer.stop();
+        apply();
+        return;
+    }
+
+    stage = Filtering;
+    setPending(true);
+    timer.start();
+}
+
+/*!
+ * \internal
+ * Source rows moved under a running evaluation; its partial results are stale.
+ * Inserted, removed and edited rows keep it running instead, see
+ * pendingRowsInserted(), pendingRowsRemoved() and markDirty().
+ */
+void QtAntdTableProxyModelPrivate::restartPending()
+{
+    if (stage != Idle) {
+        invalidate(false);
+    }
+}
+
+/*!
+ * \internal
+ * Source rows first..last changed while an evaluation runs; they are checked
+ * again when it is applied.
+ */
+void QtAntdTableProxyModelPrivate::markDirty(int first, int last)
+{
+    if (last - first + 1 > gIncrementalLimit) {
+        invalidate(true);
+        return;
+    }
+    for (int row = first; row <= last; ++row) {
+        dirtyRows.append(row);
+    }
+    rowSetChanged = true;
+}
+
+/*!
+ * \internal
+ * count source rows were inserted at first while an evaluation runs. The rows
+ * it has seen are renumbered and the new ones marked dirty, so it keeps going.
+ */
+void QtAntdTableProxyModelPrivate::pendingRowsInserted(int first, int count)
+{
+    if (count > gIncrementalLimit) {
+        invalidate(true);
+        return;
+    }
+
+    const auto renumber = [first, count](QVector<int> &rows) {
+        for (int &row : rows) {
+            if (row >= first) {
+                row += count;
+            }
+        }
+    };
+    renumber(candidates);
+    renumber(work);
+    renumber(buffer);
+    renumber(dirtyRows);
+    if (stage == Filtering && !narrowing && cursor > first) {
+        cursor += count;
+    }
+    if (!workKeys.isEmpty()) {
+        workKeys.insert(qMin(first, workKeys.size()), count, QtAntdTableSortKey());
+    }
+    markDirty(first, first + count - 1);
+}
+
+/*!
+ * \internal
+ * count source rows were removed at first while an evaluation runs. They are
+ * dropped from its partial results and the other rows renumbered. Sorting
+ * starts over from the collected keys once runs were formed, as removing
+ * entries moves the run boundaries.
+ */
+void QtAntdTableProxyModelPrivate::pendingRowsRemoved(int first, int count)
+{
+    const int last = first + count - 1;
+    // Returns how many of the first `before` entries were dropped
+    const auto drop = [first, last, count](QVector<int> &rows, int before) {
+        int kept = 0;
+        int dropped = 0;
+        for (int i = 0; i < rows.size(); ++i) {
+            const int row = rows.at(i);
+            if (row >= first && row <= last) {
+                if (i < before) {
+                    ++dropped;
+                }
+                continue;
+            }
+            rows[kept++] = row > last ? row - count : row;
+        }
+        rows.resize(kept);
+        return dropped;
+    };
+
+    drop(dirtyRows, 0);
+    if (first < workKeys.size()) {
+        workKeys.remove(first, qMin(count, workKeys.size() - first));
+    }
+
+    switch (stage) {
+    case Filtering:
+        if (narrowing) {
+            cursor -= drop(candidates, cursor);
+        } else if (cursor > last) {
+            cursor -= count;
+        } else if (cursor > first) {
+            cursor = first;
+        }
+        drop(work, 0);
+        break;
+    case CollectingKeys:
+        cursor -= drop(work, cursor);
+        break;
+    case SortingRuns:
+    case Merging:
+        // Mid-merge, work still holds every row; buffer is only output
+        drop(work, 0);
+        buffer.clear();
+        merging = false;
+        cursor = 0;
+        stage = SortingRuns;
+        break;
+    case Idle:
+        break;
+    }
+}
+
+/*!
+ * \internal
+ * Checks the rows marked dirty during the evaluation again and merges the
+ * accepted ones into its result at their positions.
+ */
+void QtAntdTableProxyModelPrivate::mergeDirtyRows()
+{
+    if (dirtyRows.isEmpty()) {
+        return;
+    }
+
+    const int count = sourceRowCount();
+    std::sort(dirtyRows.begin(), dirtyRows.end());
+    dirtyRows.erase(std::unique(dirtyRows.begin(), dirtyRows.end()), dirtyRows.end());
+
+    QBitArray dirty(count);
+    for (const int row : dirtyRows) {
+        if (row < count) {
+            dirty.setBit(row);
+        }
+    }
+    work.erase(std::remove_if(work.begin(), work.end(), [&dirty](int row) { return dirty.testBit(row); }),
+               work.end());
+
+    if (sortColumn >= 0) {
+        workKeys.resize(count);
+    }
+    QVector<int> accepted;
+    for (const int row : dirtyRows) {
+        if (row < count && accepts(row)) {
+            if (sortColumn >= 0) {
+                workKeys[row] = sortKey(row);
+            }
+            accepted.append(row);
+        }
+    }
+    dirtyRows.clear();
+
+    QVector<int> merged;
+    merged.reserve(work.size() + accepted.size());
+    if (sortColumn >= 0) {
+        const auto less = [this](int left, int right) { return lessThan(workKeys, left, right); };
+        std::sort(accepted.begin(), accepted.end(), less);
+        std::merge(work.cbegin(), work.cend(), accepted.cbegin(), accepted.cend(),
+                   std::back_inserter(merged), less);
+    } else {
+        std::merge(work.cbegin(), work.cend(), accepted.cbegin(), accepted.cend(),
+                   std::back_inserter(merged));
+    }
+    work.swap(merged);
+}
+
+/*!
+ * \internal
+ * Advances the evaluation for up to budgetMs milliseconds (without limit when
+ * negative), applying it once complete.
+ */
+void QtAntdTableProxyModelPrivate::runSlice(qint64 budgetMs)
+{
+    QElapsedTimer clock;
+    clock.start();
+    const auto expired = [&clock, budgetMs]() { return budgetMs >= 0 && clock.elapsed() >= budgetMs; };
+
+    while (stage != Idle) {
+        switch (stage) {
+        case Filtering: {
+            const int count = narrowing ? candidates.size() : sourceRowCount();
+            while (cursor < count) {
+                const int row = narrowing ? candidates.at(cursor) : cursor;
+                ++cursor;
+                if (accepts(row)) {
+                    work.append(row);
+                }
+                if ((cursor & 0xff) == 0 && expired()) {
+                    timer.start();
+                    return;
+                }
+            }
+            cursor = 0;
+            if (sortColumn < 0) {
+                stage = Idle;
+            } else if (narrowing) {
+                // Dropping rows from a sorted list keeps it sorted
+                workKeys = keys;
+                stage = Idle;
+            } else {
+                workKeys.resize(sourceRowCount());
+                stage = CollectingKeys;
+            }
+            break;
+        }
+        case CollectingKeys:
+            while (cursor < work.size()) {
+                const int row = work.at(cursor++);
+                workKeys[row] = sortKey(row);
+                if ((cursor & 0xff) == 0 && expired()) {
+                    timer.start();
+                    return;
+                }
+            }
+            cursor = 0;
+            stage = SortingRuns;
+            break;
+        case SortingRuns:
+            while (cursor < work.size()) {
+                const int end = qMin(cursor + gRunLength, work.size());
+                std::sort(work.begin() + cursor, work.begin() + end,
+                          [this](int left, int right) { return lessThan(workKeys, left, right); });
+                cursor = end;
+                if (expired()) {
+                    timer.start();
+                    return;
+                }
+            }
+            cursor = 0;
+            runWidth = gRunLength;
+            mergeLow = 0;
+            merging = false;
+            buffer.resize(work.size());
+            stage = Merging;
+            break;
+        case Merging: {
+            // Bottom-up merge sort; a merge can stop after any element and resume
+            const int count = work.size();
+            while (runWidth < count) {
+                if (!merging) {
+                    if (mergeLow >= count) {
+                        work.swap(buffer);
+                        runWidth *= 2;
+                        mergeLow = 0;
+                        continue;
+                    }
+                    mergeMid = qMin(mergeLow + runWidth, count);
+                    mergeHigh = qMin(mergeLow + 2 * runWidth, count);
+                    mergeLeft = mergeLow;
+                    mergeRight = mergeMid;
+                    mergeOut = mergeLow;
+                    merging = true;
+                }
+
+                const int *in = work.constData();
+                int *out = buffer.data();
+                while (mergeOut < mergeHigh) {
+                    if (mergeRight >= mergeHigh
+                        || (mergeLeft < mergeMid && !lessThan(workKeys, in[mergeRight], in[mergeLeft]))) {
+                        out[mergeOut++] = in[mergeLeft++];
+                    } else {
+                        out[mergeOut++] = in[mergeRight++];
+                    }
+                    if ((mergeOut & 0x3ff) == 0 && expired()) {
+                        timer.start();
+                        return;
+                    }
+                }
+                merging = false;
+                mergeLow = mergeHigh;
+            }
+            stage = Idle;
+            break;
+        }
+        case Idle:
+            break;
+        }
+    }
+
+    apply();
+}
+
+/*!
+ * \internal
+ * Installs the evaluated mapping. A pure reordering is a layout change; a
+ * changed row set removes and inserts the rows that differ, so persistent
+ * indexes (selection, current index, editors) follow in both cases. Only a
+ * difference too scattered to signal cheaply resets the model.
+ */
+void QtAntdTableProxyModelPrivate::apply()
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    const bool identity = isIdentity();
+    if (identity) {
+        dirtyRows.clear();
+    } else {
+        mergeDirtyRows();
+    }
+
+    const auto install = [this, identity]() {
+        identityMapping = identity;
+        if (identity) {
+            proxyToSource.clear();
+            keys.clear();
+        } else {
+            proxyToSource.swap(work);
+            keys.swap(workKeys);
+            if (sortColumn < 0) {
+                keys.clear();
+            } else {
+                // insertRow() indexes keys by source row
+                keys.resize(sourceRowCount());
+            }
+        }
+        work.clear();
+        workKeys.clear();
+        buffer.clear();
+        candidates.clear();
+        sourceToProxyDirty = true;
+    };
+
+    if (identity && identityMapping) {
+        install();
+    } else if (!rowSetChanged) {
+        changeLayout(install);
+    } else if (changeRows(identity)) {
+        install();
+    } else {
+        q->beginResetModel();
+        install();
+        q->endResetModel();
+    }
+
+    rowSetChanged = false;
+    narrowing = false;
+    setPending(false);
+}
+
+/*!
+ * \internal
+ * Runs install, which reorders the mapping, as a layout change that keeps
+ * persistent indexes on their source rows.
+ */
+void QtAntdTableProxyModelPrivate::changeLayout(const std::function<void()> &install)
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    emit q->layoutAboutToBeChanged(QList<QPersistentModelIndex>(), QAbstractItemModel::VerticalSortHint);
+
+    const QModelIndexList from = q->persistentIndexList();
+    QVector<int> sourceRows;
+    sourceRows.reserve(from.size());
+    for (const QModelIndex &index : from) {
+        sourceRows.append(toSource(index.row()));
+    }
+
+    install();
+
+    QModelIndexList to;
+    to.reserve(from.size());
+    for (int i = 0; i < from.size(); ++i) {
+        const int row = fromSource(sourceRows.at(i));
+        to.append(row < 0 ? QModelIndex() : q->index(row, from.at(i).column()));
+    }
+    q->changePersistentIndexList(from, to);
+
+    emit q->layoutChanged(QList<QPersistentModelIndex>(), QAbstractItemModel::VerticalSortHint);
+}
+
+/*!
+ * \internal
+ * Turns the current mapping into the evaluated one (work, or every source row
+ * when identity) as QSortFilterProxyModel does: ranges of rows that are no
+ * longer shown are removed, the remaining rows are reordered with a layout
+ * change if their order differs, and ranges of new rows are inserted. Leaves
+ * proxyToSource equal to the evaluated rows. Returns false, changing nothing,
+ * when the ranges would shift more row entries than resetting costs.
+ */
+bool QtAntdTableProxyModelPrivate::changeRows(bool identity)
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    const int count = sourceRowCount();
+    QVector<int> allRows;
+    if (identity || identityMapping) {
+        allRows.resize(count);
+        std::iota(allRows.begin(), allRows.end(), 0);
+    }
+    const QVector<int> &to = identity ? allRows : work;
+    const QVector<int> from = identityMapping ? allRows : proxyToSource;
+
+    QBitArray inFrom(count);
+    QBitArray inTo(count);
+    for (const int row : from) {
+        inFrom.setBit(row);
+    }
+    for (const int row : to) {
+        inTo.setBit(row);
+    }
+
+    qint64 ranges = 0;
+    for (int i = 0; i < from.size(); ++i) {
+        if (!inTo.testBit(from.at(i)) && (i == 0 || inTo.testBit(from.at(i - 1)))) {
+            ++ranges;
+        }
+    }
+    for (int i = 0; i < to.size(); ++i) {
+        if (!inFrom.testBit(to.at(i)) && (i == 0 || inFrom.testBit(to.at(i - 1)))) {
+            ++ranges;
+        }
+    }
+    if (ranges * qMax(from.size(), to.size()) > gRowShiftBudget) {
+        return false;
+    }
+
+    // The same rows, now listed explicitly
+    proxyToSource = from;
+    identityMapping = false;
+    sourceToProxyDirty = true;
+
+    // Last range first, so the rows before it keep their positions
+    for (int end = proxyToSource.size(); end > 0;) {
+        if (inTo.testBit(proxyToSource.at(end - 1))) {
+            --end;
+            continue;
+        }
+        int begin = end - 1;
+        while (begin > 0 && !inTo.testBit(proxyToSource.at(begin - 1))) {
+            --begin;
+        }
+        q->beginRemoveRows(QModelIndex(), begin, end - 1);
+        proxyToSource.remove(begin, end - begin);
+        sourceToProxyDirty = true;
+        q->endRemoveRows();
+        end = begin;
+    }
+
+    QVector<int> kept;
+    kept.reserve(proxyToSource.size());
+    for (const int row : to) {
+        if (inFrom.testBit(row)) {
+            kept.append(row);
+        }
+    }
+    if (kept != proxyToSource) {
+        changeLayout([this, &kept]() {
+            proxyToSource.swap(kept);
+            sourceToProxyDirty = true;
+        });
+    }
+
+    // Rows before position already match the evaluated ones
+    for (int position = 0; position < to.size();) {
+        if (inFrom.testBit(to.at(position))) {
+            ++position;
+            continue;
+        }
+        int end = position + 1;
+        while (end < to.size() && !inFrom.testBit(to.at(end))) {
+            ++end;
+        }
+        q->beginInsertRows(QModelIndex(), position, end - 1);
+        proxyToSource.insert(position, end - position, 0);
+        std::copy(to.cbegin() + position, to.cbegin() + end, proxyToSource.begin() + position);
+        sourceToProxyDirty = true;
+        q->endInsertRows();
+        position = end;
+    }
+    return true;
+}
+
+void QtAntdTableProxyModelPrivate::setPending(bool value)
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    if (pending == value) {
+        return;
+    }
+
+    pending = value;
+    emit q->pendingChanged(value);
+}
+
+/*!
+ * \internal
+ * Adds sourceRow to the current mapping at its sorted (or source order)
+ * position if it is accepted.
+ */
+void QtAntdTableProxyModelPrivate::insertRow(int sourceRow)
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    if (!accepts(sourceRow)) {
+        return;
+    }
+
+    QVector<int>::iterator position;
+    if (sortColumn >= 0) {
+        keys[sourceRow] = sortKey(sourceRow);
+        position = std::upper_bound(proxyToSource.begin(), proxyToSource.end(), sourceRow,
+                                    [this](int left, int right) { return lessThan(keys, left, right); });
+    } else {
+        position = std::lower_bound(proxyToSource.begin(), proxyToSource.end(), sourceRow);
+    }
+
+    const int row = int(position - proxyToSource.begin());
+    q->beginInsertRows(QModelIndex(), row, row);
+    proxyToSource.insert(row, sourceRow);
+    sourceToProxyDirty = true;
+    q->endInsertRows();
+}
+
+/*!
+ * \internal
+ * Re-checks sourceRow after its data changed. A row that stays accepted and in
+ * order keeps its proxy row, so views keep their current index, selection and
+ * open editors; otherwise it is moved, inserted or removed.
+ */
+void QtAntdTableProxyModelPrivate::updateRow(int sourceRow)
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    const int proxyRow = fromSource(sourceRow);
+    if (proxyRow < 0) {
+        insertRow(sourceRow);
+        return;
+    }
+    if (!accepts(sourceRow)) {
+        removeProxyRow(proxyRow);
+        return;
+    }
+    if (sortColumn < 0) {
+        return;
+    }
+
+    keys[sourceRow] = sortKey(sourceRow);
+    const auto less = [this](int left, int right) { return lessThan(keys, left, right); };
+    const QVector<int>::iterator begin = proxyToSource.begin();
+    int destination;
+    if (proxyRow > 0 && less(sourceRow, proxyToSource.at(proxyRow - 1))) {
+        destination = int(std::upper_bound(begin, begin + proxyRow, sourceRow, less) - begin);
+    } else if (proxyRow + 1 < proxyToSource.size() && less(proxyToSource.at(proxyRow + 1), sourceRow)) {
+        destination = int(std::upper_bound(begin + proxyRow + 1, proxyToSource.end(), sourceRow, less) - begin);
+    } else {
+        return;
+    }
+
+    q->beginMoveRows(QModelIndex(), proxyRow, proxyRow, QModelIndex(), destination);
+    proxyToSource.remove(proxyRow);
+    proxyToSource.insert(destination > proxyRow ? destination - 1 : destination, sourceRow);
+    sourceToProxyDirty = true;
+    q->endMoveRows();
+}
+
+void QtAntdTableProxyModelPrivate::removeProxyRow(int proxyRow)
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    q->beginRemoveRows(QModelIndex(), proxyRow, proxyRow);
+    proxyToSource.remove(proxyRow);
+    sourceToProxyDirty = true;
+    q->endRemoveRows();
+}
+
+void QtAntdTableProxyModelPrivate::connectSource()
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    QAbstractItemModel *source = q->sourceModel();
+    if (!source) {
+        return;
+    }
+
+    sourceConnections
+        << QObject::connect(source, &QAbstractItemModel::rowsAboutToBeInserted, q,
+                            [this](const QModelIndex &parent, int first, int last) {
+                                sourceRowsAboutToBeInserted(parent, first, last);
+                            })
+        << QObject::connect(source, &QAbstractItemModel::rowsInserted, q,
+                            [this](const QModelIndex &parent, int first, int last) {
+                                sourceRowsInserted(parent, first, last);
+                            })
+        << QObject::connect(source, &QAbstractItemModel::rowsAboutToBeRemoved, q,
+                            [this](const QModelIndex &parent, int first, int last) {
+                                sourceRowsAboutToBeRemoved(parent, first, last);
+                            })
+        << QObject::connect(source, &QAbstractItemModel::rowsRemoved, q,
+                            [this](const QModelIndex &parent, int first, int last) {
+                                sourceRowsRemoved(parent, first, last);
+                            })
+        << QObject::connect(source, &QAbstractItemModel::rowsAboutToBeMoved, q,
+                            [this]() { sourceLayoutAboutToBeChanged(); })
+        << QObject::connect(source, &QAbstractItemModel::rowsMoved, q,
+                            [this]() { sourceLayoutChanged(); })
+        << QObject::connect(source, &QAbstractItemModel::columnsAboutToBeInserted, q,
+                            [q](const QModelIndex &parent, int first, int last) {
+                                if (!parent.isValid()) {
+                                    q->beginInsertColumns(QModelIndex(), first, last);
+                                }
+                            })
+        << QObject::connect(source, &QAbstractItemModel::columnsInserted, q,
+                            [q](const QModelIndex &parent) {
+                                if (!parent.isValid()) {
+                                    q->endInsertColumns();
+                                }
+                            })
+        << QObject::connect(source, &QAbstractItemModel::columnsAboutToBeRemoved, q,
+                            [q](const QModelIndex &parent, int first, int last) {
+                                if (!parent.isValid()) {
+                                    q->beginRemoveColumns(QModelIndex(), first, last);
+                                }
+                            })
+        << QObject::connect(source, &QAbstractItemModel::columnsRemoved, q,
+                            [q](const QModelIndex &parent) {
+                                if (!parent.isValid()) {
+                                    q->endRemoveColumns();
+                                }
+                            })
+        << QObject::connect(source, &QAbstractItemModel::columnsAboutToBeMoved, q,
+                            [this]() { sourceLayoutAboutToBeChanged(); })
+        << QObject::connect(source, &QAbstractItemModel::columnsMoved, q,
+                            [this]() { sourceLayoutChanged(); })
+        << QObject::connect(source, &QAbstractItemModel::dataChanged, q,
+                            [this](const QModelIndex &topLeft, const QModelIndex &bottomRight,
+                                   const QVector<int> &roles) {
+                                sourceDataChanged(topLeft, bottomRight, roles);
+                            })
+        << QObject::connect(source, &QAbstractItemModel::headerDataChanged, q,
+                            [this, q](Qt::Orientation orientation, int first, int last) {
+                                if (orientation == Qt::Horizontal || identityMapping) {
+                                    emit q->headerDataChanged(orientation, first, last);
+                                } else if (!proxyToSource.isEmpty()) {
+                                    emit q->headerDataChanged(orientation, 0, proxyToSource.size() - 1);
+                                }
+                            })
+        << QObject::connect(source, &QAbstractItemModel::layoutAboutToBeChanged, q,
+                            [this]() { sourceLayoutAboutToBeChanged(); })
+        << QObject::connect(source, &QAbstractItemModel::layoutChanged, q,
+                            [this]() { sourceLayoutChanged(); })
+        << QObject::connect(source, &QAbstractItemModel::modelAboutToBeReset, q,
+                            [this]() { beginSourceReset(); })
+        << QObject::connect(source, &QAbstractItemModel::modelReset, q,
+                            [this]() { endSourceReset(); })
+        << QObject::connect(source, &QObject::destroyed, q, [this]() {
+                                beginSourceReset();
+                                endSourceReset();
+                            });
+}
+
+void QtAntdTableProxyModelPrivate::disconnectSource()
+{
+    for (const QMetaObject::Connection &connection : sourceConnections) {
+        QObject::disconnect(connection);
+    }
+    sourceConnections.clear();
+}
+
+void QtAntdTableProxyModelPrivate::sourceRowsAboutToBeInserted(const QModelIndex &parent, int first, int last)
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    if (!parent.isValid() && identityMapping) {
+        q->beginInsertRows(QModelIndex(), first, last);
+    }
+}
+
+void QtAntdTableProxyModelPrivate::sourceRowsInserted(const QModelIndex &parent, int first, int last)
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    if (parent.isValid()) {
+        return;
+    }
+    const int count = last - first + 1;
+    if (identityMapping) {
+        q->endInsertRows();
+        if (stage != Idle) {
+            pendingRowsInserted(first, count);
+        }
+        return;
+    }
+
+    for (int &row : proxyToSource) {
+        if (row >= first) {
+            row += count;
+        }
+    }
+    if (sortColumn >= 0) {
+        // Kept one key per source row, also when the source was empty
+        keys.insert(qMin(first, keys.size()), count, QtAntdTableSortKey());
+    }
+    sourceToProxyDirty = true;
+
+    if (stage != Idle) {
+        // Shown once the running evaluation is applied
+        pendingRowsInserted(first, count);
+        return;
+    }
+    if (count > gIncrementalLimit) {
+        invalidate(true);
+        return;
+    }
+    for (int row = first; row <= last; ++row) {
+        insertRow(row);
+    }
+}
+
+void QtAntdTableProxyModelPrivate::sourceRowsAboutToBeRemoved(const QModelIndex &parent, int first, int last)
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    if (parent.isValid()) {
+        return;
+    }
+    if (identityMapping) {
+        q->beginRemoveRows(QModelIndex(), first, last);
+        return;
+    }
+
+    if (last - first + 1 > gIncrementalLimit) {
+        q->beginResetModel();
+        resetting = true;
+        return;
+    }
+
+    // Highest first, so the remaining proxy rows keep their positions
+    QVector<int> rows;
+    for (int row = first; row <= last; ++row) {
+        const int proxyRow = fromSource(row);
+        if (proxyRow >= 0) {
+            rows.append(proxyRow);
+        }
+    }
+    std::sort(rows.begin(), rows.end(), std::greater<int>());
+    for (int proxyRow : rows) {
+        removeProxyRow(proxyRow);
+    }
+}
+
+void QtAntdTableProxyModelPrivate::sourceRowsRemoved(const QModelIndex &parent, int first, int last)
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    if (parent.isValid()) {
+        return;
+    }
+    const int count = last - first + 1;
+    if (identityMapping) {
+        q->endRemoveRows();
+        if (stage != Idle) {
+            pendingRowsRemoved(first, count);
+        }
+        return;
+    }
+
+    // Removing rows never reorders the others, so the mapping stays valid
+    QVector<int> rows;
+    rows.reserve(proxyToSource.size());
+    for (int row : proxyToSource) {
+        if (row > last) {
+            rows.append(row - count);
+        } else if (row < first) {
+            rows.append(row);
+        }
+    }
+    proxyToSource.swap(rows);
+    if (sortColumn >= 0 && first < keys.size()) {
+        keys.remove(first, qMin(count, keys.size() - first));
+    }
+    sourceToProxyDirty = true;
+
+    if (resetting) {
+        resetting = false;
+        q->endResetModel();
+    }
+    if (stage != Idle) {
+        pendingRowsRemoved(first, count);
+    }
+}
+
+void QtAntdTableProxyModelPrivate::sourceDataChanged(const QModelIndex &topLeft,
+                                                     const QModelIndex &bottomRight,
+                                                     const QVector<int> &roles)
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    if (!topLeft.isValid() || topLeft.parent().isValid()) {
+        return;
+    }
+
+    const int first = topLeft.row();
+    const int last = bottomRight.row();
+    const int left = topLeft.column();
+    const int right = bottomRight.column();
+
+    bool affectsRows = customFilter
+        || (sortColumn >= left && sortColumn <= right && (roles.isEmpty() || roles.contains(sortRole)));
+    for (auto it = filters.cbegin(); it != filters.cend() && !affectsRows; ++it) {
+        affectsRows = it.key() >= left && it.key() <= right
+            && (roles.isEmpty() || roles.contains(Qt::DisplayRole));
+    }
+
+    if (identityMapping) {
+        emit q->dataChanged(q->index(first, left), q->index(last, right), roles);
+        if (affectsRows && stage != Idle) {
+            markDirty(first, last);
+        }
+        return;
+    }
+
+    const int count = last - first + 1;
+    if (affectsRows && stage != Idle) {
+        // Placed when the running evaluation is applied
+        markDirty(first, last);
+    } else if (affectsRows && count <= gIncrementalLimit) {
+        for (int row = first; row <= last; ++row) {
+            updateRow(row);
+        }
+    } else if (affectsRows) {
+        invalidate(true);
+    }
+
+    // Repaint the changed rows where they are shown now
+    int top = std::numeric_limits<int>::max();
+    int bottom = -1;
+    if (count > gIncrementalLimit) {
+        top = 0;
+        bottom = proxyToSource.size() - 1;
+    } else {
+        for (int row = first; row <= last; ++row) {
+            const int proxyRow = fromSource(row);
+            if (proxyRow >= 0) {
+                top = qMin(top, proxyRow);
+                bottom = qMax(bottom, proxyRow);
+            }
+        }
+    }
+    if (bottom >= 0 && top <= bottom) {
+        emit q->dataChanged(q->index(top, left), q->index(bottom, right), roles);
+    }
+}
+
+void QtAntdTableProxyModelPrivate::sourceLayoutAboutToBeChanged()
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    if (!identityMapping) {
+        // Every source row may have moved; the mapping is rebuilt
+        beginSourceReset();
+        return;
+    }
+
+    emit q->layoutAboutToBeChanged();
+    layoutProxyIndexes = q->persistentIndexList();
+    layoutSourceIndexes.clear();
+    for (int i = 0; i < layoutProxyIndexes.size(); ++i) {
+        layoutSourceIndexes.append(QPersistentModelIndex(q->mapToSource(layoutProxyIndexes.at(i))));
+    }
+}
+
+void QtAntdTableProxyModelPrivate::sourceLayoutChanged()
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    if (resetting) {
+        endSourceReset();
+        return;
+    }
+
+    QModelIndexList to;
+    to.reserve(layoutSourceIndexes.size());
+    for (int i = 0; i < layoutSourceIndexes.size(); ++i) {
+        to.append(q->mapFromSource(layoutSourceIndexes.at(i)));
+    }
+    q->changePersistentIndexList(layoutProxyIndexes, to);
+    layoutProxyIndexes.clear();
+    layoutSourceIndexes.clear();
+
+    emit q->layoutChanged();
+    restartPending();
+}
+
+void QtAntdTableProxyModelPrivate::beginSourceReset()
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    q->beginResetModel();
+    resetting = true;
+}
+
+void QtAntdTableProxyModelPrivate::endSourceReset()
+{
+    Q_Q(QtAntdTableProxyModel);
+
+    resetting = false;
+    proxyToSource.clear();
+    keys.clear();
+    sourceToProxyDirty = true;
+    identityMapping = isIdentity();
+    q->endResetModel();
+
+    if (!identityMapping) {
+        invalidate(true);
+    }
+}
+
+/*!
+ * \class QtAntdTableProxyModel
+ */
+
+QtAntdTableProxyModel::QtAntdTableProxyModel(QObject *parent)
+    : QAbstractProxyModel(parent)
+    , d_ptr(new QtAntdTableProxyModelPrivate(this))
+{
+    d_func()->init();
+}
+
+QtAntdTableProxyModel::~QtAntdTableProxyModel()
+{
+    Q_D(QtAntdTableProxyModel);
+
+    d->disconnectSource();
+}
+
+void QtAntdTableProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    Q_D(QtAntdTableProxyModel);
+
+    if (sourceModel == this->sourceModel()) {
+        return;
+    }
+
+    beginResetModel();
+    d->disconnectSource();
+    QAbstractProxyModel::setSourceModel(sourceModel);
+    d->connectSource();
+
+    d->timer.stop();
+    d->stage = QtAntdTableProxyModelPrivate::Idle;
+    d->proxyToSource.clear();
+    d->keys.clear();
+    d->sourceToProxyDirty = true;
+    d->identityMapping = d->isIdentity();
+    endResetModel();
+
+    if (d->identityMapping) {
+        d->setPending(false);
+    } else {
+        d->invalidate(true);
+    }
+}
+
+void QtAntdTableProxyModel::setColumnFilter(int column, const QString &text)
+{
+    Q_D(QtAntdTableProxyModel);
+
+    const QString previous = d->filters.value(column);
+    if (previous == text) {
+        return;
+    }
+
+    if (text.isEmpty()) {
+        d->filters.remove(column);
+    } else {
+        d->filters.insert(column, text);
+    }
+
+    // Typing more of a filter can only hide rows, so only the shown ones are checked
+    const bool narrow = d->stage == QtAntdTableProxyModelPrivate::Idle && !d->identityMapping
+        && !previous.isEmpty() && text.contains(previous, Qt::CaseInsensitive);
+    d->invalidate(true, narrow);
+}
+
+QString QtAntdTableProxyModel::columnFilter(int column) const
+{
+    Q_D(const QtAntdTableProxyModel);
+
+    return d->filters.value(column);
+}
+
+void QtAntdTableProxyModel::clearColumnFilters()
+{
+    Q_D(QtAntdTableProxyModel);
+
+    if (d->filters.isEmpty()) {
+        return;
+    }
+
+    d->filters.clear();
+    d->invalidate(true);
+}
+
+void QtAntdTableProxyModel::sort(int column, Qt::SortOrder order)
+{
+    Q_D(QtAntdTableProxyModel);
+
+    column = qMax(-1, column);
+    if (d->sortColumn == column && (column < 0 || d->sortOrder == order)) {
+        return;
+    }
+
+    d->sortColumn = column;
+    d->sortOrder = order;
+    d->invalidate(false);
+}
+
+int QtAntdTableProxyModel::sortColumn() const
+{
+    Q_D(const QtAntdTableProxyModel);
+
+    return d->sortColumn;
+}
+
+Qt::SortOrder QtAntdTableProxyModel::sortOrder() const
+{
+    Q_D(const QtAntdTableProxyModel);
+
+    return d->sortOrder;
+}
+
+void QtAntdTableProxyModel::setSortRole(int role)
+{
+    Q_D(QtAntdTableProxyModel);
+
+    if (d->sortRole == role) {
+        return;
+    }
+
+    d->sortRole = role;
+    if (d->sortColumn >= 0) {
+        d->invalidate(false);
+    }
+}
+
+int QtAntdTableProxyModel::sortRole() const
+{
+    Q_D(const QtAntdTableProxyModel);
+
+    return d->sortRole;
+}
+
+void QtAntdTableProxyModel::setTimeSlice(int msecs)
+{
+    Q_D(QtAntdTableProxyModel);
+
+    d->timeSlice = qMax(1, msecs);
+}
+
+int QtAntdTableProxyModel::timeSlice() const
+{
+    Q_D(const QtAntdTableProxyModel);
+
+    return d->timeSlice;
+}
+
+bool QtAntdTableProxyModel::isPending() const
+{
+    Q_D(const QtAntdTableProxyModel);
+
+    return d->pending;
+}
+
+void QtAntdTableProxyModel::flush()
+{
+    Q_D(QtAntdTableProxyModel);
+
+    if (d->stage == QtAntdTableProxyModelPrivate::Idle) {
+        return;
+    }
+
+    d->timer.stop();
+    d->runSlice(-1);
+}
+
+QModelIndex QtAntdTableProxyModel::mapToSource(const QModelIndex &proxyIndex) const
+{
+    Q_D(const QtAntdTableProxyModel);
+
+    const QAbstractItemModel *source = sourceModel();
+    if (!source || !proxyIndex.isValid()) {
+        return QModelIndex();
+    }
+
+    const int row = d->toSource(proxyIndex.row());
+    return row < 0 ? QModelIndex() : source->index(row, proxyIndex.column());
+}
+
+QModelIndex QtAntdTableProxyModel::mapFromSource(const QModelIndex &sourceIndex) const
+{
+    Q_D(const QtAntdTableProxyModel);
+
+    if (!sourceIndex.isValid() || sourceIndex.parent().isValid()) {
+        return QModelIndex();
+    }
+
+    const int row = d->fromSource(sourceIndex.row());
+    return row < 0 ? QModelIndex() : createIndex(row, sourceIndex.column());
+}
+
+QModelIndex QtAntdTableProxyModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (parent.isValid() || row < 0 || column < 0 || row >= rowCount() || column >= columnCount()) {
+        return QModelIndex();
+    }
+    return createIndex(row, column);
+}
+
+QModelIndex QtAntdTableProxyModel::parent(const QModelIndex &child) const
+{
+    Q_UNUSED(child);
+
+    return QModelIndex();
+}
+
+int QtAntdTableProxyModel::rowCount(const QModelIndex &parent) const
+{
+    Q_D(const QtAntdTableProxyModel);
+
+    if (parent.isValid()) {
+        return 0;
+    }
+    return d->identityMapping ? d->sourceRowCount() : d->proxyToSource.size();
+}
+
+int QtAntdTableProxyModel::columnCount(const QModelIndex &parent) const
+{
+    const QAbstractItemModel *source = sourceModel();
+    if (parent.isValid() || !source) {
+        return 0;
+    }
+    return source->columnCount();
+}
+
+QVariant QtAntdTableProxyModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    Q_D(const QtAntdTableProxyModel);
+
+    const QAbstractItemModel *source = sourceModel();
+    if (!source) {
+        return QAbstractProxyModel::headerData(section, orientation, role);
+    }
+    if (orientation == Qt::Vertical) {
+        section = d->toSource(section);
+        if (section < 0) {
+            return QVariant();
+        }
+    }
+    return source->headerData(section, orientation, role);
+}
+
+/*!
+ * The default implementation accepts rows matching every column filter.
+ */
+bool QtAntdTableProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
+{
+    Q_D(const QtAntdTableProxyModel);
+
+    const QAbstractItemModel *source = sourceModel();
+    for (auto it = d->filters.cbegin(); it != d->filters.cend(); ++it) {
+        const QModelIndex index = source->index(sourceRow, it.key(), sourceParent);
+        if (!source->data(index, Qt::DisplayRole).toString().contains(it.value(), Qt::CaseInsensitive)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ * Re-evaluates filterAcceptsRow() for every row. Also enables it for rows when
+ * no column filter is set, so reimplementations must call it once to take effect.
+ */
+void QtAntdTableProxyModel::invalidateFilter()
+{
+    Q_D(QtAntdTableProxyModel);
+
+    d->customFilter = true;
+    d->invalidate(true);
+}
+
+/*!
+ * Re-evaluates filterAcceptsRow() for the rows shown, for criteria that accept
+ * a subset of the rows accepted so far. Falls back to invalidateFilter() while
+ * an evaluation is pending, as the rows shown are then not yet its result.
+ */
+void QtAntdTableProxyModel::narrowFilter()
+{
+    Q_D(QtAntdTableProxyModel);
+
+    const bool narrow = d->stage == QtAntdTableProxyModelPrivate::Idle && !d->identityMapping;
+    d->customFilter = true;
+    d->invalidate(true, narrow);
+}
+
+/*!
+ * Returns to filtering by the column filters only, so that with none set the
+ * proxy maps rows 1:1 again. Reimplementations call it while their own
+ * criteria accept every row.
+ */
+void QtAntdTableProxyModel::resetFilter()
+{
+    Q_D(QtAntdTableProxyModel);
+
+    if (!d->customFilter) {
+        return;
+    }
+    d->customFilter = false;
+    d->invalidate(true);
+}
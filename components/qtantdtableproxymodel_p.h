@@ -0,0 +1,127 @@
+#ifndef QTANTDTABLEPROXYMODEL_P_H
+#define QTANTDTABLEPROXYMODEL_P_H
+
+#include <QtGlobal>
+#include <QAbstractItemModel>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMetaObject>
+#include <QPersistentModelIndex>
+#include <QString>
+#include <QTimer>
+#include <QVector>
+#include <functional>
+
+class QtAntdTableProxyModel;
+
+// Sort role value of one source row, read once per sort
+struct QtAntdTableSortKey
+{
+    QString text;
+    double number = 0;
+    bool numeric = false;
+};
+
+class QtAntdTableProxyModelPrivate
+{
+    Q_DISABLE_COPY(QtAntdTableProxyModelPrivate)
+    Q_DECLARE_PUBLIC(QtAntdTableProxyModel)
+
+public:
+    // Stages of an evaluation, run in time slices from the event loop
+    enum Stage {
+        Idle,
+        Filtering,      // Collecting the accepted source rows
+        CollectingKeys, // Reading the sort key of every accepted row
+        SortingRuns,    // Sorting fixed-size runs of rows
+        Merging         // Bottom-up merge passes over the sorted runs
+    };
+
+    QtAntdTableProxyModelPrivate(QtAntdTableProxyModel *q);
+    ~QtAntdTableProxyModelPrivate();
+
+    void init();
+
+    bool isIdentity() const { return filters.isEmpty() && sortColumn < 0 && !customFilter; }
+    int sourceRowCount() const;
+    int toSource(int proxyRow) const;
+    int fromSource(int sourceRow) const;
+
+    bool accepts(int sourceRow) const;
+    QtAntdTableSortKey sortKey(int sourceRow) const;
+    bool lessThan(const QVector<QtAntdTableSortKey> &sortKeys, int leftRow, int rightRow) const;
+
+    // Evaluation
+    void invalidate(bool rowSetChange, bool narrow = false);
+    void restartPending();
+    void markDirty(int first, int last);
+    void pendingRowsInserted(int first, int count);
+    void pendingRowsRemoved(int first, int count);
+    void runSlice(qint64 budgetMs);
+    void mergeDirtyRows();
+    void apply();
+    void changeLayout(const std::function<void()> &install);
+    bool changeRows(bool identity);
+    void setPending(bool value);
+
+    // Fine-grained updates of the current mapping
+    void insertRow(int sourceRow);
+    void updateRow(int sourceRow);
+    void removeProxyRow(int proxyRow);
+
+    // Source model notifications
+    void connectSource();
+    void disconnectSource();
+    void sourceRowsAboutToBeInserted(const QModelIndex &parent, int first, int last);
+    void sourceRowsInserted(const QModelIndex &parent, int first, int last);
+    void sourceRowsAboutToBeRemoved(const QModelIndex &parent, int first, int last);
+    void sourceRowsRemoved(const QModelIndex &parent, int first, int last);
+    void sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight,
+                           const QVector<int> &roles);
+    void sourceLayoutAboutToBeChanged();
+    void sourceLayoutChanged();
+    void beginSourceReset();
+    void endSourceReset();
+
+    QtAntdTableProxyModel *const q_ptr;
+
+    // Settings
+    QHash<int, QString> filters;
+    int sortColumn;
+    Qt::SortOrder sortOrder;
+    int sortRole;
+    int timeSlice;
+    bool customFilter;
+
+    // Current mapping; identityMapping means proxy row == source row
+    bool identityMapping;
+    QVector<int> proxyToSource;
+    QVector<QtAntdTableSortKey> keys; // By source row, while sorted
+    mutable QVector<int> sourceToProxy;
+    mutable bool sourceToProxyDirty;
+
+    // Evaluation in progress
+    Stage stage;
+    bool pending;
+    bool rowSetChanged; // Rows may be added or removed, not only reordered
+    bool narrowing;     // Filtering only the rows currently shown
+    int cursor;
+    QVector<int> candidates;
+    QVector<int> work;
+    QVector<int> buffer;
+    QVector<QtAntdTableSortKey> workKeys;
+    QVector<int> dirtyRows; // Source rows changed meanwhile, checked in apply()
+    int runWidth;
+    int mergeLow, mergeMid, mergeHigh, mergeLeft, mergeRight, mergeOut;
+    bool merging;
+    QTimer timer;
+
+    // Source layout changes of an identity mapping
+    QModelIndexList layoutProxyIndexes;
+    QList<QPersistentModelIndex> layoutSourceIndexes;
+    bool resetting;
+
+    QVector<QMetaObject::Connection> sourceConnections;
+};
+
+#endif // QTANTDTABLEPROXYMODEL_P_H
@@ -7,13 +7,21 @@
 #include "antdinputsettingseditor.h"
 #include "antdswitchsettingseditor.h"
 #include <QMap>
+#include <QPalette>
+#include <QVBoxLayout>
+#include <lib/qtantdstyle.h>
 #include <lib/qtantdtheme.h>
 #include <QPushButton>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent), isDarkMode(false)
 {
-    theme = QtAntdTheme::lightTheme(this);
+    // Components read their colors from the style's theme; switching its mode
+    // repaints every live QtAntd widget without re-polishing the window.
+    theme = QtAntdTheme::lightTheme();
+    QtAntdStyle::instance().setTheme(theme);
+    connect(theme, &QtAntdTheme::themeModeChanged, this, &MainWindow::applyTheme);
+
     QWidget *widget = new QWidget;
     QHBoxLayout *layout = new QHBoxLayout;
 
@@ -21,8 +29,14 @@ MainWindow::MainWindow(QWidget *parent)
 
     QStackedLayout *stack = new QStackedLayout;
     QListWidget *list = new QListWidget;
+    QPushButton *themeButton = new QPushButton("Toggle Dark Mode");
+    connect(themeButton, &QPushButton::clicked, this, &MainWindow::toggleTheme);
+
+    QVBoxLayout *sideLayout = new QVBoxLayout;
+    sideLayout->addWidget(list);
+    sideLayout->addWidget(themeButton);
 
-    layout->addWidget(list);
+    layout->addLayout(sideLayout);
     layout->addLayout(stack);
 
     layout->setStretch(1, 4);
@@ -64,24 +78,22 @@ void MainWindow::toggleTheme()
     } else {
         theme->setThemeMode(Antd::Light);
     }
-    applyTheme();
 }
 
 void MainWindow::applyTheme()
 {
-    // Apply theme to main window and widgets
-    QString bgColor = theme->background().name();
-    QString textColor = theme->text().name();
-    QString primaryColor = theme->primary().name();
-    QString borderColor = theme->border().name();
-    setStyleSheet(QString(
-        "QMainWindow { background-color: %1; color: %2; } "
-        "QListWidget { background-color: %1; color: %2; border: 1px solid %3; } "
-        "QListWidget::item:selected { background-color: %4; } "
-        "QPushButton { background-color: %4; color: white; border: none; "
-        "  padding: 8px 16px; border-radius: 4px; } "
-        "QPushButton:hover { background-color: %5; }"
-    ).arg(bgColor, textColor, borderColor, primaryColor, theme->getColor("primary-hover").name()));
+    // Only plain Qt widgets need the palette; QtAntd components follow the theme
+    QPalette palette = this->palette();
+    palette.setColor(QPalette::Window, theme->background());
+    palette.setColor(QPalette::WindowText, theme->text());
+    palette.setColor(QPalette::Base, theme->background());
+    palette.setColor(QPalette::AlternateBase, theme->getColor(Antd::ColorBackgroundSecondary));
+    palette.setColor(QPalette::Text, theme->text());
+    palette.setColor(QPalette::Button, theme->surface());
+    palette.setColor(QPalette::ButtonText, theme->text());
+    palette.setColor(QPalette::Highlight, theme->primary());
+    palette.setColor(QPalette::HighlightedText, Qt::white);
+    setPalette(palette);
 }
 
 MainWindow::~MainWindow()
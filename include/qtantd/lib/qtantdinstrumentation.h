@@ -0,0 +1,71 @@
+#ifndef QTANTDINSTRUMENTATION_H
+#define QTANTDINSTRUMENTATION_H
+
+#include "components_global.h"
+#include <QList>
+#include <QScopedPointer>
+#include <QString>
+
+class QWidget;
+class QtAntdInstrumentationPrivate;
+
+// Paint statistics of one component class (widget is null) or one live instance
+struct QtAntdPaintStats
+{
+    QString className;
+    QString objectName;              // Instances only
+    const QWidget *widget = nullptr; // Instances only
+
+    quint64 paintCount = 0;
+    qint64 totalPaintNs = 0;
+    qint64 maxPaintNs = 0;
+    quint64 updateCount = 0;         // update() requests made by the library
+    quint64 animationTickCount = 0;
+};
+
+/*!\class QtAntdInstrumentation
+ * \brief Opt-in paint statistics for QtAntd components.
+ *
+ * Recording is compiled in only when the library is configured with
+ * QTANTD_ENABLE_PAINT_INSTRUMENTATION=ON; otherwise isAvailable() returns false
+ * and every query is empty. When compiled in, recording starts disabled unless
+ * the QTANTD_PAINT_INSTRUMENTATION environment variable is set to a non-zero
+ * value, and can be toggled at runtime with setEnabled().
+ *
+ * Buttons, switches, inputs, dividers and the ripple overlay are covered.
+ * dump() writes a report to the "qtantd.paint" logging category at info level.
+ * All functions must be called from the GUI thread.
+ */
+class COMPONENTS_EXPORT QtAntdInstrumentation
+{
+public:
+    static QtAntdInstrumentation &instance();
+    ~QtAntdInstrumentation();
+
+    bool isAvailable() const;
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+
+    void reset();
+
+    // Sorted by cumulative paint time, most expensive first
+    QList<QtAntdPaintStats> classStats() const;
+    QList<QtAntdPaintStats> instanceStats() const;
+    QtAntdPaintStats stats(const QWidget *widget) const;
+
+    void dump() const;
+
+protected:
+    const QScopedPointer<QtAntdInstrumentationPrivate> d_ptr;
+
+private:
+    Q_DECLARE_PRIVATE(QtAntdInstrumentation)
+
+    QtAntdInstrumentation();
+
+    QtAntdInstrumentation(QtAntdInstrumentation const &);
+    void operator=(QtAntdInstrumentation const &);
+};
+
+#endif  // QTANTDINSTRUMENTATION_H
@@ -1,8 +1,8 @@
 #ifndef QTANTDSTYLE_H
 #define QTANTDSTYLE_H
 
-#include "antdlib/qtantdstyle_p.h"
 #include "components_global.h"
+#include "qtantdtheme.h"
 #include <QtWidgets/QCommonStyle>
 
 #define ANTD_DISABLE_THEME_COLORS                                                                                            \
@@ -10,17 +10,24 @@
         d->useThemeColors = false;                                                                                               \
     }
 
-class QtAntdTheme;
+class QtAntdStylePrivate;
 
 class COMPONENTS_EXPORT QtAntdStyle : public QCommonStyle
 {
     Q_OBJECT
 
 public:
-    inline static QtAntdStyle &instance();
+    static QtAntdStyle &instance();
+    ~QtAntdStyle();
 
+    /*! \brief Takes ownership of theme; a null theme is ignored.
+     * The theme the style starts with is deleted once replaced.
+     */
     void setTheme(QtAntdTheme *theme);
+    QtAntdTheme *theme() const;
     QColor themeColor(const QString &key) const;
+    QColor themeColor(Antd::ColorToken token) const;
+    quint64 themeGeneration() const;
 
 protected:
     const QScopedPointer<QtAntdStylePrivate> d_ptr;
@@ -34,10 +41,4 @@ private:
     void operator=(QtAntdStyle const &);
 };
 
-inline QtAntdStyle &QtAntdStyle::instance()
-{
-    static QtAntdStyle instance;
-    return instance;
-}
-
 #endif  // QTANTDSTYLE_H
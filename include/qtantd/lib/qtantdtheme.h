@@ -61,6 +61,49 @@ enum Color {
     
 };
 
+// Semantic color tokens. Resolving a token is a plain array index, so components
+// should prefer these over the string keys in paint paths.
+enum ColorToken {
+    ColorPrimary,              // "primary"
+    ColorPrimaryHover,         // "primary-hover"
+    ColorPrimaryActive,        // "primary-active"
+    ColorPrimaryOutline,       // "primary-outline"
+    ColorPrimaryBackground,    // "primary-background"
+
+    ColorSecondary,            // "secondary"
+    ColorSecondaryHover,       // "secondary-hover"
+    ColorSecondaryActive,      // "secondary-active"
+
+    ColorText,                 // "text"
+    ColorTextSecondary,        // "text-secondary"
+    ColorTextTertiary,         // "text-tertiary"
+    ColorTextQuaternary,       // "text-quaternary"
+    ColorTextDisabled,         // "text-disabled"
+
+    ColorBackground,           // "background"
+    ColorBackgroundSecondary,  // "background-secondary"
+    ColorSurface,              // "surface"
+    ColorSurfaceVariant,       // "surface-variant"
+
+    ColorBorder,               // "border"
+    ColorBorderSecondary,      // "border-secondary"
+    ColorBorderVariant,        // "border-variant"
+
+    ColorSuccess,              // "success"
+    ColorWarning,              // "warning"
+    ColorError,                // "error"
+    ColorInfo,                 // "info"
+
+    ColorErrorHover,           // "error-hover"
+    ColorErrorActive,          // "error-active"
+    ColorErrorBackground,      // "error-background"
+
+    ColorDisabled,             // "disabled"
+    ColorDisabledBackground,   // "disabled-background"
+
+    ColorTokenCount            // Number of tokens; also returned for unknown keys
+};
+
 }  // namespace Antd
 
 class QtAntdThemePrivate;
@@ -81,10 +124,21 @@ public:
     // Color access
     QColor getColor(const QString &key) const;
     QColor getColor(Antd::Color color) const;
+    QColor getColor(Antd::ColorToken token) const;
 
     // Color setting
     void setColor(const QString &key, const QColor &color);
     void setColor(const QString &key, Antd::Color color);
+    void setColor(Antd::ColorToken token, const QColor &color);
+
+    // Token interning: maps a string key such as "primary-hover" to its token,
+    // or Antd::ColorTokenCount if the key is not a built-in token.
+    static Antd::ColorToken colorToken(const QString &key);
+
+    // Monotonically increasing version, bumped whenever a color or the mode changes.
+    // Values are unique across all theme instances, so caches keyed on it stay
+    // valid when QtAntdStyle switches to another theme object.
+    quint64 generation() const;
 
     // Predefined semantic color getters
     QColor primary() const;
@@ -106,6 +160,8 @@ public:
 
 signals:
     void themeModeChanged(Antd::ThemeMode mode);
+    // Emitted whenever generation() changes (mode switch or any setColor call)
+    void themeChanged();
 
 protected:
     const QScopedPointer<QtAntdThemePrivate> d_ptr;
@@ -2,10 +2,13 @@
 #define QTANTDBUTTON_H
 
 #include <QtWidgets/QPushButton>
+#include <QFont>
 #include <QIcon>
 #include "components_global.h"
 
+class QPainter;
 class QtAntdButtonPrivate;
+struct QtAntdButtonOptions;
 
 /*!\class QtAntdButton
  * \brief Ant Design styled push button for Qt Widgets.
@@ -118,6 +121,17 @@ public:
     /*! \brief Minimum size hint per Ant Design sizing. */
     QSize minimumSizeHint() const Q_DECL_OVERRIDE;
 
+    /*! \brief Paint a button into rect without a widget.
+     * Uses the same drawing code as paintEvent(), for item delegates and
+     * offscreen rendering. May be called from any thread (render caches are
+     * per thread) as long as the theme is not changed meanwhile.
+     */
+    static void paint(QPainter *painter, const QRect &rect, const QtAntdButtonOptions &options);
+    /*! \brief Natural size of a button painted with options; the same as
+     * sizeHint() of a QtAntdButton with that content, size and shape.
+     */
+    static QSize sizeHint(const QtAntdButtonOptions &options);
+
 protected:
     /*! \brief Custom paint implementing Ant Design look & feel. */
     void paintEvent(QPaintEvent *event) Q_DECL_OVERRIDE;
@@ -133,6 +147,8 @@ protected:
 #endif
     /*! \brief Resets hover/press state. */
     void leaveEvent(QEvent *event) Q_DECL_OVERRIDE;
+    /*! \brief Invalidates the cached content layout on font and style changes. */
+    void changeEvent(QEvent *event) Q_DECL_OVERRIDE;
 
     const QScopedPointer<QtAntdButtonPrivate> d_ptr;
 
@@ -141,4 +157,25 @@ private:
     Q_DECLARE_PRIVATE(QtAntdButton)
 };
 
+/*! \brief Content and state of a button drawn with QtAntdButton::paint(). */
+struct QtAntdButtonOptions
+{
+    QString text;
+    QIcon icon;
+    QSize iconSize { 16, 16 };
+    QFont font; //!< Text font, the application font by default
+
+    QtAntdButton::ButtonType type { QtAntdButton::Default };
+    QtAntdButton::ButtonSize size { QtAntdButton::Medium };
+    QtAntdButton::ButtonShape shape { QtAntdButton::DefaultShape };
+    QtAntdButton::ColorPreset colorPreset { QtAntdButton::PresetDefault };
+    bool danger { false };
+
+    bool enabled { true };
+    bool hovered { false };
+    bool pressed { false };
+    bool loading { false };
+    int loadingAngle { 0 }; //!< Spinner rotation in degrees
+};
+
 #endif // QTANTDBUTTON_H
\ No newline at end of file
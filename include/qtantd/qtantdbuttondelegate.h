@@ -0,0 +1,74 @@
+#ifndef QTANTDBUTTONDELEGATE_H
+#define QTANTDBUTTONDELEGATE_H
+
+#include <QtWidgets/QStyledItemDelegate>
+#include "components_global.h"
+#include "qtantdbutton.h"
+
+class QtAntdButtonDelegatePrivate;
+
+/*!\class QtAntdButtonDelegate
+ * \brief Item delegate painting an Ant Design button in every item.
+ *
+ * The button is painted with QtAntdButton::paint(), so no widget is created per
+ * item. Its label is text() when set, otherwise the item's Qt::DisplayRole, and
+ * its icon the item's Qt::DecorationRole. Hovering and pressing the button of
+ * an item gives the same feedback as a QtAntdButton; a click on it, or Space
+ * while the item is current, emits clicked().
+ */
+class COMPONENTS_EXPORT QtAntdButtonDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    explicit QtAntdButtonDelegate(QObject *parent = nullptr);
+    explicit QtAntdButtonDelegate(const QString &text, QObject *parent = nullptr);
+    ~QtAntdButtonDelegate();
+
+    /*! \brief Label of every button; empty uses the item text. */
+    void setText(const QString &text);
+    QString text() const;
+
+    void setButtonType(QtAntdButton::ButtonType type);
+    QtAntdButton::ButtonType buttonType() const;
+
+    /*! \brief Button size, Small by default to fit item rows. */
+    void setButtonSize(QtAntdButton::ButtonSize size);
+    QtAntdButton::ButtonSize buttonSize() const;
+
+    void setButtonShape(QtAntdButton::ButtonShape shape);
+    QtAntdButton::ButtonShape buttonShape() const;
+
+    void setColorPreset(QtAntdButton::ColorPreset preset);
+    QtAntdButton::ColorPreset colorPreset() const;
+
+    void setDanger(bool danger);
+    bool isDanger() const;
+
+    /*! \brief Placement of the button inside the item, centered by default. */
+    void setAlignment(Qt::Alignment alignment);
+    Qt::Alignment alignment() const;
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option,
+               const QModelIndex &index) const Q_DECL_OVERRIDE;
+    QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const Q_DECL_OVERRIDE;
+    /*! \brief Buttons have no editor. */
+    QWidget *createEditor(QWidget *parent, const QStyleOptionViewItem &option,
+                          const QModelIndex &index) const Q_DECL_OVERRIDE;
+
+signals:
+    /*! \brief Emitted when the button of index was clicked. */
+    void clicked(const QModelIndex &index);
+
+protected:
+    bool editorEvent(QEvent *event, QAbstractItemModel *model, const QStyleOptionViewItem &option,
+                     const QModelIndex &index) Q_DECL_OVERRIDE;
+
+    const QScopedPointer<QtAntdButtonDelegatePrivate> d_ptr;
+
+private:
+    Q_DISABLE_COPY(QtAntdButtonDelegate)
+    Q_DECLARE_PRIVATE(QtAntdButtonDelegate)
+};
+
+#endif // QTANTDBUTTONDELEGATE_H
@@ -3,9 +3,12 @@
 
 #include <QtWidgets/QWidget>
 #include <QColor>
+#include <QFont>
 #include "components_global.h"
 
+class QPainter;
 class QtAntdDividerPrivate;
+struct QtAntdDividerOptions;
 
 class COMPONENTS_EXPORT QtAntdDivider : public QWidget
 {
@@ -52,6 +55,9 @@ public:
     QSize sizeHint() const Q_DECL_OVERRIDE;
     QSize minimumSizeHint() const Q_DECL_OVERRIDE;
 
+    // Same drawing code as paintEvent(), without a widget
+    static void paint(QPainter *painter, const QRect &rect, const QtAntdDividerOptions &options);
+
 protected:
     void paintEvent(QPaintEvent *event) Q_DECL_OVERRIDE;
 
@@ -62,4 +68,16 @@ private:
     Q_DECLARE_PRIVATE(QtAntdDivider)
 };
 
+// Content and style of a divider drawn with QtAntdDivider::paint()
+struct QtAntdDividerOptions
+{
+    QString text;
+    QtAntdDivider::TextAlignment alignment = QtAntdDivider::Center;
+    QtAntdDivider::LineStyle lineStyle = QtAntdDivider::SolidLine;
+    int lineThickness = 1;
+    QColor lineColor; // Invalid uses the theme border color
+    QColor textColor; // Invalid uses the theme text color
+    QFont font;
+};
+
 #endif // QTANTDDIVIDER_H
\ No newline at end of file
@@ -2,10 +2,13 @@
 #define QTANTDINPUT_H
 
 #include <QtWidgets/QLineEdit>
+#include <QFont>
 #include <QIcon>
 #include "components_global.h"
 
+class QPainter;
 class QtAntdInputPrivate;
+struct QtAntdInputOptions;
 
 /*!\class QtAntdInput
  * \brief Ant Design styled line edit input for Qt Widgets.
@@ -84,6 +87,17 @@ public:
     /*! \brief Minimum size hint per Ant Design sizing. */
     QSize minimumSizeHint() const Q_DECL_OVERRIDE;
 
+    /*! \brief Paint an input box into rect without a widget.
+     * Uses the same drawing code as paintEvent(); text is drawn elided, with
+     * no caret, selection or clear button. For item delegates and offscreen
+     * rendering, from any thread; the theme must not change meanwhile.
+     */
+    static void paint(QPainter *painter, const QRect &rect, const QtAntdInputOptions &options);
+    /*! \brief Size of an input painted with options fitting its text or
+     * placeholder and affixes, including the glow margin.
+     */
+    static QSize sizeHint(const QtAntdInputOptions &options);
+
 signals:
     /*! \brief Emitted when clear button is clicked. */
     void clearButtonClicked();
@@ -120,4 +134,25 @@ private:
     Q_DECLARE_PRIVATE(QtAntdInput)
 };
 
+/*! \brief Content and state of an input drawn with QtAntdInput::paint(). */
+struct QtAntdInputOptions
+{
+    QString text;
+    QString placeholderText; //!< Drawn when text is empty
+    QString prefixText;
+    QIcon prefixIcon;
+    QString suffixText;
+    QIcon suffixIcon;
+    QFont font;
+
+    QtAntdInput::InputSize size { QtAntdInput::Medium };
+    QtAntdInput::InputStatus status { QtAntdInput::Normal };
+    int glowMargin { 4 }; //!< Space reserved around the box for the focus glow
+
+    bool useThemeColors { true };
+    bool enabled { true };
+    bool hovered { false };
+    bool focused { false };
+};
+
 #endif // QTANTDINPUT_H
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef QTANTDINPUTDELEGATE_H
+#define QTANTDINPUTDELEGATE_H
+
+#include <QtWidgets/QStyledItemDelegate>
+#include "components_global.h"
+#include "qtantdinput.h"
+
+class QtAntdInputDelegatePrivate;
+
+/*!\class QtAntdInputDelegate
+ * \brief Item delegate painting an Ant Design input box in every item.
+ *
+ * Items are painted with QtAntdInput::paint() showing the item's Qt::DisplayRole
+ * text. A real QtAntdInput is only created as the editor of the item being
+ * edited (per the view's edit triggers) and placed exactly over the painted
+ * box; it writes Qt::EditRole back when editing ends and is then destroyed.
+ * Avoid QAbstractItemView::openPersistentEditor(), which would keep one
+ * widget per item alive.
+ */
+class COMPONENTS_EXPORT QtAntdInputDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    explicit QtAntdInputDelegate(QObject *parent = nullptr);
+    ~QtAntdInputDelegate();
+
+    void setInputSize(QtAntdInput::InputSize size);
+    QtAntdInput::InputSize inputSize() const;
+
+    /*! \brief Placeholder shown for items with empty text and in the editor. */
+    void setPlaceholderText(const QString &text);
+    QString placeholderText() const;
+
+    void setUseThemeColors(bool value);
+    bool useThemeColors() const;
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option,
+               const QModelIndex &index) const Q_DECL_OVERRIDE;
+    QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const Q_DECL_OVERRIDE;
+
+    QWidget *createEditor(QWidget *parent, const QStyleOptionViewItem &option,
+                          const QModelIndex &index) const Q_DECL_OVERRIDE;
+    void setEditorData(QWidget *editor, const QModelIndex &index) const Q_DECL_OVERRIDE;
+    void setModelData(QWidget *editor, QAbstractItemModel *model,
+                      const QModelIndex &index) const Q_DECL_OVERRIDE;
+    void updateEditorGeometry(QWidget *editor, const QStyleOptionViewItem &option,
+                              const QModelIndex &index) const Q_DECL_OVERRIDE;
+
+protected:
+    const QScopedPointer<QtAntdInputDelegatePrivate> d_ptr;
+
+private:
+    Q_DISABLE_COPY(QtAntdInputDelegate)
+    Q_DECLARE_PRIVATE(QtAntdInputDelegate)
+};
+
+#endif // QTANTDINPUTDELEGATE_H
@@ -0,0 +1,66 @@
+#ifndef QTANTDSEARCHPROXYMODEL_H
+#define QTANTDSEARCHPROXYMODEL_H
+
+#include "qtantdtableproxymodel.h"
+
+class QtAntdSearchProxyModelPrivate;
+
+/*!\class QtAntdSearchProxyModel
+ * \brief Type-ahead filter for option lists of any size, as used by QtAntdSelect.
+ *
+ * Keeps the rows whose Qt::DisplayRole text in searchColumn() contains
+ * searchText(), ignoring case and accents ("elan" finds "Élan"). The texts are
+ * read into a trigram index when the first search starts. There is one index
+ * per source model and column, shared by every proxy searching them, and it
+ * follows row inserts, removals and edits of the source incrementally.
+ *
+ * Searches run on a worker thread: the proxy keeps showing the previous
+ * result until the new one is applied (isSearching() is true meanwhile), and
+ * a newer search text cancels a search still running. Typing more characters
+ * only re-checks the rows of the previous result.
+ *
+ * Sorting and column filters of QtAntdTableProxyModel still apply on top.
+ */
+class COMPONENTS_EXPORT QtAntdSearchProxyModel : public QtAntdTableProxyModel
+{
+    Q_OBJECT
+
+public:
+    explicit QtAntdSearchProxyModel(QObject *parent = nullptr);
+    ~QtAntdSearchProxyModel();
+
+    void setSourceModel(QAbstractItemModel *sourceModel) Q_DECL_OVERRIDE;
+
+    void setSearchColumn(int column);
+    int searchColumn() const;
+
+    /*! \brief An empty text shows every row. */
+    void setSearchText(const QString &text);
+    QString searchText() const;
+
+    /*! \brief Whether the index or a search is still being computed. */
+    bool isSearching() const;
+
+    /*! \brief Source index of the first row whose text in searchColumn() is
+     * exactly text (case-sensitive), or an invalid index.
+     *
+     * Only the rows the index finds for text are compared, e.g. when Enter
+     * commits typed text. Until a first search has built the index, the source
+     * rows are scanned instead.
+     */
+    QModelIndex findExact(const QString &text) const;
+
+signals:
+    void searchingChanged(bool searching);
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const Q_DECL_OVERRIDE;
+
+    const QScopedPointer<QtAntdSearchProxyModelPrivate> d_ptr;
+
+private:
+    Q_DISABLE_COPY(QtAntdSearchProxyModel)
+    Q_DECLARE_PRIVATE(QtAntdSearchProxyModel)
+};
+
+#endif // QTANTDSEARCHPROXYMODEL_H
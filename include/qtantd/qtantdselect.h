@@ -0,0 +1,121 @@
+#ifndef QTANTDSELECT_H
+#define QTANTDSELECT_H
+
+#include <QtWidgets/QWidget>
+#include <QtCore/QModelIndex>
+#include "components_global.h"
+
+class QAbstractItemModel;
+class QtAntdSelectPrivate;
+
+/*!\class QtAntdSelect
+ * \brief Ant Design select for Qt Widgets, built for very large option sets.
+ *
+ * Options are the rows of a QAbstractItemModel (the Qt::DisplayRole text of
+ * modelColumn()). The dropdown is a list view with uniform row heights that
+ * paints only the visible options and is kept between openings, so opening it
+ * costs the same for ten options and for a million.
+ *
+ * - Single: one option, replaced by each choice; the dropdown closes.
+ * - Multiple: any number of options, shown as tags in the box.
+ * - Tags: like Multiple, and Enter also turns the typed text into a tag when
+ *   no option has exactly that text.
+ *
+ * Typing while the dropdown is open filters the options (always in Multiple
+ * and Tags modes, with showSearch() in Single mode), ignoring case and
+ * accents. The search runs on an index of the option texts in a worker
+ * thread, so input never waits for it. The index holds a folded copy of the
+ * texts; it is built on the first search and shared by every select on the
+ * same model and column. See QtAntdSearchProxyModel.
+ */
+class COMPONENTS_EXPORT QtAntdSelect : public QWidget
+{
+    Q_OBJECT
+
+public:
+    enum SelectMode {
+        Single,
+        Multiple,
+        Tags
+    };
+
+    /*! \brief Same heights as QtAntdInput::InputSize. */
+    enum SelectSize {
+        Small,
+        Medium,
+        Large
+    };
+
+    explicit QtAntdSelect(QWidget *parent = nullptr);
+    ~QtAntdSelect();
+
+    void setMode(SelectMode mode);
+    SelectMode mode() const;
+
+    void setSelectSize(SelectSize size);
+    SelectSize selectSize() const;
+
+    void setUseThemeColors(bool value);
+    bool useThemeColors() const;
+
+    /*! \brief Options shown in the dropdown; the model is not owned. */
+    void setModel(QAbstractItemModel *model);
+    QAbstractItemModel *model() const;
+    void setModelColumn(int column);
+    int modelColumn() const;
+
+    void setPlaceholderText(const QString &text);
+    QString placeholderText() const;
+
+    /*! \brief Whether typing filters the options in Single mode. */
+    void setShowSearch(bool value);
+    bool showSearch() const;
+
+    /*! \brief Options visible in the dropdown before it scrolls, 8 by default. */
+    void setMaxVisibleItems(int count);
+    int maxVisibleItems() const;
+
+    /*! \brief The selected option in Single mode (the first one otherwise). */
+    void setCurrentIndex(const QModelIndex &index);
+    QModelIndex currentIndex() const;
+    QString currentText() const;
+
+    /*! \brief Selected options of the model, in selection order. */
+    void setSelectedIndexes(const QModelIndexList &indexes);
+    QModelIndexList selectedIndexes() const;
+    /*! \brief Texts of all selected options, including typed tags. */
+    QStringList selectedTexts() const;
+    void clearSelection();
+
+    void showPopup();
+    void hidePopup();
+    bool isPopupVisible() const;
+
+    QSize sizeHint() const Q_DECL_OVERRIDE;
+    QSize minimumSizeHint() const Q_DECL_OVERRIDE;
+
+signals:
+    void selectionChanged();
+
+protected:
+    void paintEvent(QPaintEvent *event) Q_DECL_OVERRIDE;
+    void mousePressEvent(QMouseEvent *event) Q_DECL_OVERRIDE;
+    void keyPressEvent(QKeyEvent *event) Q_DECL_OVERRIDE;
+    void focusInEvent(QFocusEvent *event) Q_DECL_OVERRIDE;
+    void focusOutEvent(QFocusEvent *event) Q_DECL_OVERRIDE;
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    void enterEvent(QEnterEvent *event) Q_DECL_OVERRIDE;
+#else
+    void enterEvent(QEvent *event) Q_DECL_OVERRIDE;
+#endif
+    void leaveEvent(QEvent *event) Q_DECL_OVERRIDE;
+    void resizeEvent(QResizeEvent *event) Q_DECL_OVERRIDE;
+
+    const QScopedPointer<QtAntdSelectPrivate> d_ptr;
+
+private:
+    Q_DISABLE_COPY(QtAntdSelect)
+    Q_DECLARE_PRIVATE(QtAntdSelect)
+};
+
+#endif // QTANTDSELECT_H
@@ -2,10 +2,13 @@
 #define QTANTDSWITCH_H
 
 #include <QtWidgets/QAbstractButton>
+#include <QFont>
 #include <QIcon>
 #include "components_global.h"
 
+class QPainter;
 class QtAntdSwitchPrivate;
+struct QtAntdSwitchOptions;
 
 /*!
  * \class QtAntdSwitch
@@ -82,6 +85,14 @@ public:
     /*! \brief Set animation value for internal use. */
     void setAnimationValue(qreal value);
 
+    /*! \brief Paint a switch centered in rect without a widget.
+     * Uses the same drawing code as paintEvent(), for item delegates and
+     * offscreen rendering, also on worker threads while the theme stays the same.
+     */
+    static void paint(QPainter *painter, const QRect &rect, const QtAntdSwitchOptions &options);
+    /*! \brief Size of a switch painted with options, as sizeHint() of a widget. */
+    static QSize sizeHint(const QtAntdSwitchOptions &options);
+
 protected:
     /*! \brief Custom paint implementing Ant Design switch appearance. */
     void paintEvent(QPaintEvent *event) Q_DECL_OVERRIDE;
@@ -110,4 +121,26 @@ private:
     Q_DECLARE_PRIVATE(QtAntdSwitch)
 };
 
+/*! \brief Content and state of a switch drawn with QtAntdSwitch::paint(). */
+struct QtAntdSwitchOptions
+{
+    QtAntdSwitch::SwitchSize size { QtAntdSwitch::Medium };
+    bool checked { false };
+    qreal position { -1.0 }; //!< Handle position, 0.0 = off to 1.0 = on; negative follows checked
+
+    QString checkedText;
+    QString uncheckedText;
+    QIcon checkedIcon;
+    QIcon uncheckedIcon;
+    QFont font; //!< Track text font, scaled to the track height
+
+    bool useThemeColors { true };
+    bool enabled { true };
+    bool hovered { false };
+    bool pressed { false };
+    bool focused { false };
+    bool loading { false };
+    int loadingAngle { 0 }; //!< Spinner rotation in degrees
+};
+
 #endif // QTANTDSWITCH_H
\ No newline at end of file
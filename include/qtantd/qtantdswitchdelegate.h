@@ -0,0 +1,72 @@
+#ifndef QTANTDSWITCHDELEGATE_H
+#define QTANTDSWITCHDELEGATE_H
+
+#include <QtWidgets/QStyledItemDelegate>
+#include "components_global.h"
+#include "qtantdswitch.h"
+
+class QtAntdSwitchDelegatePrivate;
+
+/*!\class QtAntdSwitchDelegate
+ * \brief Item delegate painting an Ant Design switch in every item.
+ *
+ * The switch is painted with QtAntdSwitch::paint(), so no widget is created per
+ * item and views with many thousands of rows stay cheap. Hovering and pressing
+ * the switch of an item gives the same feedback as a QtAntdSwitch; a click on
+ * it, or Space while the item is current, toggles the value stored under
+ * checkedRole() and emits toggled().
+ *
+ * With Qt::CheckStateRole (default) the item must be Qt::ItemIsUserCheckable,
+ * otherwise Qt::ItemIsEditable, for the switch to toggle.
+ */
+class COMPONENTS_EXPORT QtAntdSwitchDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    explicit QtAntdSwitchDelegate(QObject *parent = nullptr);
+    ~QtAntdSwitchDelegate();
+
+    /*! \brief Role holding the checked state, a Qt::CheckState or a bool. */
+    void setCheckedRole(int role);
+    int checkedRole() const;
+
+    void setSwitchSize(QtAntdSwitch::SwitchSize size);
+    QtAntdSwitch::SwitchSize switchSize() const;
+
+    /*! \brief Text shown inside the track of every switch. */
+    void setCheckedText(const QString &text);
+    QString checkedText() const;
+    void setUncheckedText(const QString &text);
+    QString uncheckedText() const;
+
+    /*! \brief Placement of the switch inside the item, centered by default. */
+    void setAlignment(Qt::Alignment alignment);
+    Qt::Alignment alignment() const;
+
+    void setUseThemeColors(bool value);
+    bool useThemeColors() const;
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option,
+               const QModelIndex &index) const Q_DECL_OVERRIDE;
+    QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const Q_DECL_OVERRIDE;
+    /*! \brief Switches are edited in place; no editor is created. */
+    QWidget *createEditor(QWidget *parent, const QStyleOptionViewItem &option,
+                          const QModelIndex &index) const Q_DECL_OVERRIDE;
+
+signals:
+    /*! \brief Emitted after the switch of index was toggled by the user. */
+    void toggled(const QModelIndex &index, bool checked);
+
+protected:
+    bool editorEvent(QEvent *event, QAbstractItemModel *model, const QStyleOptionViewItem &option,
+                     const QModelIndex &index) Q_DECL_OVERRIDE;
+
+    const QScopedPointer<QtAntdSwitchDelegatePrivate> d_ptr;
+
+private:
+    Q_DISABLE_COPY(QtAntdSwitchDelegate)
+    Q_DECLARE_PRIVATE(QtAntdSwitchDelegate)
+};
+
+#endif // QTANTDSWITCHDELEGATE_H
@@ -0,0 +1,78 @@
+#ifndef QTANTDTABLE_H
+#define QTANTDTABLE_H
+
+#include <QtWidgets/QTableView>
+#include "components_global.h"
+
+class QtAntdTablePrivate;
+class QtAntdTableProxyModel;
+
+/*!\class QtAntdTable
+ * \brief Ant Design table over any flat QAbstractItemModel.
+ *
+ * Only the rows inside the viewport are laid out and painted, so models with
+ * millions of rows scroll as smoothly as small ones. Rows share the height of
+ * tableSize() by default; with uniform row heights turned off, each row is
+ * measured from its contents the first time it becomes visible and keeps that
+ * height afterwards.
+ *
+ * The model set with setModel() is wrapped in a QtAntdTableProxyModel that
+ * sorts and filters without blocking the event loop. Clicking the header of a
+ * sortable column cycles between ascending, descending and unsorted.
+ */
+class COMPONENTS_EXPORT QtAntdTable : public QTableView
+{
+    Q_OBJECT
+
+public:
+    enum TableSize {
+        Large,  // 16px cell padding
+        Middle, // 12px cell padding
+        Small   // 8px cell padding
+    };
+
+    explicit QtAntdTable(QWidget *parent = nullptr);
+    ~QtAntdTable();
+
+    /*! \brief Shows model through proxyModel(). */
+    void setModel(QAbstractItemModel *model) Q_DECL_OVERRIDE;
+    QAbstractItemModel *sourceModel() const;
+    QtAntdTableProxyModel *proxyModel() const;
+
+    void setTableSize(TableSize size);
+    TableSize tableSize() const;
+
+    /*! \brief Whether every row has the height of tableSize(), true by default. */
+    void setUniformRowHeights(bool value);
+    bool uniformRowHeights() const;
+
+    /*! \brief Shades every other row. */
+    void setStriped(bool value);
+    bool isStriped() const;
+
+    void setUseThemeColors(bool value);
+    bool useThemeColors() const;
+
+    void setColumnSortable(int column, bool sortable);
+    bool isColumnSortable(int column) const;
+
+    /*! \brief See QtAntdTableProxyModel::setColumnFilter(). */
+    void setColumnFilter(int column, const QString &text);
+    QString columnFilter(int column) const;
+
+protected:
+    bool viewportEvent(QEvent *event) Q_DECL_OVERRIDE;
+    void paintEvent(QPaintEvent *event) Q_DECL_OVERRIDE;
+    void resizeEvent(QResizeEvent *event) Q_DECL_OVERRIDE;
+    void changeEvent(QEvent *event) Q_DECL_OVERRIDE;
+    void scrollContentsBy(int dx, int dy) Q_DECL_OVERRIDE;
+    void setupViewport(QWidget *viewport) Q_DECL_OVERRIDE;
+
+    const QScopedPointer<QtAntdTablePrivate> d_ptr;
+
+private:
+    Q_DISABLE_COPY(QtAntdTable)
+    Q_DECLARE_PRIVATE(QtAntdTable)
+};
+
+#endif // QTANTDTABLE_H
@@ -0,0 +1,97 @@
+#ifndef QTANTDTABLEPROXYMODEL_H
+#define QTANTDTABLEPROXYMODEL_H
+
+#include <QtCore/QAbstractProxyModel>
+#include "components_global.h"
+
+class QtAntdTableProxyModelPrivate;
+
+/*!\class QtAntdTableProxyModel
+ * \brief Filter and sort proxy for flat (table and list) models of any size.
+ *
+ * Unlike QSortFilterProxyModel, a filter or sort change never blocks the event
+ * loop: the new row order is computed in time slices of timeSlice() ms between
+ * events, and the view keeps showing the previous order until it is complete
+ * (isPending() is true meanwhile). Sorting compares the sortRole() value of
+ * each row once, numerically for numbers, dates and times and case-insensitively
+ * for text, and finishes with resumable merge passes.
+ *
+ * Typing more characters into a column filter only re-checks the rows that are
+ * currently shown. A new filter result is applied by removing and inserting
+ * the rows that differ, so views keep their selection, current index and
+ * scroll position. Inserting, removing or editing a few source rows updates
+ * the mapping in place with fine-grained row signals, also while an
+ * evaluation is pending: it keeps running and re-checks those rows when it
+ * completes. Larger changes are re-evaluated in the background. With no
+ * filter and no sort the proxy maps rows 1:1 at no cost.
+ *
+ * Only top-level source rows are mapped; children are not supported.
+ */
+class COMPONENTS_EXPORT QtAntdTableProxyModel : public QAbstractProxyModel
+{
+    Q_OBJECT
+
+public:
+    explicit QtAntdTableProxyModel(QObject *parent = nullptr);
+    ~QtAntdTableProxyModel();
+
+    void setSourceModel(QAbstractItemModel *sourceModel) Q_DECL_OVERRIDE;
+
+    /*! \brief Keep rows whose Qt::DisplayRole text in column contains text,
+     * ignoring case. An empty text removes the column's filter.
+     */
+    void setColumnFilter(int column, const QString &text);
+    QString columnFilter(int column) const;
+    void clearColumnFilters();
+
+    /*! \brief Sort by column in order; column -1 restores the source order. */
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) Q_DECL_OVERRIDE;
+    int sortColumn() const;
+    Qt::SortOrder sortOrder() const;
+
+    void setSortRole(int role);
+    int sortRole() const;
+
+    /*! \brief Milliseconds of evaluation per event-loop pass, 8 by default. */
+    void setTimeSlice(int msecs);
+    int timeSlice() const;
+
+    /*! \brief Whether a filter or sort change is still being evaluated. */
+    bool isPending() const;
+    /*! \brief Finishes a pending evaluation synchronously. */
+    void flush();
+
+    QModelIndex mapToSource(const QModelIndex &proxyIndex) const Q_DECL_OVERRIDE;
+    QModelIndex mapFromSource(const QModelIndex &sourceIndex) const Q_DECL_OVERRIDE;
+
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const Q_DECL_OVERRIDE;
+    QModelIndex parent(const QModelIndex &child) const Q_DECL_OVERRIDE;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const Q_DECL_OVERRIDE;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const Q_DECL_OVERRIDE;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
+
+signals:
+    void pendingChanged(bool pending);
+
+protected:
+    /*! \brief Whether sourceRow is shown. The default checks the column filters;
+     * reimplement for other criteria and call invalidateFilter() when they change.
+     */
+    virtual bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const;
+    void invalidateFilter();
+    /*! \brief Like invalidateFilter(), for criteria that can only hide more rows:
+     * only the rows shown now are checked again.
+     */
+    void narrowFilter();
+    /*! \brief Stops calling filterAcceptsRow() until the next invalidateFilter(). */
+    void resetFilter();
+
+    const QScopedPointer<QtAntdTableProxyModelPrivate> d_ptr;
+
+private:
+    Q_DISABLE_COPY(QtAntdTableProxyModel)
+    Q_DECLARE_PRIVATE(QtAntdTableProxyModel)
+};
+
+#endif // QTANTDTABLEPROXYMODEL_H
@@ -0,0 +1,130 @@
+#include <QtTest/QtTest>
+
+#include "antdlib/qtantdsearchindex_p.h"
+
+using QtAntdInternal::SearchIndex;
+using QtAntdInternal::foldSearchText;
+
+class QtAntdSearchIndexTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void foldCaseAndAccents();
+    void shortQueries();
+    void narrowWithCandidates();
+    void replaceAndRemoveThenPrune();
+    void cancelledByGeneration();
+
+private:
+    static QVector<int> rowsOf(const SearchIndex &index, const QVector<int> &ids);
+};
+
+/*
+ * Rows of ids in index, ascending; searches return ids.
+ */
+QVector<int> QtAntdSearchIndexTest::rowsOf(const SearchIndex &index, const QVector<int> &ids)
+{
+    QVector<int> rows;
+    for (int row = 0; row < index.rowCount(); ++row) {
+        if (ids.contains(index.idOfRow(row))) {
+            rows.append(row);
+        }
+    }
+    return rows;
+}
+
+void QtAntdSearchIndexTest::foldCaseAndAccents()
+{
+    QCOMPARE(foldSearchText("Élan"), QString("elan"));
+    QCOMPARE(foldSearchText("ÉLAN"), foldSearchText("elan"));
+    QCOMPARE(foldSearchText("Crème Brûlée"), QString("creme brulee"));
+
+    const SearchIndex index = SearchIndex::build({ "Élan", "elan vital", "Melange" });
+    QCOMPARE(rowsOf(index, index.search(foldSearchText("elan"))), QVector<int>({ 0, 1 }));
+    QCOMPARE(rowsOf(index, index.search(foldSearchText("ÉLAN"))), QVector<int>({ 0, 1 }));
+    QCOMPARE(rowsOf(index, index.search(foldSearchText("lan"))), QVector<int>({ 0, 1, 2 }));
+}
+
+void QtAntdSearchIndexTest::shortQueries()
+{
+    // Below three characters there are no trigrams to look up; every text is checked
+    const SearchIndex index = SearchIndex::build({ "ab", "bc", "abc", "x" });
+    QCOMPARE(rowsOf(index, index.search("b")), QVector<int>({ 0, 1, 2 }));
+    QCOMPARE(rowsOf(index, index.search("ab")), QVector<int>({ 0, 2 }));
+    QCOMPARE(rowsOf(index, index.search("x")), QVector<int>({ 3 }));
+    QCOMPARE(rowsOf(index, index.search("abc")), QVector<int>({ 2 }));
+    QVERIFY(index.search("zz").isEmpty());
+}
+
+void QtAntdSearchIndexTest::narrowWithCandidates()
+{
+    const SearchIndex index = SearchIndex::build({ "apple", "apricot", "banana", "grape", "papaya" });
+    const QVector<int> ap = index.search("ap");
+    QCOMPARE(rowsOf(index, ap), QVector<int>({ 0, 1, 3, 4 }));
+
+    QCOMPARE(rowsOf(index, index.search("app", &ap)), QVector<int>({ 0 }));
+    QCOMPARE(rowsOf(index, index.search("apa", &ap)), QVector<int>({ 4 }));
+
+    // Only candidates are checked, even where other texts match
+    const QVector<int> first = { index.idOfRow(0), index.idOfRow(1) };
+    QVERIFY(index.search("an", &first).isEmpty());
+    QCOMPARE(rowsOf(index, index.search("an")), QVector<int>({ 2 }));
+}
+
+void QtAntdSearchIndexTest::replaceAndRemoveThenPrune()
+{
+    QVector<QString> texts;
+    for (int i = 0; i < 3000; ++i) {
+        texts.append(QString("item%1").arg(i, 4, 10, QChar('0')));
+    }
+    SearchIndex index = SearchIndex::build(texts);
+
+    // Edits give rows new ids; the old texts no longer match
+    const int oldId = index.idOfRow(10);
+    index.replaceRow(10, foldSearchText("Other"));
+    QVERIFY(index.idOfRow(10) != oldId);
+    QVERIFY(!index.matches(oldId, "item0010"));
+    QVERIFY(index.search("item0010").isEmpty());
+    QCOMPARE(rowsOf(index, index.search("other")), QVector<int>({ 10 }));
+
+    // Removing most rows drops the removed ids from the posting lists
+    index.removeRows(0, 2500);
+    QCOMPARE(index.rowCount(), 500);
+    QCOMPARE(index.search("item").size(), 500);
+    QVERIFY(index.search("other").isEmpty());
+    QVERIFY(index.search("item2499").isEmpty());
+    QCOMPARE(rowsOf(index, index.search("item2500")), QVector<int>({ 0 }));
+    QCOMPARE(rowsOf(index, index.search("item2999")), QVector<int>({ 499 }));
+
+    // The pruned index keeps following edits
+    index.replaceRow(0, foldSearchText("Élan"));
+    index.insertRows(1, { "elan vital" });
+    QCOMPARE(rowsOf(index, index.search("elan")), QVector<int>({ 0, 1 }));
+    QCOMPARE(index.search("item").size(), 499);
+}
+
+void QtAntdSearchIndexTest::cancelledByGeneration()
+{
+    QVector<QString> texts;
+    for (int i = 0; i < 10000; ++i) {
+        texts.append(QString("option %1").arg(i));
+    }
+
+    QAtomicInteger<quint64> token(2);
+    const SearchIndex index = SearchIndex::build(texts, &token, 2);
+    QCOMPARE(index.rowCount(), texts.size());
+    QCOMPARE(index.search("option", nullptr, &token, 2).size(), texts.size());
+    QCOMPARE(index.search("op", nullptr, &token, 2).size(), texts.size());
+
+    // A newer generation stops the build and the searches of the older one
+    token.storeRelease(3);
+    QCOMPARE(SearchIndex::build(texts, &token, 2).rowCount(), 0);
+    QVERIFY(index.search("option", nullptr, &token, 2).isEmpty());
+    QVERIFY(index.search("op", nullptr, &token, 2).isEmpty());
+    const QVector<int> candidates = { index.idOfRow(0) };
+    QVERIFY(index.search("option", &candidates, &token, 2).isEmpty());
+}
+
+QTEST_GUILESS_MAIN(QtAntdSearchIndexTest)
+#include "qtantdsearchindextest.moc"
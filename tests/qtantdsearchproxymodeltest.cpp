@@ -0,0 +1,217 @@
+#include <QAbstractItemModelTester>
+#include <QSignalSpy>
+#include <QStandardItemModel>
+#include <QtTest/QtTest>
+
+#include "qtantdsearchproxymodel.h"
+
+class QtAntdSearchProxyModelTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void searchFoldsCaseAndAccents();
+    void typingMoreNarrows();
+    void sourceChangesWhileBuilding();
+    void sourceChangesAfterSearch();
+    void sharedSourceModel();
+    void findExact();
+
+private:
+    static QStandardItemModel *createModel(const QStringList &texts, QObject *parent);
+    static void finish(QtAntdSearchProxyModel *proxy);
+    static QStringList proxyTexts(const QAbstractItemModel &model);
+};
+
+QStandardItemModel *QtAntdSearchProxyModelTest::createModel(const QStringList &texts, QObject *parent)
+{
+    auto *model = new QStandardItemModel(0, 1, parent);
+    for (const QString &text : texts) {
+        model->appendRow(new QStandardItem(text));
+    }
+    return model;
+}
+
+/*
+ * Waits for the index and the search on the worker thread, then applies the
+ * filter at once.
+ */
+void QtAntdSearchProxyModelTest::finish(QtAntdSearchProxyModel *proxy)
+{
+    QTRY_VERIFY(!proxy->isSearching());
+    proxy->flush();
+}
+
+QStringList QtAntdSearchProxyModelTest::proxyTexts(const QAbstractItemModel &model)
+{
+    QStringList texts;
+    for (int row = 0; row < model.rowCount(); ++row) {
+        texts << model.index(row, 0).data().toString();
+    }
+    return texts;
+}
+
+void QtAntdSearchProxyModelTest::searchFoldsCaseAndAccents()
+{
+    QObject owner;
+    QStandardItemModel *source = createModel({ "Élan", "Berlin", "elan vital", "Kraków" }, &owner);
+    QtAntdSearchProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+    proxy.setSourceModel(source);
+    QCOMPARE(proxy.rowCount(), 4);
+
+    QSignalSpy searching(&proxy, &QtAntdSearchProxyModel::searchingChanged);
+    proxy.setSearchText("ELAN");
+    QVERIFY(proxy.isSearching());
+    finish(&proxy);
+    QCOMPARE(proxyTexts(proxy), QStringList() << "Élan" << "elan vital");
+    QCOMPARE(searching.count(), 2);
+
+    proxy.setSearchText("krakow");
+    finish(&proxy);
+    QCOMPARE(proxyTexts(proxy), QStringList() << "Kraków");
+
+    proxy.setSearchText(QString());
+    QVERIFY(!proxy.isSearching());
+    proxy.flush();
+    QCOMPARE(proxy.rowCount(), 4);
+}
+
+void QtAntdSearchProxyModelTest::typingMoreNarrows()
+{
+    QObject owner;
+    QStandardItemModel *source =
+        createModel({ "apple", "apricot", "banana", "grape", "papaya", "pear" }, &owner);
+    QtAntdSearchProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+    proxy.setSourceModel(source);
+
+    proxy.setSearchText("a");
+    finish(&proxy);
+    QCOMPARE(proxy.rowCount(), 6);
+
+    proxy.setSearchText("ap");
+    finish(&proxy);
+    QCOMPARE(proxyTexts(proxy), QStringList() << "apple" << "apricot" << "grape" << "papaya");
+
+    // Narrowing only removes rows; the ones kept stay valid
+    const QPersistentModelIndex papaya = proxy.index(3, 0);
+    QSignalSpy removed(&proxy, &QAbstractItemModel::rowsRemoved);
+    QSignalSpy reset(&proxy, &QAbstractItemModel::modelReset);
+    proxy.setSearchText("apa");
+    finish(&proxy);
+    QCOMPARE(proxyTexts(proxy), QStringList() << "papaya");
+    QVERIFY(removed.count() > 0);
+    QCOMPARE(reset.count(), 0);
+    QVERIFY(papaya.isValid());
+    QCOMPARE(papaya.row(), 0);
+}
+
+void QtAntdSearchProxyModelTest::sourceChangesWhileBuilding()
+{
+    QObject owner;
+    QStringList texts;
+    for (int i = 0; i < 20000; ++i) {
+        texts << QString("option %1").arg(i);
+    }
+    QStandardItemModel *source = createModel(texts, &owner);
+    QtAntdSearchProxyModel proxy;
+    proxy.setSourceModel(source);
+
+    // The index is read in time slices; these changes arrive before it is ready
+    proxy.setSearchText("needle");
+    QVERIFY(proxy.isSearching());
+    source->insertRow(0, new QStandardItem("needle first"));
+    source->appendRow(new QStandardItem("needle last"));
+    source->item(5)->setText("needle edited");
+    source->removeRow(1);
+
+    finish(&proxy);
+    QCOMPARE(proxyTexts(proxy), QStringList() << "needle first" << "needle edited" << "needle last");
+}
+
+void QtAntdSearchProxyModelTest::sourceChangesAfterSearch()
+{
+    QObject owner;
+    QStandardItemModel *source = createModel({ "Berlin", "Bern", "Paris" }, &owner);
+    QtAntdSearchProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+    proxy.setSourceModel(source);
+    proxy.setSearchText("ber");
+    finish(&proxy);
+    QCOMPARE(proxyTexts(proxy), QStringList() << "Berlin" << "Bern");
+
+    source->appendRow(new QStandardItem("Bergen"));
+    source->insertRow(0, new QStandardItem("Oslo"));
+    proxy.flush();
+    QCOMPARE(proxyTexts(proxy), QStringList() << "Berlin" << "Bern" << "Bergen");
+
+    source->item(1)->setText("Rome");
+    source->item(3)->setText("Berne");
+    proxy.flush();
+    QCOMPARE(proxyTexts(proxy), QStringList() << "Bern" << "Berne" << "Bergen");
+
+    source->removeRow(2);
+    proxy.flush();
+    QCOMPARE(proxyTexts(proxy), QStringList() << "Berne" << "Bergen");
+    QVERIFY(!proxy.isSearching());
+}
+
+void QtAntdSearchProxyModelTest::sharedSourceModel()
+{
+    QObject owner;
+    QStandardItemModel *source = createModel({ "Berlin", "Bern", "Paris" }, &owner);
+    QtAntdSearchProxyModel first;
+    QtAntdSearchProxyModel second;
+    first.setSourceModel(source);
+    second.setSourceModel(source);
+
+    first.setSearchText("ber");
+    second.setSearchText("par");
+    finish(&first);
+    finish(&second);
+    QCOMPARE(proxyTexts(first), QStringList() << "Berlin" << "Bern");
+    QCOMPARE(proxyTexts(second), QStringList() << "Paris");
+
+    // Both follow changes, also once one of them is gone
+    source->appendRow(new QStandardItem("Parma"));
+    first.setSourceModel(nullptr);
+    source->appendRow(new QStandardItem("Bergamo"));
+    second.flush();
+    QCOMPARE(proxyTexts(second), QStringList() << "Paris" << "Parma");
+
+    second.setSearchText("berg");
+    finish(&second);
+    QCOMPARE(proxyTexts(second), QStringList() << "Bergamo");
+}
+
+void QtAntdSearchProxyModelTest::findExact()
+{
+    QObject owner;
+    QStandardItemModel *source = createModel({ "Bern", "Berlin", "berlin", "Berlin Mitte" }, &owner);
+    QtAntdSearchProxyModel proxy;
+    proxy.setSourceModel(source);
+
+    // Before any search the source is scanned
+    QCOMPARE(proxy.findExact("Berlin").row(), 1);
+    QVERIFY(!proxy.findExact("Ber").isValid());
+
+    proxy.setSearchText("Berlin");
+    finish(&proxy);
+    QCOMPARE(proxy.findExact("Berlin").row(), 1);
+    QCOMPARE(proxy.findExact("berlin").row(), 2);
+    QCOMPARE(proxy.findExact("Berlin Mitte").row(), 3);
+    QCOMPARE(proxy.findExact("Bern").row(), 0);
+    QVERIFY(!proxy.findExact("BERLIN").isValid());
+    QVERIFY(!proxy.findExact("Berl").isValid());
+    QVERIFY(!proxy.findExact(QString()).isValid());
+
+    source->insertRow(0, new QStandardItem("Potsdam"));
+    source->item(2)->setText("Hamburg");
+    QCOMPARE(proxy.findExact("Berlin").row(), -1);
+    QCOMPARE(proxy.findExact("berlin").row(), 3);
+    QCOMPARE(proxy.findExact("Potsdam").row(), 0);
+}
+
+QTEST_GUILESS_MAIN(QtAntdSearchProxyModelTest)
+#include "qtantdsearchproxymodeltest.moc"
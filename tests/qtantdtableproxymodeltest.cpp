@@ -0,0 +1,226 @@
+#include <QAbstractItemModelTester>
+#include <QSignalSpy>
+#include <QStandardItemModel>
+#include <QtTest/QtTest>
+
+#include "qtantdtableproxymodel.h"
+
+class QtAntdTableProxyModelTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void sortEmptyThenAppend();
+    void sortClearThenAppend();
+    void editKeepingPosition();
+    void editMovingRow();
+    void editHidingRow();
+    void narrowingFilterKeepsIndexes();
+    void clearingFilterInsertsRows();
+    void sourceChangesWhilePending();
+
+private:
+    static QStringList proxyTexts(const QAbstractItemModel &model);
+};
+
+QStringList QtAntdTableProxyModelTest::proxyTexts(const QAbstractItemModel &model)
+{
+    QStringList texts;
+    for (int row = 0; row < model.rowCount(); ++row) {
+        texts << model.index(row, 0).data().toString();
+    }
+    return texts;
+}
+
+void QtAntdTableProxyModelTest::sortEmptyThenAppend()
+{
+    QStandardItemModel source(0, 1);
+    QtAntdTableProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+    proxy.setSourceModel(&source);
+    proxy.sort(0);
+    proxy.flush();
+
+    source.appendRow(new QStandardItem("b"));
+    source.appendRow(new QStandardItem("a"));
+    source.appendRow(new QStandardItem("c"));
+    QCOMPARE(proxyTexts(proxy), QStringList() << "a" << "b" << "c");
+}
+
+void QtAntdTableProxyModelTest::sortClearThenAppend()
+{
+    QStandardItemModel source(0, 1);
+    for (const char *text : { "d", "a", "c" }) {
+        source.appendRow(new QStandardItem(text));
+    }
+    QtAntdTableProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+    proxy.setSourceModel(&source);
+    proxy.sort(0);
+    proxy.flush();
+    QCOMPARE(proxyTexts(proxy), QStringList() << "a" << "c" << "d");
+
+    source.removeRows(0, source.rowCount());
+    QCOMPARE(proxy.rowCount(), 0);
+
+    source.appendRow(new QStandardItem("z"));
+    source.appendRow(new QStandardItem("y"));
+    source.insertRow(0, new QStandardItem("x"));
+    QCOMPARE(proxyTexts(proxy), QStringList() << "x" << "y" << "z");
+}
+
+void QtAntdTableProxyModelTest::editKeepingPosition()
+{
+    QStandardItemModel source(0, 1);
+    for (const char *text : { "a", "c", "e" }) {
+        source.appendRow(new QStandardItem(text));
+    }
+    QtAntdTableProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+    proxy.setSourceModel(&source);
+    proxy.sort(0);
+    proxy.flush();
+
+    const QPersistentModelIndex current = proxy.index(1, 0);
+    QSignalSpy removed(&proxy, &QAbstractItemModel::rowsRemoved);
+    QSignalSpy inserted(&proxy, &QAbstractItemModel::rowsInserted);
+    QSignalSpy moved(&proxy, &QAbstractItemModel::rowsMoved);
+    QSignalSpy changed(&proxy, &QAbstractItemModel::dataChanged);
+
+    source.item(1)->setText("d");
+    QCOMPARE(proxyTexts(proxy), QStringList() << "a" << "d" << "e");
+    QCOMPARE(removed.count(), 0);
+    QCOMPARE(inserted.count(), 0);
+    QCOMPARE(moved.count(), 0);
+    QCOMPARE(changed.count(), 1);
+    QCOMPARE(current.row(), 1);
+}
+
+void QtAntdTableProxyModelTest::editMovingRow()
+{
+    QStandardItemModel source(0, 1);
+    for (const char *text : { "a", "c", "e" }) {
+        source.appendRow(new QStandardItem(text));
+    }
+    QtAntdTableProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+    proxy.setSourceModel(&source);
+    proxy.sort(0);
+    proxy.flush();
+
+    const QPersistentModelIndex current = proxy.index(0, 0);
+    QSignalSpy removed(&proxy, &QAbstractItemModel::rowsRemoved);
+    QSignalSpy moved(&proxy, &QAbstractItemModel::rowsMoved);
+
+    source.item(0)->setText("f");
+    QCOMPARE(proxyTexts(proxy), QStringList() << "c" << "e" << "f");
+    QCOMPARE(removed.count(), 0);
+    QCOMPARE(moved.count(), 1);
+    QCOMPARE(current.row(), 2);
+
+    source.item(0)->setText("b");
+    QCOMPARE(proxyTexts(proxy), QStringList() << "b" << "c" << "e");
+    QCOMPARE(moved.count(), 2);
+    QCOMPARE(current.row(), 0);
+}
+
+void QtAntdTableProxyModelTest::editHidingRow()
+{
+    QStandardItemModel source(0, 1);
+    for (const char *text : { "apple", "apricot", "banana" }) {
+        source.appendRow(new QStandardItem(text));
+    }
+    QtAntdTableProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+    proxy.setSourceModel(&source);
+    proxy.sort(0, Qt::DescendingOrder);
+    proxy.setColumnFilter(0, "ap");
+    proxy.flush();
+    QCOMPARE(proxyTexts(proxy), QStringList() << "apricot" << "apple");
+
+    source.item(1)->setText("cherry");
+    QCOMPARE(proxyTexts(proxy), QStringList() << "apple");
+
+    source.item(2)->setText("grape");
+    QCOMPARE(proxyTexts(proxy), QStringList() << "grape" << "apple");
+}
+
+void QtAntdTableProxyModelTest::narrowingFilterKeepsIndexes()
+{
+    QStandardItemModel source(0, 1);
+    for (const char *text : { "apple", "banana", "apricot", "avocado", "grape" }) {
+        source.appendRow(new QStandardItem(text));
+    }
+    QtAntdTableProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+    proxy.setSourceModel(&source);
+    proxy.setColumnFilter(0, "a");
+    proxy.flush();
+    QCOMPARE(proxy.rowCount(), 5);
+
+    const QPersistentModelIndex current = proxy.index(2, 0);
+    QSignalSpy reset(&proxy, &QAbstractItemModel::modelAboutToBeReset);
+    QSignalSpy removed(&proxy, &QAbstractItemModel::rowsRemoved);
+
+    proxy.setColumnFilter(0, "ap");
+    proxy.flush();
+    QCOMPARE(proxyTexts(proxy), QStringList() << "apple" << "apricot" << "grape");
+    QCOMPARE(reset.count(), 0);
+    QCOMPARE(removed.count(), 2);
+    QCOMPARE(current.row(), 1);
+    QCOMPARE(current.data().toString(), QString("apricot"));
+}
+
+void QtAntdTableProxyModelTest::clearingFilterInsertsRows()
+{
+    QStandardItemModel source(0, 1);
+    for (const char *text : { "apple", "banana", "apricot" }) {
+        source.appendRow(new QStandardItem(text));
+    }
+    QtAntdTableProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+    proxy.setSourceModel(&source);
+    proxy.sort(0, Qt::DescendingOrder);
+    proxy.setColumnFilter(0, "ap");
+    proxy.flush();
+    QCOMPARE(proxyTexts(proxy), QStringList() << "apricot" << "apple");
+
+    const QPersistentModelIndex current = proxy.index(1, 0);
+    QSignalSpy reset(&proxy, &QAbstractItemModel::modelAboutToBeReset);
+    QSignalSpy inserted(&proxy, &QAbstractItemModel::rowsInserted);
+
+    proxy.setColumnFilter(0, QString());
+    proxy.flush();
+    QCOMPARE(proxyTexts(proxy), QStringList() << "banana" << "apricot" << "apple");
+    QCOMPARE(reset.count(), 0);
+    QCOMPARE(inserted.count(), 1);
+    QCOMPARE(current.row(), 2);
+}
+
+void QtAntdTableProxyModelTest::sourceChangesWhilePending()
+{
+    QStandardItemModel source(0, 1);
+    for (const char *text : { "d", "b", "f", "a" }) {
+        source.appendRow(new QStandardItem(text));
+    }
+    QtAntdTableProxyModel proxy;
+    QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+    proxy.setSourceModel(&source);
+    proxy.sort(0);
+    QVERIFY(proxy.isPending());
+
+    // Merged into the running evaluation instead of restarting it
+    source.appendRow(new QStandardItem("c"));
+    source.insertRow(0, new QStandardItem("e"));
+    source.item(1)->setText("g");
+    source.removeRow(2);
+    QVERIFY(proxy.isPending());
+
+    proxy.flush();
+    QVERIFY(!proxy.isPending());
+    QCOMPARE(proxyTexts(proxy), QStringList() << "a" << "c" << "e" << "f" << "g");
+}
+
+QTEST_GUILESS_MAIN(QtAntdTableProxyModelTest)
+
+#include "qtantdtableproxymodeltest.moc"